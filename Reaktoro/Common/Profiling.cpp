@@ -0,0 +1,53 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "Profiling.hpp"
+
+namespace Reaktoro {
+namespace {
+
+#ifndef REAKTORO_DISABLE_PROFILING
+
+/// The object recording the evaluations of thermodynamic models in the current thread.
+thread_local ThermoModelsProfiling* thermo_models_profiling = nullptr;
+
+#endif // REAKTORO_DISABLE_PROFILING
+
+} // namespace
+
+auto ProfilingCounter::operator+=(ProfilingCounter const& other) -> ProfilingCounter&
+{
+    count += other.count;
+    time += other.time;
+    return *this;
+}
+
+#ifndef REAKTORO_DISABLE_PROFILING
+
+auto profilingThermoModels() -> ThermoModelsProfiling*
+{
+    return thermo_models_profiling;
+}
+
+auto profilingThermoModels(ThermoModelsProfiling* profiling) -> void
+{
+    thermo_models_profiling = profiling;
+}
+
+#endif // REAKTORO_DISABLE_PROFILING
+
+} // namespace Reaktoro
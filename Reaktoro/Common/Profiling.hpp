@@ -19,6 +19,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Common/TimeUtils.hpp>
+#include <Reaktoro/Common/Types.hpp>
 
 namespace Reaktoro {
 
@@ -33,6 +34,9 @@ namespace Reaktoro {
 /// Macro to measure the elapsed time of an expression execution.
 #define timeit(expr, res) { expr; res 0.0; }
 
+/// Macro to execute statements and record their execution in a ProfilingCounter member of a profiling object (if not null).
+#define profileit(profiling, counter, ...) { __VA_ARGS__; }
+
 #else
 
 /// Macro to start timing of a sequence of statements.
@@ -44,6 +48,77 @@ namespace Reaktoro {
 /// Macro to measure the elapsed time of an expression execution.
 #define timeit(expr, res) { tic(__##__LINE__); expr; res elapsed(__start_time##__##__LINE__); }
 
+/// Macro to execute statements and record their execution in a ProfilingCounter member of a profiling object (if not null).
+#define profileit(profiling, counter, ...) { if(profiling) { tic(__profileit); __VA_ARGS__; (profiling)->counter.count += 1; (profiling)->counter.time += toc(__profileit); } else { __VA_ARGS__; } }
+
+#endif // REAKTORO_DISABLE_PROFILING
+
+/// Used to record the number of executions and the elapsed time of an instrumented operation.
+struct ProfilingCounter
+{
+    /// The number of executions of the operation.
+    Index count = 0;
+
+    /// The accumulated elapsed time of the executions of the operation (in seconds).
+    double time = 0.0;
+
+    /// Self addition of another ProfilingCounter instance to this one.
+    auto operator+=(ProfilingCounter const& other) -> ProfilingCounter&;
+};
+
+/// Used to record the evaluations of thermodynamic models when computing chemical properties.
+/// @see ThermoModelsProfilingScope
+struct ThermoModelsProfiling
+{
+    /// The evaluations of the standard thermodynamic models of the species in a phase.
+    ProfilingCounter standard_thermo;
+
+    /// The evaluations of the activity model of a phase.
+    ProfilingCounter activity;
+};
+
+#ifdef REAKTORO_DISABLE_PROFILING
+
+/// Return the object recording the evaluations of thermodynamic models in the current thread (always `nullptr` when profiling is disabled).
+inline auto profilingThermoModels() -> ThermoModelsProfiling* { return nullptr; }
+
+/// Set the object recording the evaluations of thermodynamic models in the current thread (no effect when profiling is disabled).
+inline auto profilingThermoModels(ThermoModelsProfiling* profiling) -> void {}
+
+#else
+
+/// Return the object recording the evaluations of thermodynamic models in the current thread (`nullptr` if none).
+auto profilingThermoModels() -> ThermoModelsProfiling*;
+
+/// Set the object recording the evaluations of thermodynamic models in the current thread (`nullptr` to stop recording).
+auto profilingThermoModels(ThermoModelsProfiling* profiling) -> void;
+
 #endif // REAKTORO_DISABLE_PROFILING
 
+/// Used to record the evaluations of thermodynamic models in the current thread during the lifetime of this object.
+class ThermoModelsProfilingScope
+{
+public:
+    /// Construct a ThermoModelsProfilingScope object that starts recording into @p profiling (nothing is recorded if `nullptr`).
+    explicit ThermoModelsProfilingScope(ThermoModelsProfiling* profiling)
+    : mprevious(profilingThermoModels())
+    {
+        profilingThermoModels(profiling);
+    }
+
+    /// Destroy this ThermoModelsProfilingScope object and restore the previous recording object of the current thread.
+    ~ThermoModelsProfilingScope()
+    {
+        profilingThermoModels(mprevious);
+    }
+
+    ThermoModelsProfilingScope(ThermoModelsProfilingScope const&) = delete;
+
+    auto operator=(ThermoModelsProfilingScope const&) -> ThermoModelsProfilingScope& = delete;
+
+private:
+    /// The object recording the evaluations of thermodynamic models in the current thread before this scope.
+    ThermoModelsProfiling* mprevious;
+};
+
 } // namespace Reaktoro
@@ -0,0 +1,212 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "ThreadPool.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace Reaktoro {
+namespace {
+
+/// Return the number of worker threads to be used in a thread pool.
+auto numWorkerThreads(Index numthreads) -> Index
+{
+    if(numthreads > 0)
+        return numthreads;
+    return std::max<Index>(std::thread::hardware_concurrency(), 1);
+}
+
+} // namespace
+
+struct ThreadPool::Impl
+{
+    /// The range of loop iterations currently owned by a worker thread.
+    struct Range
+    {
+        std::mutex mutex; ///< The mutex protecting the range against concurrent stealing.
+        Index begin = 0;  ///< The index of the next iteration to be executed in the range.
+        Index end = 0;    ///< The index past the last iteration in the range.
+    };
+
+    Deque<Range> ranges;                         ///< The ranges of loop iterations owned by each worker thread.
+    Vec<std::thread> threads;                    ///< The worker threads in the pool.
+    std::mutex mutex;                            ///< The mutex protecting the state of the pool below.
+    std::mutex running;                          ///< The mutex ensuring only one parallel loop is executed at a time.
+    std::condition_variable cv_start;            ///< The condition variable used to notify the worker threads of a new parallel loop.
+    std::condition_variable cv_done;             ///< The condition variable used to notify the end of a parallel loop.
+    Fn<void(Index, Index)> const* task = nullptr; ///< The function executing the iterations of the current parallel loop.
+    Index generation = 0;                        ///< The counter of parallel loops executed so far.
+    Index busy = 0;                              ///< The number of worker threads still executing the current parallel loop.
+    bool stopping = false;                       ///< The flag indicating that the worker threads should terminate.
+    std::exception_ptr exception;                ///< The first exception thrown in the current parallel loop.
+
+    /// Construct a ThreadPool::Impl object.
+    Impl(Index numthreads)
+    : ranges(numWorkerThreads(numthreads))
+    {
+        const auto size = ranges.size();
+        threads.reserve(size);
+        for(Index i = 0; i < size; ++i)
+            threads.emplace_back([this, i] { work(i); });
+    }
+
+    /// Destroy this ThreadPool::Impl object.
+    ~Impl()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        cv_start.notify_all();
+        for(auto& thread : threads)
+            thread.join();
+    }
+
+    /// The loop executed by each worker thread.
+    auto work(Index ithread) -> void
+    {
+        Index seen = 0;
+        while(true)
+        {
+            Fn<void(Index, Index)> const* fn = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv_start.wait(lock, [&] { return stopping || generation != seen; });
+                if(stopping)
+                    return;
+                seen = generation;
+                fn = task;
+            }
+
+            Index i = 0;
+            while(next(ithread, i))
+            {
+                try { (*fn)(ithread, i); }
+                catch(...)
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if(!exception)
+                        exception = std::current_exception();
+                }
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if(--busy == 0)
+                    cv_done.notify_one();
+            }
+        }
+    }
+
+    /// Fetch the next iteration to be executed by a worker thread, stealing from other threads if needed.
+    auto next(Index ithread, Index& i) -> bool
+    {
+        auto& own = ranges[ithread];
+
+        {
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if(own.begin < own.end)
+            {
+                i = own.begin++;
+                return true;
+            }
+        }
+
+        const auto size = ranges.size();
+
+        for(Index k = 1; k < size; ++k)
+        {
+            auto& victim = ranges[(ithread + k) % size];
+
+            Index begin = 0;
+            Index end = 0;
+
+            {
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                if(victim.begin >= victim.end)
+                    continue;
+                // The victim keeps [begin, mid) and the thief takes [mid, end)
+                begin = victim.begin + (victim.end - victim.begin)/2;
+                end = victim.end;
+                victim.end = begin;
+            }
+
+            std::lock_guard<std::mutex> lock(own.mutex);
+            own.begin = begin + 1;
+            own.end = end;
+            i = begin;
+            return true;
+        }
+
+        return false;
+    }
+
+    /// Execute a parallel loop.
+    auto parallelFor(Index n, Fn<void(Index, Index)> const& fn) -> void
+    {
+        if(n == 0)
+            return;
+
+        std::lock_guard<std::mutex> guard(running);
+
+        const auto size = ranges.size();
+
+        for(Index k = 0; k < size; ++k)
+        {
+            std::lock_guard<std::mutex> lock(ranges[k].mutex);
+            ranges[k].begin = n * k / size;
+            ranges[k].end = n * (k + 1) / size;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        task = &fn;
+        exception = nullptr;
+        busy = size;
+        ++generation;
+        cv_start.notify_all();
+        cv_done.wait(lock, [&] { return busy == 0; });
+        task = nullptr;
+
+        if(exception)
+            std::rethrow_exception(exception);
+    }
+};
+
+ThreadPool::ThreadPool(Index numthreads)
+: pimpl(new Impl(numthreads))
+{}
+
+ThreadPool::~ThreadPool()
+{}
+
+auto ThreadPool::size() const -> Index
+{
+    return pimpl->threads.size();
+}
+
+auto ThreadPool::parallelFor(Index n, Fn<void(Index, Index)> const& fn) -> void
+{
+    pimpl->parallelFor(n, fn);
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,65 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// Used to execute parallel loops on a fixed set of worker threads with work stealing.
+/// The iterations of a parallel loop are initially split into contiguous
+/// ranges, one per worker thread. A worker thread that exhausts its own range
+/// steals half of the remaining iterations of another worker thread. This
+/// balances uneven workloads among the threads (e.g., chemical equilibrium
+/// calculations that require very different numbers of iterations).
+class ThreadPool
+{
+public:
+    /// Construct a ThreadPool object with given number of worker threads.
+    /// @param numthreads The number of worker threads (zero means the number of hardware threads)
+    explicit ThreadPool(Index numthreads = 0);
+
+    /// Disable copy construction of ThreadPool objects.
+    ThreadPool(ThreadPool const& other) = delete;
+
+    /// Destroy this ThreadPool object after all its worker threads have finished.
+    ~ThreadPool();
+
+    /// Disable copy assignment of ThreadPool objects.
+    auto operator=(ThreadPool const& other) -> ThreadPool& = delete;
+
+    /// Return the number of worker threads in the pool.
+    auto size() const -> Index;
+
+    /// Execute `fn(ithread, i)` for every `i` in `[0, n)` using the worker threads in the pool.
+    /// This method blocks until all iterations have been executed. If `fn`
+    /// throws an exception in any worker thread, the first one caught is
+    /// rethrown here once the remaining iterations have been executed.
+    /// @param n The number of iterations in the parallel loop
+    /// @param fn The function that executes the `i`-th iteration in the worker thread with index `ithread`
+    auto parallelFor(Index n, Fn<void(Index, Index)> const& fn) -> void;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
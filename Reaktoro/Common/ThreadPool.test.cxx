@@ -0,0 +1,68 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <atomic>
+#include <stdexcept>
+
+// Reaktoro includes
+#include <Reaktoro/Common/ThreadPool.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing ThreadPool", "[ThreadPool]")
+{
+    for(auto numthreads : { 1, 2, 3, 8 })
+    {
+        ThreadPool pool(numthreads);
+
+        CHECK( pool.size() == numthreads );
+
+        DYNAMIC_SECTION("When all iterations are executed exactly once with " << numthreads << " threads")
+        {
+            const auto n = 1000;
+            Vec<int> counts(n, 0);
+            Vec<Index> threads(n, 0);
+
+            pool.parallelFor(n, [&](Index ithread, Index i) { counts[i] += 1; threads[i] = ithread; });
+
+            for(auto i = 0; i < n; ++i)
+            {
+                CHECK( counts[i] == 1 );
+                CHECK( threads[i] < numthreads );
+            }
+        }
+
+        DYNAMIC_SECTION("When the pool is reused for several parallel loops of different sizes with " << numthreads << " threads")
+        {
+            std::atomic<Index> sum = 0;
+            for(auto n : { 0, 1, 5, 100 })
+                pool.parallelFor(n, [&](Index ithread, Index i) { sum += i; });
+            CHECK( sum == 0 + 0 + 10 + 4950 );
+        }
+
+        DYNAMIC_SECTION("When an exception is thrown in one of the iterations with " << numthreads << " threads")
+        {
+            std::atomic<Index> count = 0;
+            auto fn = [&](Index ithread, Index i) { count += 1; if(i == 17) throw std::runtime_error("failure"); };
+            CHECK_THROWS( pool.parallelFor(50, fn) );
+            CHECK( count == 50 );
+        }
+    }
+}
@@ -27,8 +27,22 @@ auto chain(Vec<ActivityModelGenerator> const& models) -> ActivityModelGenerator
 
         ActivityModel chained_activity_model = [=](ActivityPropsRef props, ActivityModelArgs args)
         {
+            if(props.jacobian == nullptr)
+            {
+                for(const auto& fn : activity_models)
+                    fn(props, args);
+                return;
+            }
+
+            // The analytic derivatives of the chained model are available only if every model in the chain provides them
+            auto available = true;
             for(const auto& fn : activity_models)
+            {
+                props.jacobian->available = false;
                 fn(props, args);
+                available = available && props.jacobian->available;
+            }
+            props.jacobian->available = available;
         };
 
         return chained_activity_model;
@@ -53,6 +53,9 @@ using ActivityModel = Model<ActivityProps(ActivityModelArgs)>;
 using ActivityModelGenerator = Fn<ActivityModel(SpeciesList const& species)>;
 
 /// Return an activity model resulting from chaining other activity models.
+/// Analytic derivatives requested via ActivityPropsBase::jacobian are
+/// reported as available by the chained model only if every model in the
+/// chain computes them.
 auto chain(const Vec<ActivityModelGenerator>& models) -> ActivityModelGenerator;
 
 /// Return an activity model resulting from chaining other activity models.
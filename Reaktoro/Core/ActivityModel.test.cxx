@@ -0,0 +1,173 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ActivityModel.hpp>
+using namespace Reaktoro;
+
+namespace test {
+
+/// Check the analytic derivatives computed by an activity model against those computed with automatic differentiation.
+auto checkActivityJacobian(ActivityModel const& fn, real const& T, real const& P, ArrayXrConstRef x, bool checkTP) -> void
+{
+    const auto N = x.size();
+
+    ActivityJacobian jacobian;
+    ActivityProps props = ActivityProps::create(N);
+    props.jacobian = &jacobian;
+    fn(props, {T, P, x});
+
+    REQUIRE( jacobian.available );
+
+    ActivityProps aux = ActivityProps::create(N);
+
+    MatrixXd ln_g_x(N, N);
+    MatrixXd ln_a_x(N, N);
+
+    ArrayXr xs = x;
+    for(auto j = 0; j < N; ++j)
+    {
+        autodiff::seed(xs[j]);
+        fn(aux, {T, P, xs});
+        autodiff::unseed(xs[j]);
+        for(auto i = 0; i < N; ++i)
+        {
+            ln_g_x(i, j) = grad(aux.ln_g[i]);
+            ln_a_x(i, j) = grad(aux.ln_a[i]);
+        }
+    }
+
+    // Only derivatives along directions preserving the sum of mole fractions are compared (see ActivityJacobian)
+    const VectorXd xd = x.matrix().cast<double>();
+    auto project = [&](MatrixXd J) -> MatrixXd
+    {
+        const VectorXd Jx = J * xd;
+        J.colwise() -= Jx;
+        return J;
+    };
+
+    INFO("ln_g_x(analytic) = \n" << jacobian.ln_g_x);
+    INFO("ln_g_x(autodiff) = \n" << ln_g_x);
+    CHECK( project(jacobian.ln_g_x).isApprox(project(ln_g_x), 1e-8) );
+
+    INFO("ln_a_x(analytic) = \n" << jacobian.ln_a_x);
+    INFO("ln_a_x(autodiff) = \n" << ln_a_x);
+    CHECK( project(jacobian.ln_a_x).isApprox(project(ln_a_x), 1e-8) );
+
+    if(!checkTP)
+        return;
+
+    real Ts = T;
+    real Ps = P;
+    ArrayXd ln_g_T(N), ln_a_T(N), ln_g_P(N), ln_a_P(N);
+
+    autodiff::seed(Ts);
+    fn(aux, {Ts, Ps, x});
+    autodiff::unseed(Ts);
+    for(auto i = 0; i < N; ++i)
+    {
+        ln_g_T[i] = grad(aux.ln_g[i]);
+        ln_a_T[i] = grad(aux.ln_a[i]);
+    }
+
+    autodiff::seed(Ps);
+    fn(aux, {Ts, Ps, x});
+    autodiff::unseed(Ps);
+    for(auto i = 0; i < N; ++i)
+    {
+        ln_g_P[i] = grad(aux.ln_g[i]);
+        ln_a_P[i] = grad(aux.ln_a[i]);
+    }
+
+    REQUIRE( jacobian.ln_g_T.size() == N );
+    REQUIRE( jacobian.ln_g_P.size() == N );
+    REQUIRE( jacobian.ln_a_T.size() == N );
+    REQUIRE( jacobian.ln_a_P.size() == N );
+
+    CHECK( jacobian.ln_g_T.isApprox(ln_g_T, 1e-8) );
+    CHECK( jacobian.ln_g_P.isApprox(ln_g_P, 1e-8) );
+    CHECK( jacobian.ln_a_T.isApprox(ln_a_T, 1e-8) );
+    CHECK( jacobian.ln_a_P.isApprox(ln_a_P, 1e-8) );
+}
+
+} // namespace test
+
+TEST_CASE("Testing ActivityModel chaining with analytic derivatives", "[ActivityModel]")
+{
+    const auto species = SpeciesList("H2O CO2");
+
+    const auto T = 300.0;
+    const auto P = 1.0e5;
+    const ArrayXr x = ArrayXr{{0.9, 0.1}};
+
+    // An activity model that provides analytic derivatives
+    ActivityModelGenerator modelA = [](SpeciesList const& species) -> ActivityModel
+    {
+        return [](ActivityPropsRef props, ActivityModelArgs args)
+        {
+            props.ln_g = 0.0;
+            props.ln_a = args.x.log();
+            if(props.jacobian == nullptr)
+                return;
+            props.jacobian->initialize(args.x.size());
+            props.jacobian->ln_a_x.diagonal() = 1.0/args.x.cast<double>();
+            props.jacobian->available = true;
+        };
+    };
+
+    // An activity model that does not provide analytic derivatives
+    ActivityModelGenerator modelB = [](SpeciesList const& species) -> ActivityModel
+    {
+        return [](ActivityPropsRef props, ActivityModelArgs args)
+        {
+            props.ln_g[1] = 0.1 * args.x[1];
+            props.ln_a[1] = props.ln_g[1] + log(args.x[1]);
+        };
+    };
+
+    ActivityJacobian jacobian;
+    ActivityProps props = ActivityProps::create(species.size());
+    props.jacobian = &jacobian;
+
+    SECTION("When every chained model provides analytic derivatives")
+    {
+        ActivityModel fn = chain(modelA, modelA)(species);
+        fn(props, {T, P, x});
+        CHECK( jacobian.available );
+        test::checkActivityJacobian(fn, T, P, x, false);
+    }
+
+    SECTION("When a chained model does not provide analytic derivatives")
+    {
+        ActivityModel fn = chain(modelA, modelB)(species);
+        fn(props, {T, P, x});
+        CHECK_FALSE( jacobian.available );
+    }
+
+    SECTION("When analytic derivatives are not requested")
+    {
+        props.jacobian = nullptr;
+        ActivityModel fn = chain(modelA, modelB)(species);
+        fn(props, {T, P, x});
+        CHECK_FALSE( jacobian.available );
+        CHECK( double(props.ln_a[0]) == Approx(std::log(0.9)) );
+    }
+}
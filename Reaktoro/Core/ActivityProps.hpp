@@ -29,6 +29,62 @@
 
 namespace Reaktoro {
 
+/// The analytic derivatives of the activity coefficients and activities of the species in a phase.
+/// Activity models that support analytic derivatives compute these whenever
+/// an ActivityJacobian object is attached to ActivityPropsBase::jacobian before
+/// their evaluation, and then set #available to true. Activity models that do
+/// not support them leave #available unchanged, in which case the derivatives
+/// must be computed with automatic differentiation instead. An activity model
+/// chained after another must update the derivatives computed by the previous
+/// one if it supports them (see @ref chain).
+///
+/// The derivatives with respect to temperature and pressure are optional.
+/// The aqueous activity models (e.g., Davies, Debye-Hückel, HKF) do not
+/// compute them, since only the derivatives with respect to mole fractions
+/// are currently used (see EquilibriumProps::dudnPhase).
+///
+/// The derivatives with respect to mole fractions are computed as if these
+/// were independent variables. Only their combinations along directions that
+/// preserve the sum of mole fractions are meaningful. Thus, the derivatives
+/// with respect to the amounts of the species in the phase must be computed
+/// with:
+///
+/// @eqc{\frac{\partial\ln a_{i}}{\partial n_{j}}=\frac{1}{n_{\Sigma}}\left(\frac{\partial\ln a_{i}}{\partial x_{j}}-\sum_{k}x_{k}\frac{\partial\ln a_{i}}{\partial x_{k}}\right).}
+struct ActivityJacobian
+{
+    /// The flag indicating if the derivatives below were computed by the activity model.
+    bool available = false;
+
+    /// The derivatives of the activity coefficients (natural log) of the species with respect to their mole fractions at constant temperature and pressure.
+    MatrixXd ln_g_x;
+
+    /// The derivatives of the activities (natural log) of the species with respect to their mole fractions at constant temperature and pressure.
+    MatrixXd ln_a_x;
+
+    /// The derivatives of the activity coefficients (natural log) of the species with respect to temperature at constant pressure and mole fractions (in 1/K), or empty if not computed by the activity model.
+    ArrayXd ln_g_T;
+
+    /// The derivatives of the activity coefficients (natural log) of the species with respect to pressure at constant temperature and mole fractions (in 1/Pa), or empty if not computed by the activity model.
+    ArrayXd ln_g_P;
+
+    /// The derivatives of the activities (natural log) of the species with respect to temperature at constant pressure and mole fractions (in 1/K), or empty if not computed by the activity model.
+    ArrayXd ln_a_T;
+
+    /// The derivatives of the activities (natural log) of the species with respect to pressure at constant temperature and mole fractions (in 1/Pa), or empty if not computed by the activity model.
+    ArrayXd ln_a_P;
+
+    /// Initialize the derivatives with respect to mole fractions with zeros and clear those with respect to temperature and pressure.
+    auto initialize(Index numspecies) -> void
+    {
+        ln_g_x.setZero(numspecies, numspecies);
+        ln_a_x.setZero(numspecies, numspecies);
+        ln_g_T.resize(0);
+        ln_g_P.resize(0);
+        ln_a_T.resize(0);
+        ln_a_P.resize(0);
+    }
+};
+
 /// The base type for the primary activity and corrective thermodynamic
 /// properties of a phase. Thermodynamic properties for a phase, such as
 /// internal energy, enthalpy, Gibbs energy, entropy, and volume can be broken
@@ -90,6 +146,9 @@ struct ActivityPropsBase
     /// The extra data produced by an activity model that may be reused by subsequent models within a chained activity model.
     TypeOp<Map<String, Any>> extra;
 
+    /// The optional analytic derivatives of the activity coefficients and activities requested from the activity model (not owned, `nullptr` if not requested).
+    ActivityJacobian* jacobian = nullptr;
+
     /// Assign a common value to all properties in this ActivityPropsBase object.
     auto operator=(real value) -> ActivityPropsBase&
     {
@@ -105,6 +164,7 @@ struct ActivityPropsBase
     }
 
     /// Convert this ActivityPropsBase object into another.
+    /// @note The request for analytic derivatives in #jacobian is not assigned.
     template<template<typename> typename OtherTypeOp>
     auto operator=(const ActivityPropsBase<OtherTypeOp>& other) -> ActivityPropsBase&
     {
@@ -126,14 +186,14 @@ struct ActivityPropsBase
     template<template<typename> typename OtherTypeOp>
     operator ActivityPropsBase<OtherTypeOp>()
     {
-        return { Vx, VxT, VxP, Vxi, Gx, Hx, Cpx, ln_g, ln_a, som, extra };
+        return { Vx, VxT, VxP, Vxi, Gx, Hx, Cpx, ln_g, ln_a, som, extra, jacobian };
     }
 
     /// Convert this ActivityPropsBase object into another.
     template<template<typename> typename OtherTypeOp>
     operator ActivityPropsBase<OtherTypeOp>() const
     {
-        return { Vx, VxT, VxP, Vxi, Gx, Hx, Cpx, ln_g, ln_a, som, extra };
+        return { Vx, VxT, VxP, Vxi, Gx, Hx, Cpx, ln_g, ln_a, som, extra, jacobian };
     }
 
     /// Create a ActivityPropsBase object with given number of species.
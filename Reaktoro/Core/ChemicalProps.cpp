@@ -27,11 +27,45 @@ using namespace tabulate;
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Enumerate.hpp>
+#include <Reaktoro/Common/TraitsUtils.hpp>
 #include <Reaktoro/Core/ChemicalPropsPhase.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/Utils.hpp>
 
 namespace Reaktoro {
+namespace {
+
+/// Write the derivatives of given real numbers and arrays of real numbers into @p du, one after the other.
+template<typename... Args>
+auto gatherGradInto(VectorXdRef du, Args const&... args) -> void
+{
+    Index offset = 0;
+    auto gather = [&](auto const& arg)
+    {
+        if constexpr(isSame<decltype(arg), real>)
+            du[offset++] = grad(arg);
+        else for(auto i = 0; i < arg.size(); ++i)
+            du[offset++] = grad(arg[i]);
+    };
+    (gather(args), ...);
+    assert(offset == du.size());
+}
+
+/// Zero out the derivatives of given real numbers and arrays of real numbers.
+template<typename... Args>
+auto unseedAll(Args&... args) -> void
+{
+    auto unseed = [](auto& arg)
+    {
+        if constexpr(isSame<decltype(arg), real>)
+            autodiff::unseed(arg);
+        else for(auto i = 0; i < arg.size(); ++i)
+            autodiff::unseed(arg[i]);
+    };
+    (unseed(args), ...);
+}
+
+} // namespace
 
 ChemicalProps::ChemicalProps()
 {}
@@ -165,6 +199,17 @@ auto ChemicalProps::deserialize(const ArrayStream<double>& stream) -> void
     stream.to(T, P, n, Ts, Ps, nsum, msum, x, G0, H0, V0, VT0, VP0, Cp0, Vx, VxT, VxP, Vxi, Gx, Hx, Cpx, ln_g, ln_a, u);
 }
 
+auto ChemicalProps::gatherGrad(VectorXdRef du) const -> void
+{
+    gatherGradInto(du, T, P, n, Ts, Ps, nsum, msum, x, G0, H0, V0, VT0, VP0, Cp0, Vx, VxT, VxP, Vxi, Gx, Hx, Cpx, ln_g, ln_a, u);
+}
+
+auto ChemicalProps::clearSeeds() -> void
+{
+    mstateid += 1;
+    unseedAll(T, P, n, Ts, Ps, nsum, msum, x, G0, H0, V0, VT0, VP0, Cp0, Vx, VxT, VxP, Vxi, Gx, Hx, Cpx, ln_g, ln_a, u);
+}
+
 auto ChemicalProps::stateid() const -> Index
 {
     return mstateid;
@@ -86,6 +86,16 @@ public:
     /// @param stream The array stream containing the serialized chemical properties.
     auto deserialize(const ArrayStream<double>& stream) -> void;
 
+    /// Collect the derivatives of the chemical properties with respect to the currently seeded variable.
+    /// The derivatives are written directly into @p du, without any
+    /// intermediate allocation, in the same order in which the chemical
+    /// properties are serialized with @ref serialize.
+    /// @param[out] du The vector of derivatives with size equal to that of the serialized chemical properties.
+    auto gatherGrad(VectorXdRef du) const -> void;
+
+    /// Clear the derivative information of the chemical properties (i.e., the autodiff seeds) without changing their values.
+    auto clearSeeds() -> void;
+
     /// Return the state identification number of this ChemicalProps object.
     /// Each time this ChemicalProps object is updated, its state identification
     /// number (`stateid`) is incremented. This is useful for memorizing
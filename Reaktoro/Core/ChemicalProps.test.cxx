@@ -704,4 +704,46 @@ TEST_CASE("Testing ChemicalProps class", "[ChemicalProps]")
         props.deserialize(dstream);
         CHECK(props.stateid() == 9);
     }
+
+    SECTION("Testing gathering and clearing of derivatives with respect to a seeded variable")
+    {
+        real T = 345.6;
+        real P = 1.234e5;
+        ArrayXr n = ArrayXr::Constant(3, 0.1234);
+
+        autodiff::seed(T);
+        props.update(T, P, n);
+        autodiff::unseed(T);
+
+        ArrayStream<real> stream;
+        props.serialize(stream);
+
+        const auto Nu = stream.data().size();
+
+        VectorXd du_expected(Nu);
+        for(auto i = 0; i < Nu; ++i)
+            du_expected[i] = grad(stream.data()[i]);
+
+        VectorXd du(Nu);
+        props.gatherGrad(du);
+
+        CHECK( du_expected.norm() > 0.0 );
+        CHECK( du == du_expected );
+
+        const auto stateid = props.stateid();
+
+        props.clearSeeds();
+
+        CHECK( props.stateid() == stateid + 1 );
+
+        props.gatherGrad(du);
+
+        CHECK( du.isZero() );
+
+        ArrayStream<real> cleared;
+        props.serialize(cleared);
+
+        for(auto i = 0; i < Nu; ++i)
+            CHECK( cleared.data()[i] == stream.data()[i] ); // values unchanged, only derivatives cleared
+    }
 }
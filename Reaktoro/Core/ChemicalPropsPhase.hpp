@@ -20,6 +20,7 @@
 // Reaktoro includes
 #include <Reaktoro/Common/ArrayStream.hpp>
 #include <Reaktoro/Common/Constants.hpp>
+#include <Reaktoro/Common/Profiling.hpp>
 #include <Reaktoro/Common/TypeOp.hpp>
 #include <Reaktoro/Core/Phase.hpp>
 #include <Reaktoro/Core/StateOfMatter.hpp>
@@ -702,8 +703,12 @@ private:
         assert(    u.size() == N );
         assert(   Vxi.size() == N );
 
+        // The object recording the evaluations of thermodynamic models in the current thread (if any)
+        [[maybe_unused]] auto* profiling = profilingThermoModels();
+
         // Compute the standard thermodynamic properties of the species in the phase.
         StandardThermoProps aux;
+        profileit(profiling, standard_thermo,
         for(auto i = 0; i < N; ++i)
         {
             aux = species[i].standardThermoProps(T, P);
@@ -713,7 +718,7 @@ private:
             VT0[i] = aux.VT0;
             VP0[i] = aux.VP0;
             Cp0[i] = aux.Cp0;
-        }
+        })
 
         // Compute the amount of the phase
         nsum = n.sum();
@@ -737,7 +742,7 @@ private:
             phase().idealActivityModel() : phase().activityModel();
 
         if(nsum == 0.0) aprops = 0.0;
-        else activity_model(aprops, args);
+        else profileit(profiling, activity, activity_model(aprops, args))
 
         // Compute the chemical potentials of the species
         u = G0 + R*T*ln_a;
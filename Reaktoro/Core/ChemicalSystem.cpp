@@ -176,6 +176,29 @@ ChemicalSystem::ChemicalSystem(Phases const& phases, Reactions const& reactions,
 : pimpl(new Impl(phases.database(), phases.convert(), reactions, surfaces))
 {}
 
+auto ChemicalSystem::clone() const -> ChemicalSystem
+{
+    ChemicalSystem copy;
+    *copy.pimpl = *pimpl;
+    copy.pimpl->id = detail::computeChemicalSystemID();
+
+    for(auto& phase : copy.pimpl->phases)
+    {
+        SpeciesList species = vectorize(phase.species(), RKT_LAMBDA(x, x.clone()));
+        phase = phase.withSpecies(species);
+    }
+
+    copy.pimpl->species = copy.pimpl->phases.species();
+
+    for(auto& reaction : copy.pimpl->reactions)
+        reaction = reaction.clone();
+
+    for(auto& surface : copy.pimpl->surfaces)
+        surface = surface.clone();
+
+    return copy;
+}
+
 auto ChemicalSystem::id() const -> Index
 {
     return pimpl->id;
@@ -101,6 +101,14 @@ public:
     explicit ChemicalSystem(Database const& db, Args const&... args)
     : ChemicalSystem(createChemicalSystem(db, args...)) {}
 
+    /// Return a deep copy of this ChemicalSystem object.
+    /// The phases, species, reactions, and surfaces of the returned system do
+    /// not share their underlying data (e.g., memoized thermodynamic and
+    /// activity models) with those in this system. The returned system has a
+    /// new unique identification number. This is needed, for example, when
+    /// the same chemical system is used concurrently in multiple threads.
+    auto clone() const -> ChemicalSystem;
+
     /// Return the unique identification number of this ChemicalSystem object.
     /// ChemicalSystem objects are guaranteed to be the same if they have the same id.
     auto id() const -> Index;
@@ -310,4 +310,31 @@ TEST_CASE("Testing ChemicalSystem class", "[ChemicalSystem]")
     CHECK( system.species().size() == 14 );
     CHECK( system.phases().size() == 6 );
     CHECK( system.reactions().size() == 4 );
+
+    //-------------------------------------------------------------------------
+    // TESTING METHOD: ChemicalSystem::clone()
+    //-------------------------------------------------------------------------
+    ChemicalSystem clone = system.clone();
+
+    CHECK( clone.id() != system.id() );
+    CHECK( clone.elements().size() == system.elements().size() );
+    CHECK( clone.species().size() == system.species().size() );
+    CHECK( clone.phases().size() == system.phases().size() );
+    CHECK( clone.reactions().size() == system.reactions().size() );
+    CHECK( clone.formulaMatrix() == system.formulaMatrix() );
+
+    for(auto i = 0; i < system.species().size(); ++i)
+    {
+        CHECK( clone.species(i).name() == system.species(i).name() );
+        CHECK( &clone.species(i).standardThermoModel() != &system.species(i).standardThermoModel() ); // the underlying data of the species are not shared
+        const auto iphase = clone.phases().findWithSpecies(i);
+        const auto offset = clone.phases().numSpeciesUntilPhase(iphase);
+        CHECK( &clone.phase(iphase).species(i - offset).standardThermoModel() == &clone.species(i).standardThermoModel() ); // species in the phases and in the system share the same underlying data
+    }
+
+    for(auto i = 0; i < system.phases().size(); ++i)
+    {
+        CHECK( clone.phase(i).name() == system.phase(i).name() );
+        CHECK( &clone.phase(i).activityModel() != &system.phase(i).activityModel() ); // the underlying data of the phases are not shared
+    }
 }
@@ -36,6 +36,20 @@ auto ensureCommonAggregateState(const SpeciesList& species)
             "aggregate state ", aggregatestate, " while ", s.name(), " has aggregate state ", s.aggregateState(), ".");
 }
 
+/// Return a memoized version of an activity model that bypasses its cache when analytic derivatives are requested.
+/// The cached results of the memoized model contain no analytic derivatives,
+/// which are instead computed only when attached via ActivityPropsBase::jacobian.
+auto memoizeActivityModel(const ActivityModel& model) -> ActivityModel
+{
+    const auto memoized = model.withMemoization();
+    const ModelEvaluator<ActivityPropsRef, ActivityModelArgs> evalfn = [=](ActivityPropsRef props, ActivityModelArgs args)
+    {
+        if(props.jacobian) model.apply(props, args);
+        else memoized.apply(props, args);
+    };
+    return ActivityModel(evalfn, model.params());
+}
+
 } // namespace detail
 
 struct Phase::Impl
@@ -58,6 +72,12 @@ struct Phase::Impl
     /// The ideal activity model function of the phase.
     ActivityModel ideal_activity_model;
 
+    /// The activity model function of the phase without memoization (memoized anew in each clone of the phase so that clones do not share cached results).
+    ActivityModel activity_model_unmemoized;
+
+    /// The ideal activity model function of the phase without memoization (memoized anew in each clone of the phase so that clones do not share cached results).
+    ActivityModel ideal_activity_model_unmemoized;
+
     /// The molar masses of the species in the phase.
     ArrayXd species_molar_masses;
 };
@@ -70,6 +90,10 @@ auto Phase::clone() const -> Phase
 {
     Phase phase;
     *phase.pimpl = *pimpl;
+    if(pimpl->activity_model_unmemoized)
+        phase.pimpl->activity_model = detail::memoizeActivityModel(pimpl->activity_model_unmemoized);
+    if(pimpl->ideal_activity_model_unmemoized)
+        phase.pimpl->ideal_activity_model = detail::memoizeActivityModel(pimpl->ideal_activity_model_unmemoized);
     return phase;
 }
 
@@ -100,14 +124,16 @@ auto Phase::withStateOfMatter(StateOfMatter state) -> Phase
 auto Phase::withActivityModel(const ActivityModel& model) -> Phase
 {
     Phase copy = clone();
-    copy.pimpl->activity_model = model.withMemoization();
+    copy.pimpl->activity_model_unmemoized = model;
+    copy.pimpl->activity_model = detail::memoizeActivityModel(model);
     return copy;
 }
 
 auto Phase::withIdealActivityModel(const ActivityModel& model) -> Phase
 {
     Phase copy = clone();
-    copy.pimpl->ideal_activity_model = model.withMemoization();
+    copy.pimpl->ideal_activity_model_unmemoized = model;
+    copy.pimpl->ideal_activity_model = detail::memoizeActivityModel(model);
     return copy;
 }
 
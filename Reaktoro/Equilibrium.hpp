@@ -30,6 +30,7 @@
 #include <Reaktoro/Equilibrium/SmartEquilibriumOptions.hpp>
 #include <Reaktoro/Equilibrium/SmartEquilibriumResult.hpp>
 #include <Reaktoro/Equilibrium/SmartEquilibriumSolver.hpp>
+#include <Reaktoro/Equilibrium/SmartEquilibriumStatistics.hpp>
 
 /// @defgroup Equilibrium Equilibrium
 /// The module in Reaktoro in which classes and methods for chemical equilibrium calculations are implemented.
@@ -30,6 +30,7 @@ void exportEquilibriumUtils(py::module& m);
 void exportSmartEquilibriumOptions(py::module& m);
 void exportSmartEquilibriumResult(py::module& m);
 void exportSmartEquilibriumSolver(py::module& m);
+void exportSmartEquilibriumStatistics(py::module& m);
 
 void exportEquilibrium(py::module& m)
 {
@@ -45,4 +46,5 @@ void exportEquilibrium(py::module& m)
     exportSmartEquilibriumOptions(m);
     exportSmartEquilibriumResult(m);
     exportSmartEquilibriumSolver(m);
+    exportSmartEquilibriumStatistics(m);
 }
@@ -20,14 +20,28 @@
 // Reaktoro includes
 #include <Reaktoro/Common/MolalityUtils.hpp>
 #include <Reaktoro/Common/MoleFractionUtils.hpp>
+#include <Reaktoro/Core/ActivityProps.hpp>
 #include <Reaktoro/Core/ChemicalProps.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 
 namespace Reaktoro {
 
-using autodiff::jacobian;
-using autodiff::wrt;
-using autodiff::at;
+auto EquilibriumHessianBlocks::isDiagonal() const -> bool
+{
+    return blocks.empty();
+}
+
+auto EquilibriumHessianBlocks::assemble(MatrixXdRef H) const -> void
+{
+    for(auto i = 0; i < blocks.size(); ++i)
+    {
+        const auto offset = offsets[i];
+        const auto length = blocks[i].rows();
+        H.block(offset, offset, length, length) = blocks[i];
+    }
+    for(auto i = 0; i < ipps.size(); ++i)
+        H(ipps[i], ipps[i]) = diagonal[i];
+}
 
 struct EquilibriumHessian::Impl
 {
@@ -37,9 +51,15 @@ struct EquilibriumHessian::Impl
     /// The chemical properties of the system.
     ChemicalProps props;
 
+    /// The diagonal blocks of ∂(µ/RT)/∂n.
+    EquilibriumHessianBlocks hblocks;
+
     /// The auxiliary matrix for ∂(µ/RT)/∂n.
     MatrixXd dudn;
 
+    /// The flag indicating if `dudn` may have non-zero entries outside the diagonal blocks of the phases (after a call to @ref exact).
+    bool dudn_offblock_dirty = false;
+
     /// The auxiliary vector to compute the diagonal of ∂(µ/RT)/∂n.
     VectorXd dudn_diag;
 
@@ -52,6 +72,27 @@ struct EquilibriumHessian::Impl
     /// The functions for each phase that assemble the diagonal of approximate derivatives in ∂(µ/RT)/∂n.
     Vec<Fn<void(VectorXrConstRef, VectorXdRef)>> approxfuncsdiag;
 
+    /// The index of the first species in each phase.
+    Indices offsets;
+
+    /// The number of species in each phase.
+    Indices lengths;
+
+    /// The index of each phase in `hblocks.blocks` (if it has more than one species) or of its species in `hblocks.ipps` (otherwise).
+    Indices ientries;
+
+    /// The index of the phase containing each species.
+    Indices iphase;
+
+    /// The auxiliary activity properties of each phase used to evaluate their activity models with analytic derivatives.
+    Vec<ActivityProps> aprops;
+
+    /// The analytic derivatives of the activities of the species in each phase.
+    Vec<ActivityJacobian> jacobians;
+
+    /// The auxiliary indices of the phases whose derivatives in ∂(µ/RT)/∂n are computed with automatic differentiation.
+    Indices iautodiff;
+
     ///
     Impl(ChemicalSystem const& system)
     : system(system), props(system)
@@ -59,13 +100,44 @@ struct EquilibriumHessian::Impl
         const auto numphases = system.phases().size();
         const auto numspecies = system.species().size();
 
-        dudn.resize(numspecies, numspecies);
+        dudn = MatrixXd::Zero(numspecies, numspecies);
         dudn_diag.resize(numspecies);
 
         approxfuncs.resize(numphases);
         approxfuncsdiag.resize(numphases);
 
-        auto iphase = 0;
+        offsets.resize(numphases);
+        lengths.resize(numphases);
+        ientries.resize(numphases);
+        iphase.resize(numspecies);
+        aprops.resize(numphases);
+        jacobians.resize(numphases);
+        iautodiff.reserve(numphases);
+
+        auto offset = 0;
+        for(auto iphase = 0; iphase < numphases; ++iphase)
+        {
+            const auto length = system.phase(iphase).species().size();
+            offsets[iphase] = offset;
+            lengths[iphase] = length;
+            aprops[iphase] = ActivityProps::create(length);
+            std::fill_n(this->iphase.begin() + offset, length, iphase);
+            if(length == 1)
+            {
+                ientries[iphase] = hblocks.ipps.size();
+                hblocks.ipps.push_back(offset);
+            }
+            else
+            {
+                ientries[iphase] = hblocks.blocks.size();
+                hblocks.iphases.push_back(iphase);
+                hblocks.offsets.push_back(offset);
+                hblocks.blocks.push_back(MatrixXd::Zero(length, length));
+            }
+            offset += length;
+        }
+
+        hblocks.diagonal = VectorXd::Zero(hblocks.ipps.size());
 
         for(auto iphase = 0; iphase < numphases; ++iphase)
         {
@@ -107,20 +179,158 @@ struct EquilibriumHessian::Impl
         }
     }
 
-    auto exact(real const& T, real const& P, VectorXrConstRef const& nconst) -> MatrixXdConstRef
+    auto exactBlocks(real const& T, real const& P, VectorXrConstRef const& nconst) -> EquilibriumHessianBlocks const&
     {
         n = nconst;
-        auto fn = [&](VectorXrConstRef const& n) -> VectorXr
+
+        // The chemical potential of a species in a single-species phase does not depend on its amount
+        hblocks.diagonal.fill(0.0);
+
+        // Compute the diagonal blocks of phases whose activity models provide analytic derivatives
+        iautodiff.clear();
+        for(auto k : hblocks.iphases)
         {
+            const auto offset = offsets[k];
+            const auto length = lengths[k];
+
+            const auto np = n.segment(offset, length);
+            const auto nsum = np.sum();
+            if(nsum == 0.0)
+            {
+                iautodiff.push_back(k);
+                continue;
+            }
+
+            const ArrayXr x = np.array()/nsum;
+
+            auto& jac = jacobians[k];
+            jac.available = false;
+            aprops[k].jacobian = &jac;
+            system.phase(k).activityModel()(aprops[k], { T, P, x });
+            aprops[k].jacobian = nullptr;
+
+            if(!jac.available)
+            {
+                iautodiff.push_back(k);
+                continue;
+            }
+
+            // Convert the derivatives with respect to mole fractions into derivatives with respect to species amounts
+            auto& block = hblocks.blocks[ientries[k]];
+            const VectorXd xd = x.matrix().cast<double>();
+            block.noalias() = jac.ln_a_x;
+            block.colwise() -= jac.ln_a_x * xd;
+            block /= double(nsum);
+        }
+
+        if(iautodiff.empty())
+            return hblocks;
+
+        // Compute the diagonal blocks of the remaining phases with automatic differentiation, seeding one species per phase at once
+        Index maxlength = 0;
+        for(auto k : iautodiff)
+            maxlength = std::max<Index>(maxlength, lengths[k]);
+
+        const double RT = universalGasConstant * T;
+
+        for(Index j = 0; j < maxlength; ++j)
+        {
+            for(auto k : iautodiff)
+                if(j < lengths[k])
+                    autodiff::seed(n[offsets[k] + j]);
+
             props.update(T, P, n);
-            return props.speciesChemicalPotentials();
-        };
+            auto const& u = props.speciesChemicalPotentials();
+
+            for(auto k : iautodiff)
+            {
+                const auto offset = offsets[k];
+                const auto length = lengths[k];
+                auto& block = hblocks.blocks[ientries[k]];
+                if(j < length)
+                    for(Index i = 0; i < length; ++i)
+                        block(i, j) = grad(u[offset + i])/RT;
+            }
+
+            for(auto k : iautodiff)
+                if(j < lengths[k])
+                    autodiff::unseed(n[offsets[k] + j]);
+        }
+
+        return hblocks;
+    }
+
+    auto partiallyExactBlocks(real const& T, real const& P, VectorXrConstRef const& nconst, VectorXlConstRef const& idxs) -> EquilibriumHessianBlocks const&
+    {
+        n = nconst;
+
+        approximateBlocks(n);
+
         const double RT = universalGasConstant * T;
-        dudn.noalias() = jacobian(fn, wrt(n), at(n))/RT;
-        return dudn;
+
+        // Replace the approximate derivatives with respect to the selected species with exact ones
+        for(auto i : idxs)
+        {
+            const auto k = iphase[i];
+            const auto offset = offsets[k];
+            const auto length = lengths[k];
+
+            autodiff::seed(n[i]);
+            props.update(T, P, n);
+            autodiff::unseed(n[i]);
+
+            auto const& u = props.speciesChemicalPotentials();
+
+            if(length == 1)
+                hblocks.diagonal[ientries[k]] = grad(u[i])/RT;
+            else
+                for(Index j = 0; j < length; ++j)
+                    hblocks.blocks[ientries[k]](j, i - offset) = grad(u[offset + j])/RT;
+        }
+
+        return hblocks;
+    }
+
+    auto approximateBlocks(VectorXrConstRef const& n) -> EquilibriumHessianBlocks const&
+    {
+        const auto numphases = system.phases().size();
+        for(auto k = 0; k < numphases; ++k)
+        {
+            const auto np = n.segment(offsets[k], lengths[k]);
+            if(lengths[k] == 1)
+            {
+                const auto dupdnp_diag = hblocks.diagonal.segment(ientries[k], 1);
+                approxfuncsdiag[k](np, dupdnp_diag);
+            }
+            else approxfuncs[k](np, hblocks.blocks[ientries[k]]);
+        }
+        return hblocks;
+    }
+
+    auto diagonalBlocks(VectorXrConstRef const& n) -> EquilibriumHessianBlocks const&
+    {
+        const auto numphases = system.phases().size();
+        for(auto k = 0; k < numphases; ++k)
+        {
+            const auto np = n.segment(offsets[k], lengths[k]);
+            if(lengths[k] == 1)
+            {
+                const auto dupdnp_diag = hblocks.diagonal.segment(ientries[k], 1);
+                approxfuncsdiag[k](np, dupdnp_diag);
+            }
+            else
+            {
+                const auto dupdnp_diag = dudn_diag.segment(offsets[k], lengths[k]);
+                approxfuncsdiag[k](np, dupdnp_diag);
+                auto& block = hblocks.blocks[ientries[k]];
+                block.fill(0.0);
+                block.diagonal() = dupdnp_diag;
+            }
+        }
+        return hblocks;
     }
 
-    auto partiallyExact(real const& T, real const& P, VectorXrConstRef const& nconst, VectorXlConstRef const& idxs) -> MatrixXdConstRef
+    auto exact(real const& T, real const& P, VectorXrConstRef const& nconst) -> MatrixXdConstRef
     {
         n = nconst;
         auto fn = [&](VectorXrConstRef const& n) -> VectorXr
@@ -129,42 +339,34 @@ struct EquilibriumHessian::Impl
             return props.speciesChemicalPotentials();
         };
         const double RT = universalGasConstant * T;
-        dudn = approximate(n);
-        dudn(Eigen::all, idxs) = jacobian(fn, wrt(n(idxs)), at(n))/RT;
+        dudn.noalias() = jacobian(fn, wrt(n), at(n))/RT;
+        dudn_offblock_dirty = true;
         return dudn;
     }
 
-    auto approximate(VectorXrConstRef const& n) -> MatrixXdConstRef
+    /// Assemble the diagonal blocks into `dudn`, whose entries outside these blocks are zero unless overwritten by @ref exact.
+    auto assemble(EquilibriumHessianBlocks const& blocks) -> MatrixXdConstRef
     {
-        dudn.fill(0.0); // clear previous state of dudn
-        const auto numphases = system.phases().size();
-        auto offset = 0;
-        for(auto i = 0; i < numphases; ++i)
-        {
-            const auto length = system.phase(i).species().size();
-            const auto np = n.segment(offset, length);
-            auto dupdnp = dudn.block(offset, offset, length, length);
-            approxfuncs[i](np, dupdnp);
-            offset += length;
-        }
+        if(dudn_offblock_dirty)
+            dudn.fill(0.0);
+        dudn_offblock_dirty = false;
+        blocks.assemble(dudn);
         return dudn;
     }
 
+    auto partiallyExact(real const& T, real const& P, VectorXrConstRef const& n, VectorXlConstRef const& idxs) -> MatrixXdConstRef
+    {
+        return assemble(partiallyExactBlocks(T, P, n, idxs));
+    }
+
+    auto approximate(VectorXrConstRef const& n) -> MatrixXdConstRef
+    {
+        return assemble(approximateBlocks(n));
+    }
+
     auto diagonal(VectorXrConstRef const& n) -> MatrixXdConstRef
     {
-        dudn.fill(0.0); // clear previous state of dudn
-        const auto numphases = system.phases().size();
-        auto offset = 0;
-        for(auto i = 0; i < numphases; ++i)
-        {
-            const auto length = system.phase(i).species().size();
-            const auto np = n.segment(offset, length);
-            const auto dupdnp_diag = dudn_diag.segment(offset, length);
-            approxfuncsdiag[i](np, dupdnp_diag);
-            offset += length;
-        }
-        dudn.diagonal() = dudn_diag;
-        return dudn;
+        return assemble(diagonalBlocks(n));
     }
 };
 
@@ -208,4 +410,24 @@ auto EquilibriumHessian::diagonal(VectorXrConstRef const& n) -> MatrixXdConstRef
     return pimpl->diagonal(n);
 }
 
+auto EquilibriumHessian::exactBlocks(real const& T, real const& P, VectorXrConstRef const& n) -> EquilibriumHessianBlocks const&
+{
+    return pimpl->exactBlocks(T, P, n);
+}
+
+auto EquilibriumHessian::partiallyExactBlocks(real const& T, real const& P, VectorXrConstRef const& n, VectorXlConstRef const& idxs) -> EquilibriumHessianBlocks const&
+{
+    return pimpl->partiallyExactBlocks(T, P, n, idxs);
+}
+
+auto EquilibriumHessian::approximateBlocks(VectorXrConstRef const& n) -> EquilibriumHessianBlocks const&
+{
+    return pimpl->approximateBlocks(n);
+}
+
+auto EquilibriumHessian::diagonalBlocks(VectorXrConstRef const& n) -> EquilibriumHessianBlocks const&
+{
+    return pimpl->diagonalBlocks(n);
+}
+
 } // namespace Reaktoro
@@ -26,6 +26,43 @@ namespace Reaktoro {
 // Forward declarations
 class ChemicalSystem;
 
+/// The diagonal blocks of the Hessian matrix *∂(µ/RT)/∂n* of the Gibbs energy function.
+/// The chemical potentials of the species in a phase usually depend only on
+/// the amounts of the species in that phase, so that *∂(µ/RT)/∂n* is block
+/// diagonal, with one block per phase. The 1x1 blocks of the single-species
+/// phases (e.g., pure minerals) are collapsed into a single diagonal vector.
+/// @note These blocks are an intermediate step only. They reduce the cost of
+/// evaluating the Hessian matrix, but are then assembled with @ref assemble
+/// into dense matrices (e.g., the Hessian matrix in EquilibriumSetup). The
+/// optimization solver (Optima) still receives and factorizes a dense
+/// Hessian matrix, since it accepts no block-diagonal structure (only dense
+/// or diagonal ones).
+struct EquilibriumHessianBlocks
+{
+    /// The indices of the phases with more than one species.
+    Indices iphases;
+
+    /// The index of the first species in each phase with more than one species.
+    Indices offsets;
+
+    /// The diagonal blocks of *∂(µ/RT)/∂n* corresponding to each phase with more than one species.
+    Vec<MatrixXd> blocks;
+
+    /// The indices of the species in single-species phases (i.e., the pure phase species).
+    Indices ipps;
+
+    /// The diagonal entries of *∂(µ/RT)/∂n* corresponding to the pure phase species.
+    VectorXd diagonal;
+
+    /// Return true if all phases have a single species, in which case *∂(µ/RT)/∂n* is a diagonal matrix.
+    auto isDiagonal() const -> bool;
+
+    /// Assemble the blocks into the dense matrix *H* of dimension *Nn x Nn*.
+    /// Only the entries in the blocks are written. The entries of *H* outside
+    /// these blocks are assumed to be zero already.
+    auto assemble(MatrixXdRef H) const -> void;
+};
+
 /// Used to compute the Hessian matrix of the Gibbs energy function.
 class EquilibriumHessian
 {
@@ -70,6 +107,29 @@ public:
     /// diagonal entries from the matrix produced with @ref dudnApproximate.
     auto diagonal(VectorXrConstRef const& n) -> MatrixXdConstRef;
 
+    /// Evaluate the diagonal blocks of the Hessian matrix *∂(µ/RT)/∂n* with exact derivatives.
+    /// The derivatives for a phase are computed analytically if its activity
+    /// model supports this (see ActivityJacobian), and with automatic
+    /// differentiation otherwise. Unlike @ref exact, the derivatives of the
+    /// chemical potentials of the species in a phase with respect to the
+    /// amounts of species in other phases are neglected. These are not zero
+    /// for phases whose activity models depend on the state of another phase
+    /// (e.g., an ion exchange phase using the aqueous state).
+    /// @see exact
+    auto exactBlocks(real const& T, real const& P, VectorXrConstRef const& n) -> EquilibriumHessianBlocks const&;
+
+    /// Evaluate the diagonal blocks of the Hessian matrix *∂(µ/RT)/∂n* with exact derivatives for selected species.
+    /// @see partiallyExact
+    auto partiallyExactBlocks(real const& T, real const& P, VectorXrConstRef const& n, VectorXlConstRef const& idxs) -> EquilibriumHessianBlocks const&;
+
+    /// Evaluate the diagonal blocks of the Hessian matrix *∂(µ/RT)/∂n* with approximate derivatives.
+    /// @see approximate
+    auto approximateBlocks(VectorXrConstRef const& n) -> EquilibriumHessianBlocks const&;
+
+    /// Evaluate the diagonal blocks of the Hessian matrix *∂(µ/RT)/∂n* with only their diagonal entries using approximate derivatives.
+    /// @see diagonal
+    auto diagonalBlocks(VectorXrConstRef const& n) -> EquilibriumHessianBlocks const&;
+
 private:
     struct Impl;
 
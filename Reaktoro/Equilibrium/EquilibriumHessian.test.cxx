@@ -22,7 +22,10 @@
 #include <Reaktoro/Core/ChemicalProps.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Phases.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumHessian.hpp>
+#include <Reaktoro/Models/ActivityModels/ActivityModelCubicEOS.hpp>
+#include <Reaktoro/Models/ActivityModels/ActivityModelDebyeHuckel.hpp>
 using namespace Reaktoro;
 
 namespace test { extern auto createChemicalSystem() -> ChemicalSystem; }
@@ -111,4 +114,89 @@ TEST_CASE("Testing EquilibriumHessian", "[EquilibriumHessian]")
         INFO("dudn_partially_exact(expected) = \n" << dudn_partially_exact_expected);
         CHECK( dudn_partially_exact.isApprox(dudn_partially_exact_expected) );
     }
+
+    SECTION("testing EquilibriumHessian::approximateBlocks")
+    {
+        auto const& blocks = hessian.approximateBlocks(n);
+
+        CHECK( blocks.blocks.size() + blocks.ipps.size() == system.phases().size() );
+        CHECK( blocks.diagonal.size() == blocks.ipps.size() );
+        CHECK( blocks.isDiagonal() == (blocks.ipps.size() == Nn) );
+
+        for(auto i = 0; i < blocks.blocks.size(); ++i)
+        {
+            const auto offset = blocks.offsets[i];
+            const auto length = system.phase(blocks.iphases[i]).species().size();
+            CHECK( blocks.blocks[i].isApprox(dudn_approx_expected.block(offset, offset, length, length)) );
+        }
+
+        for(auto i = 0; i < blocks.ipps.size(); ++i)
+            CHECK( blocks.diagonal[i] == Approx(dudn_approx_expected(blocks.ipps[i], blocks.ipps[i])) );
+
+        MatrixXd dudn_assembled = MatrixXd::Zero(Nn, Nn);
+        blocks.assemble(dudn_assembled);
+
+        CHECK( dudn_assembled.isApprox(dudn_approx_expected) );
+    }
+}
+
+TEST_CASE("Testing EquilibriumHessian with analytic derivatives of activity models", "[EquilibriumHessian]")
+{
+    const auto db = Database({
+        Species("H2O"     ).withStandardGibbsEnergy( -237181.72),
+        Species("H+"      ).withStandardGibbsEnergy(       0.00),
+        Species("OH-"     ).withStandardGibbsEnergy( -157297.48),
+        Species("Na+"     ).withStandardGibbsEnergy( -261880.74),
+        Species("Cl-"     ).withStandardGibbsEnergy( -131289.74),
+        Species("NaCl"    ).withStandardGibbsEnergy( -388735.44),
+        Species("CO2"     ).withStandardGibbsEnergy( -385974.00),
+        Species("HCO3-"   ).withStandardGibbsEnergy( -586939.89),
+        Species("CO2(g)"  ).withStandardGibbsEnergy( -394358.74),
+        Species("H2O(g)"  ).withStandardGibbsEnergy( -228131.76),
+        Species("CH4(g)"  ).withStandardGibbsEnergy(  -50720.12),
+        Species("NaCl(s)" ).withStandardGibbsEnergy( -384120.49).withName("Halite"),
+    });
+
+    Phases phases(db);
+    phases.add( AqueousPhase("H2O H+ OH- Na+ Cl- NaCl CO2 HCO3-").set(ActivityModelDebyeHuckel()) );
+    phases.add( GaseousPhase("CO2(g) H2O(g) CH4(g)").set(ActivityModelPengRobinson()) );
+    phases.add( MineralPhase("Halite") );
+
+    ChemicalSystem system(phases);
+
+    ChemicalState state(system);
+    state.temperature(60.0, "celsius");
+    state.pressure(100.0, "bar");
+    state.setSpeciesAmounts(0.1);
+    state.set("H2O"   , 55.0, "mol");
+    state.set("CO2(g)", 10.0, "mol");
+    state.set("H2O(g)",  0.5, "mol");
+
+    const auto T = state.temperature();
+    const auto P = state.pressure();
+    const auto n = state.speciesAmounts();
+    const auto RT = universalGasConstant * T;
+
+    ChemicalProps props(system);
+    auto u = [&](VectorXrConstRef n) -> VectorXr
+    {
+        props.update(T, P, n);
+        return props.speciesChemicalPotentials()/RT;
+    };
+
+    VectorXr nn = n;
+    MatrixXd dudn_expected = jacobian(u, wrt(nn), at(nn));
+
+    EquilibriumHessian hessian(system);
+
+    MatrixXd dudn = zeros(n.size(), n.size());
+    hessian.exactBlocks(T, P, n).assemble(dudn); // the phases in this system are not coupled, so the exact Hessian is block diagonal
+
+    INFO("dudn = \n" << dudn);
+    INFO("dudn(expected) = \n" << dudn_expected);
+    CHECK( dudn.isApprox(dudn_expected, 1e-8) );
+
+    MatrixXd dudn_exact = hessian.exact(T, P, n);
+
+    CHECK( dudn_exact.isApprox(dudn_expected, 1e-8) );
 }
@@ -20,6 +20,9 @@
 // Optima includes
 #include <Optima/Options.hpp>
 
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
 namespace Reaktoro {
 
 /// The options for the description of the Hessian of the Gibbs energy function
@@ -66,6 +69,67 @@ struct EquilibriumOptions
 
     /// The calculation mode of the Hessian of the Gibbs energy function
     GibbsHessian hessian = GibbsHessian::PartiallyExact;
+
+    /// The flag indicating if exact columns of the Hessian of the Gibbs energy function are computed by seeding one species per phase at once.
+    /// When enabled, a single evaluation of the chemical properties computes
+    /// the Hessian columns of several species, one from each phase, instead of
+    /// one evaluation per species. Activity models that read the state of
+    /// another phase via ActivityProps::extra (e.g., ion exchange models,
+    /// which depend on the state of the aqueous phase) are detected (again
+    /// while some species of a phase have zero amounts), and the species of
+    /// phases coupled this way are never seeded together. The
+    /// resulting Hessian columns are the same as those computed one species
+    /// at a time. This is not used when there are *p* control variables in
+    /// the calculation.
+    bool hessian_seeding_by_phase = true;
+
+    /// The flag indicating if the exact Hessian of the Gibbs energy function uses analytic derivatives of the activity models when available.
+    /// When enabled, the activity models that support analytic derivatives with
+    /// respect to mole fractions (see ActivityJacobian) are used to compute their
+    /// blocks of the Hessian matrix, without automatic differentiation. The other
+    /// phases, and the phases on which other phases depend, fall back to
+    /// automatic differentiation. This is only used with GibbsHessian::Exact
+    /// when #hessian_seeding_by_phase is also enabled.
+    bool hessian_analytic_activity_derivatives = false;
+
+    /// The flag indicating if the Hessian matrix of the Gibbs energy function can be reused across iterations (modified Newton method).
+    /// When enabled, the derivatives with respect to *x* and *p* (i.e.,
+    /// *Hxx*, *Vpx*, *Hxp*, and *Vpp*) computed in a previous iteration are
+    /// kept while the steps between consecutive iterations contract by at
+    /// least the factor #hessian_reuse_contraction_rate. Otherwise, or after
+    /// #hessian_reuse_max_iterations consecutive reuses, they are recomputed.
+    /// They are also recomputed whenever the input variables or the basic
+    /// variables change. The numbers of computations and reuses are reported in
+    /// EquilibriumResult::hessian_refreshes and EquilibriumResult::hessian_reuses.
+    bool hessian_reuse = false;
+
+    /// The maximum ratio between the lengths of consecutive steps for the Hessian matrix to be reused (see #hessian_reuse).
+    double hessian_reuse_contraction_rate = 0.5;
+
+    /// The maximum number of consecutive iterations in which the Hessian matrix is reused before it is recomputed (see #hessian_reuse).
+    Index hessian_reuse_max_iterations = 5;
+
+    /// The flag indicating if the Hessian matrix of the last iteration of a calculation can be reused in the first iteration of the next one (see #hessian_reuse).
+    /// This is effective in sequences of closely related calculations with
+    /// the same input variables, such as consecutive chemical kinetics steps
+    /// with the same time step. In the following iterations, the Hessian
+    /// matrix is reused only while the steps contract as usual.
+    bool hessian_reuse_across_calculations = false;
+
+    /// The flag indicating if the Hessian matrix is reused within and across the calculations with multiple right-hand sides (see EquilibriumSolver::solve(Vec<ChemicalState>&, MatrixXdConstRef)).
+    /// When enabled, these calculations reuse the Hessian matrix as if both
+    /// #hessian_reuse and #hessian_reuse_across_calculations were enabled,
+    /// whatever their values. Disable it so that these calculations follow
+    /// #hessian_reuse and #hessian_reuse_across_calculations instead.
+    bool hessian_reuse_multiple_rhs = true;
+
+    /// The number of threads used when solving a batch of chemical equilibrium problems.
+    /// If zero, the number of threads is the number of concurrent threads supported by the hardware.
+    Index batch_num_threads = 0;
+
+    /// The flag indicating if the counts and elapsed times of the operations in a calculation are recorded in EquilibriumResult::profiling.
+    /// This has no effect if Reaktoro is built with `REAKTORO_DISABLE_PROFILING` defined.
+    bool profiling = false;
 };
 
 } // namespace Reaktoro
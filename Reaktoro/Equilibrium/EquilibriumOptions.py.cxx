@@ -30,5 +30,14 @@ void exportEquilibriumOptions(py::module& m)
         .def_readwrite("epsilon", &EquilibriumOptions::epsilon)
         .def_readwrite("logarithm_barrier_factor", &EquilibriumOptions::logarithm_barrier_factor)
         .def_readwrite("use_ideal_activity_models", &EquilibriumOptions::use_ideal_activity_models)
+        .def_readwrite("hessian_seeding_by_phase", &EquilibriumOptions::hessian_seeding_by_phase)
+        .def_readwrite("hessian_analytic_activity_derivatives", &EquilibriumOptions::hessian_analytic_activity_derivatives)
+        .def_readwrite("hessian_reuse", &EquilibriumOptions::hessian_reuse)
+        .def_readwrite("hessian_reuse_contraction_rate", &EquilibriumOptions::hessian_reuse_contraction_rate)
+        .def_readwrite("hessian_reuse_max_iterations", &EquilibriumOptions::hessian_reuse_max_iterations)
+        .def_readwrite("hessian_reuse_across_calculations", &EquilibriumOptions::hessian_reuse_across_calculations)
+        .def_readwrite("hessian_reuse_multiple_rhs", &EquilibriumOptions::hessian_reuse_multiple_rhs)
+        .def_readwrite("batch_num_threads", &EquilibriumOptions::batch_num_threads)
+        .def_readwrite("profiling", &EquilibriumOptions::profiling)
         ;
 }
@@ -17,10 +17,19 @@
 
 #include "EquilibriumPredictor.hpp"
 
+// C++ includes
+#include <algorithm>
+#include <cmath>
+
+// Optima includes
+#include <Optima/State.hpp>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
-#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
 
@@ -55,36 +64,226 @@ auto getPressureFn(Strings const& inputs) -> GetterFn
 
 struct EquilibriumPredictor::Impl
 {
-    const ChemicalState state0;
-    const EquilibriumSensitivity sensitivity0;
-    const VectorXd n0;    ///< The species amounts *n* at the reference equilibrium state.
-    const VectorXd p0;    ///< The control variables *p* at the reference equilibrium state.
-    const VectorXd q0;    ///< The control variables *q* at the reference equilibrium state.
-    const VectorXd w0;    ///< The input variables *w* at the reference equilibrium state.
-    const VectorXd c0;    ///< The component amounts *c* at the reference equilibrium state.
-    const VectorXd u0;    ///< The chemical properties *u* at the reference equilibrium state.
-    const Index Nn;       ///< The size of vector *n* with amounts of the species in the chemical system.
-    const Index Nu;       ///< The size of vector *u* with the serialized properties of the chemical system.
+    ChemicalSystem system;        ///< The chemical system of the reference equilibrium state.
+    SharedPtr<Names const> names; ///< The names of the input variables *w* and control variables *p* and *q*, possibly shared with other predictors (see @ref shareNames).
+    Optima::State optstate0;      ///< The Optima state at the reference equilibrium state, containing the control variables *p* and *q*, and used for warm start.
+    VectorXd nu0;         ///< The species amounts *n* followed by the chemical properties *u* at the reference equilibrium state.
+    VectorXd x0;          ///< The input variables *w* followed by the amounts of the conservative components *c* at the reference equilibrium state.
+    MatrixXd dydx;        ///< The derivatives of *y = (n, p, q, u[iu])* with respect to *x = (w, c)* at the reference equilibrium state, with rows in the order of @ref order (empty if stored in single precision).
+    MatrixXf dydxf;       ///< The same derivatives in single precision (empty if stored in double precision).
+    Indices order;        ///< The row of *dy/dx* stored in each row of @ref dydx or @ref dydxf, with the chemical potentials of the primary species first if @ref packed (empty if the rows are stored in their original order).
+    bool packed = false;  ///< The flag indicating if the chemical potentials of all primary species are among the predicted chemical properties, in which case their rows are stored first for fast acceptance tests.
+    VectorXd dxn;         ///< The change *dx = x1 - x0* in *x = (w, c)* from the reference state to a neighbor one used to estimate second-order derivatives (empty if not available).
+    VectorXd ddyn;        ///< The change in the directional derivative of *y* along @ref dxn from the reference state to the neighbor one, *(dy/dx)₁·dx - (dy/dx)₀·dx*, with entries in the order of @ref order.
+    VectorXd tn;          ///< The vector such that *t = tn·(x - x0)* is the scaled projection of *x - x0* on @ref dxn (one at the neighbor state).
+    VectorXd dmudxpdxn;   ///< The product of the derivatives of the chemical potentials of the primary species and @ref dxn (empty if not @ref packed).
+    Index Nn = 0;         ///< The size of vector *n* with amounts of the species in the chemical system.
+    Index Np = 0;         ///< The size of vector *p* with the *p* control variables.
+    Index Nq = 0;         ///< The size of vector *q* with the *q* control variables.
+    Index Nw = 0;         ///< The size of vector *w* with the input variables.
+    Index Nu = 0;         ///< The size of vector *u* with the serialized properties of the chemical system.
+    Indices iu;           ///< The indices of the entries in *u* corresponding to the last rows of *dy/dx*.
+    Indices imu;          ///< The index of the stored row of *dy/dx* corresponding to the chemical potential of each species (or the number of rows if not available).
     GetterFn getT;        ///< The function that gets temperature from either *p* or *w* depending if it is known or unwknon in the equilibrium calculation.
     GetterFn getP;        ///< The function that gets pressure from either *p* or *w* depending if it is known or unwknon in the equilibrium calculation.
 
     /// Construct a EquilibriumPredictor object.
-    Impl(ChemicalState const& state0, EquilibriumSensitivity const& sensitivity0)
-    : state0(state0), sensitivity0(sensitivity0),
-      n0(state0.speciesAmounts()),
-      p0(state0.equilibrium().p()),
-      q0(state0.equilibrium().q()),
-      w0(state0.equilibrium().w()),
-      c0(state0.equilibrium().c()),
-      u0(state0.props()),
-      Nn(n0.size()),
-      Nu(u0.size()),
-      getT(getTemperatureFn(state0.equilibrium().namesInputVariables())),
-      getP(getPressureFn(state0.equilibrium().namesInputVariables()))
+    Impl(ChemicalState const& state0, EquilibriumSensitivity const& sensitivity0, bool singleprecision)
+    : system(state0.system())
+    {
+        errorif(state0.equilibrium().w().size() == 0,
+            "EquilibriumPredictor expects a ChemicalState object that "
+            "has been used in a call to EquilibriumSolver::solve.");
+
+        errorif(sensitivity0.propertyIndices().size() != sensitivity0.dudw().rows(),
+            "EquilibriumPredictor expects an EquilibriumSensitivity object that "
+            "has been used in a call to EquilibriumSolver::solve.");
+
+        const auto dndw0 = sensitivity0.dndw(); // The derivatives *dn/dw* at the reference equilibrium state.
+        const auto dpdw0 = sensitivity0.dpdw(); // The derivatives *dp/dw* at the reference equilibrium state.
+        const auto dqdw0 = sensitivity0.dqdw(); // The derivatives *dq/dw* at the reference equilibrium state.
+        const auto dudw0 = sensitivity0.dudw(); // The derivatives *du/dw* at the reference equilibrium state.
+        const auto dndc0 = sensitivity0.dndc(); // The derivatives *dn/dc* at the reference equilibrium state.
+        const auto dpdc0 = sensitivity0.dpdc(); // The derivatives *dp/dc* at the reference equilibrium state.
+        const auto dqdc0 = sensitivity0.dqdc(); // The derivatives *dq/dc* at the reference equilibrium state.
+        const auto dudc0 = sensitivity0.dudc(); // The derivatives *du/dc* at the reference equilibrium state.
+
+        const auto Ny = dndw0.rows() + dpdw0.rows() + dqdw0.rows() + dudw0.rows();
+        const auto Nx = dndw0.cols() + dndc0.cols();
+
+        MatrixXd derivatives(Ny, Nx);
+        derivatives << dndw0, dndc0,
+                       dpdw0, dpdc0,
+                       dqdw0, dqdc0,
+                       dudw0, dudc0;
+
+        initialize(state0, sensitivity0.propertyIndices(), derivatives, singleprecision);
+    }
+
+    /// Construct a EquilibriumPredictor object.
+    Impl(ChemicalState const& state0, Indices const& iu, MatrixXdConstRef derivatives, bool singleprecision)
+    : system(state0.system())
     {
         errorif(state0.equilibrium().w().size() == 0,
             "EquilibriumPredictor expects a ChemicalState object that "
             "has been used in a call to EquilibriumSolver::solve.");
+
+        initialize(state0, iu, derivatives, singleprecision);
+    }
+
+    /// Initialize the reference data of this EquilibriumPredictor object.
+    auto initialize(ChemicalState const& state0, Indices const& iu0, MatrixXdConstRef derivatives, bool singleprecision) -> void
+    {
+        auto const& equilibrium0 = state0.equilibrium();
+
+        const VectorXd u0 = state0.props();
+
+        Nn = state0.speciesAmounts().size();
+        Np = equilibrium0.p().size();
+        Nq = equilibrium0.q().size();
+        Nw = equilibrium0.w().size();
+        Nu = u0.size();
+        iu = iu0;
+
+        const auto Nc = equilibrium0.c().size();
+        const auto Ny = Nn + Np + Nq + iu.size();
+
+        errorif(derivatives.rows() != Ny || derivatives.cols() != Nw + Nc,
+            "EquilibriumPredictor expects sensitivity derivatives with ", Ny, " rows and ",
+            Nw + Nc, " columns, but got ", derivatives.rows(), " rows and ", derivatives.cols(), " columns.");
+
+        names = std::make_shared<Names>(Names{ equilibrium0.namesInputVariables(), equilibrium0.namesControlVariablesP(), equilibrium0.namesControlVariablesQ() });
+
+        optstate0 = equilibrium0.optimaState();
+
+        nu0.resize(Nn + Nu);
+        nu0 << state0.speciesAmounts().cast<double>().matrix(), u0;
+
+        x0.resize(Nw + Nc);
+        x0 << equilibrium0.w().matrix(), equilibrium0.c().matrix();
+
+        getT = getTemperatureFn(names->w);
+        getP = getPressureFn(names->w);
+
+        // Locate the rows of the chemical potentials of the species among the rows of the sensitivity derivatives
+        imu.assign(Nn, Ny);
+        for(auto i = 0; i < iu.size(); ++i)
+            if(iu[i] >= Nu - Nn)
+                imu[iu[i] - (Nu - Nn)] = Nn + Np + Nq + i;
+
+        // Store the rows of the chemical potentials of the primary species first, so that these are contiguous for fast acceptance tests
+        const auto iprimary = optstate0.jb;
+        packed = true;
+        for(auto i = 0; i < iprimary.size(); ++i)
+            packed = packed && imu[iprimary[i]] < Ny;
+        MatrixXd stored = derivatives;
+        if(packed)
+        {
+            Vec<bool> first(Ny, false);
+            for(auto k = 0; k < iprimary.size(); ++k)
+            {
+                order.push_back(imu[iprimary[k]]);
+                first[imu[iprimary[k]]] = true;
+            }
+            for(auto r = 0; r < Ny; ++r)
+                if(!first[r])
+                    order.push_back(r);
+
+            Indices rows(Ny); // the stored row of each row of *dy/dx*
+            for(auto r = 0; r < Ny; ++r)
+            {
+                rows[order[r]] = r;
+                stored.row(r) = derivatives.row(order[r]);
+            }
+            for(auto i = 0; i < Nn; ++i)
+                if(imu[i] < Ny)
+                    imu[i] = rows[imu[i]];
+        }
+
+        if(singleprecision)
+            dydxf = stored.cast<float>();
+        else dydx = std::move(stored);
+    }
+
+    /// Return the stored derivatives of *y = (n, p, q, u[iu])* with respect to *x = (w, c)* multiplied by a given change in *x*, with entries in the order of @ref order.
+    auto storedDerivativesTimes(VectorXdConstRef const& dx) const -> VectorXd
+    {
+        if(dydxf.size())
+            return (dydxf * dx.cast<float>()).cast<double>();
+        return dydx * dx;
+    }
+
+    /// Return a vector with entries in the order of @ref order in the original order of the rows of *dy/dx*.
+    auto originalOrder(VectorXd const& ys) const -> VectorXd
+    {
+        if(order.empty())
+            return ys;
+        VectorXd y(ys.size());
+        y(order) = ys;
+        return y;
+    }
+
+    /// Return the derivatives of *y = (n, p, q, u[iu])* with respect to *x = (w, c)* multiplied by a given change in *x*.
+    auto derivativesTimes(VectorXdConstRef const& dx) const -> VectorXd
+    {
+        return originalOrder(storedDerivativesTimes(dx));
+    }
+
+    /// Set the directional second-order derivatives of *y* along a given change *dx* in *x = (w, c)*.
+    auto setCurvature(VectorXdConstRef const& dx, VectorXdConstRef const& ddy) -> void
+    {
+        const auto Nc = x0.size() - Nw;
+        const auto Ny = Nn + Np + Nq + iu.size();
+
+        errorif(dx.size() != Nw + Nc, "EquilibriumPredictor expects a change in the inputs (w, c) with ", Nw + Nc, " entries, but got ", dx.size(), ".");
+        errorif(ddy.size() != Ny, "EquilibriumPredictor expects a change in the directional derivatives of (n, p, q, u[iu]) with ", Ny, " entries, but got ", ddy.size(), ".");
+
+        // The weights of the entries in *x* so that changes in quantities with different units are comparable when projecting on *dx*
+        VectorXd weights(Nw + Nc);
+        weights.head(Nw) = x0.head(Nw).array().abs().max(1.0).inverse().matrix();
+        weights.tail(Nc).fill(1.0 / std::max(x0.tail(Nc).array().abs().sum(), 1.0e-16));
+
+        const VectorXd wdx = weights.cwiseProduct(dx);
+        const auto norm2 = wdx.squaredNorm();
+
+        errorif(!(norm2 > 0.0), "EquilibriumPredictor cannot estimate second-order derivatives with a neighbor state whose inputs (w, c) are equal to those of the reference state.");
+
+        dxn = dx;
+        ddyn = order.empty() ? VectorXd(ddy) : VectorXd(ddy(order));
+        tn = weights.cwiseProduct(wdx) / norm2;
+
+        if(packed)
+            dmudxpdxn = storedDerivativesTimes(dxn).head(optstate0.jb.size());
+    }
+
+    /// Set the directional second-order derivatives of *y* using the reference state and the sensitivity derivatives of a neighbor predictor.
+    auto setCurvature(Impl const& neighbor) -> void
+    {
+        errorif(neighbor.iu != iu || neighbor.Nn != Nn || neighbor.Np != Np || neighbor.Nq != Nq || neighbor.Nw != Nw || neighbor.x0.size() != x0.size(),
+            "EquilibriumPredictor cannot estimate second-order derivatives with a neighbor predictor of a different chemical equilibrium problem or with different predicted chemical properties.");
+
+        const VectorXd dx = neighbor.x0 - x0;
+
+        setCurvature(dx, neighbor.derivativesTimes(dx) - derivativesTimes(dx));
+    }
+
+    /// Share the names of the input and control variables with other predictors of the same chemical equilibrium problem.
+    auto shareNames(SharedPtr<Names const> const& other) -> void
+    {
+        errorif(other->w != names->w || other->p != names->p || other->q != names->q,
+            "EquilibriumPredictor cannot share the names of the input and control variables of a different chemical equilibrium problem.");
+        names = other;
+    }
+
+    /// Set the equilibrium data of a chemical state to those at the reference equilibrium state.
+    auto setReferenceEquilibrium(ChemicalState::Equilibrium& equilibrium) const -> void
+    {
+        equilibrium.setNamesInputVariables(names->w);
+        equilibrium.setNamesControlVariablesP(names->p);
+        equilibrium.setNamesControlVariablesQ(names->q);
+        equilibrium.setInputVariables(x0.head(Nw).array());
+        equilibrium.setInitialComponentAmounts(x0.tail(x0.size() - Nw).array());
+        equilibrium.setOptimaState(optstate0);
     }
 
     auto predict(ChemicalState& state, EquilibriumConditions const& conditions) const -> void
@@ -95,34 +294,42 @@ struct EquilibriumPredictor::Impl
         const auto w = wvals.cast<double>().matrix();
         const auto c = cvals.cast<double>().matrix();
 
-        const VectorXd dw = w - w0;
-        const VectorXd dc = c - c0;
+        const VectorXd dw = w - x0.head(Nw);
+        const VectorXd dc = c - x0.tail(x0.size() - Nw);
 
         predict(state, dw, dc);
     }
 
     auto predict(ChemicalState& state, VectorXdConstRef const& dw, VectorXdConstRef const& dc) const -> void
     {
-        const auto dndw0 = sensitivity0.dndw(); // The derivatives *dn/dw* at the reference equilibrium state.
-        const auto dpdw0 = sensitivity0.dpdw(); // The derivatives *dp/dw* at the reference equilibrium state.
-        const auto dqdw0 = sensitivity0.dqdw(); // The derivatives *dq/dw* at the reference equilibrium state.
-        const auto dudw0 = sensitivity0.dudw(); // The derivatives *du/dw* at the reference equilibrium state.
-        const auto dndc0 = sensitivity0.dndc(); // The derivatives *dn/dc* at the reference equilibrium state.
-        const auto dpdc0 = sensitivity0.dpdc(); // The derivatives *dp/dc* at the reference equilibrium state.
-        const auto dqdc0 = sensitivity0.dqdc(); // The derivatives *dq/dc* at the reference equilibrium state.
-        const auto dudc0 = sensitivity0.dudc(); // The derivatives *du/dc* at the reference equilibrium state.
+        VectorXd dx(dw.size() + dc.size());
+        dx << dw, dc;
 
-        const auto n = n0 + dndw0*dw + dndc0*dc;
-        const auto p = p0 + dpdw0*dw + dpdc0*dc;
-        const auto q = q0 + dqdw0*dw + dqdc0*dc;
-        const auto u = u0 + dudw0*dw + dudc0*dc;
+        VectorXd dys = storedDerivativesTimes(dx);
 
-        const auto w = w0 + dw;
-        const auto c = c0 + dc;
+        // Add the second-order correction along the direction to the neighbor state, if available and trusted at this change
+        const auto t = curvatureProjection(dx);
+        if(withinCurvatureTrustInterval(t))
+            dys += 0.5 * t * t * ddyn;
+
+        const VectorXd dy = originalOrder(dys);
+
+        const auto n = nu0.head(Nn) + dy.head(Nn);
+        const auto p = optstate0.p + dy.segment(Nn, Np);
+        const auto q = optstate0.x.tail(Nq) + dy.segment(Nn + Np, Nq);
+
+        // Only the chemical properties selected in the sensitivity derivatives are predicted (the others are kept at their reference values)
+        VectorXd u = nu0.tail(Nu);
+        if(iu.size() == Nu)
+            u += dy.tail(Nu);
+        else u(iu) += dy.tail(iu.size());
+
+        const auto w = x0.head(Nw) + dw;
+        const auto c = x0.tail(dc.size()) + dc;
 
         state.setSpeciesAmounts(n);
         state.props().update(u);
-        state.equilibrium() = state0.equilibrium();
+        setReferenceEquilibrium(state.equilibrium());
         state.equilibrium().setControlVariablesP(p);
         state.equilibrium().setControlVariablesQ(q);
         state.equilibrium().setInputVariables(w);
@@ -138,37 +345,235 @@ struct EquilibriumPredictor::Impl
         state.setPressure(P);
     }
 
+    /// Return the stored row of the derivatives of *y* with respect to *x = (w, c)* with given index in double precision.
+    auto storedDerivativesRow(Index r) const -> RowVectorXd
+    {
+        if(dydxf.size())
+            return dydxf.row(r).cast<double>();
+        return dydx.row(r);
+    }
+
     /// Perform a first-order Taylor prediction of the chemical potential of a species at given conditions.
     auto speciesChemicalPotentialPredicted(Index i, VectorXdConstRef const& dw, VectorXdConstRef const& dc) const -> double
     {
         assert(i < Nn);
 
-        const auto dudw0 = sensitivity0.dudw(); // The derivatives *du/dw* of the chemical properties of the chemical system wrt *w*.
-        const auto dudc0 = sensitivity0.dudc(); // The derivatives *du/dc* of the chemical properties of the chemical system wrt *c*.
+        const auto Ny = Nn + Np + Nq + iu.size();
+
+        errorif(imu[i] == Ny, "The chemical potential of the species with index ", i, " is not among the chemical properties selected in the sensitivity derivatives used in EquilibriumPredictor.");
+
+        const auto mui0 = speciesChemicalPotentialReference(i);
+
+        const RowVectorXd dmuidx0 = storedDerivativesRow(imu[i]); // The derivatives *dμ[i]/dx* of the chemical potential of the i-th species.
+
+        return mui0 + dmuidx0.head(Nw).dot(dw) + dmuidx0.tail(dc.size()).dot(dc);
+    }
+
+    /// Return the change *dx = x - x0* in *x = (w, c)* from the reference state in a buffer allocated once per thread (this predictor may be shared among threads).
+    auto changeFromReference(VectorXdConstRef const& x) const -> VectorXdConstRef
+    {
+        static thread_local VectorXd dx;
+        dx.noalias() = x - x0;
+        return dx;
+    }
+
+    /// Return the scaled projection *t* of a change *dx* in *x = (w, c)* on the direction to the neighbor state (zero if second-order derivatives are not available).
+    auto curvatureProjection(VectorXdConstRef const& dx) const -> double
+    {
+        return dxn.size() ? tn.dot(dx) : 0.0;
+    }
+
+    /// Return true if the second-order derivatives are available and trusted for a change in *x = (w, c)* with given projection *t* on the direction to the neighbor state.
+    /// The second-order derivatives are estimated from the derivatives at the
+    /// reference state (*t = 0*) and at the neighbor one (*t = 1*), so they are
+    /// not trusted beyond the distance between both (*|t| > 1*), where the
+    /// predictions are of first order and bounded by their first-order changes.
+    auto withinCurvatureTrustInterval(double t) const -> bool
+    {
+        return dxn.size() && std::abs(t) <= 1.0;
+    }
+
+    /// Return the estimated error in the predicted chemical potential of a species for a change *dx* in *x = (w, c)*, or NaN if its derivatives are not available.
+    auto speciesChemicalPotentialErrorEstimate(Index i, VectorXdConstRef const& dx, double t) const -> double
+    {
+        const auto Ny = Nn + Np + Nq + iu.size();
+
+        if(imu[i] == Ny)
+            return NaN;
+
+        const auto dmu = dydxf.size() ? dydxf.row(imu[i]).cast<double>().dot(dx) : dydx.row(imu[i]).dot(dx);
+
+        if(!withinCurvatureTrustInterval(t))
+            return std::abs(dmu);
+
+        const auto dmun = dydxf.size() ? dydxf.row(imu[i]).cast<double>().dot(dxn) : dydx.row(imu[i]).dot(dxn);
+
+        return std::abs(dmu - t * dmun) + 0.5 * t * t * std::abs(ddyn[imu[i]]);
+    }
+
+    /// Check if the estimated errors in the predicted chemical potentials of the primary species are within tolerances, testing one species at a time.
+    /// This is used instead of the packed test when the chemical potentials of
+    /// some primary species are not among the predicted chemical properties, in
+    /// which case the test fails.
+    auto primarySpeciesChemicalPotentialsWithinToleranceBySpecies(VectorXdConstRef const& dx, double t, double reltol, double abstol) const -> bool
+    {
+        for(auto i : optstate0.jb)
+        {
+            const auto mu0 = speciesChemicalPotentialReference(i);
+            const auto error = speciesChemicalPotentialErrorEstimate(i, dx, t);
+            if(!(error < reltol * std::abs(mu0) + abstol)) // note this also fails if any value is NaN
+                return false;
+        }
+        return true;
+    }
+
+    /// Check if the predicted changes in the chemical potentials of the primary species at given *x = (w, c)* are within tolerances.
+    auto primarySpeciesChemicalPotentialsWithinTolerance(VectorXdConstRef const& x, double reltol, double abstol) const -> bool
+    {
+        const auto dx = changeFromReference(x);
+
+        // The scaled projection of *x - x0* on the direction to the neighbor state, and whether second-order derivatives are used at this change
+        const auto t = curvatureProjection(dx);
+        const auto curved = withinCurvatureTrustInterval(t);
+
+        if(!packed)
+            return primarySpeciesChemicalPotentialsWithinToleranceBySpecies(dx, t, reltol, abstol);
+
+        // The number of primary species tested at once, so that the test exits early without computing all predicted changes
+        constexpr Index blocksize = 16;
+
+        // The predicted changes in the chemical potentials of a block of primary species (with fixed maximum size to avoid memory allocation)
+        Eigen::Array<double, Eigen::Dynamic, 1, 0, blocksize, 1> dmu;
+        Eigen::Matrix<float, Eigen::Dynamic, 1, 0, blocksize, 1> dmuf;
+
+        // The change in *x* in single precision, if the derivatives are stored in single precision (in a buffer allocated once per thread)
+        static thread_local VectorXf dxf;
+        if(dydxf.size())
+            dxf = dx.cast<float>();
+
+        auto const& iprimary = optstate0.jb;
+        auto const mu0 = nu0.tail(Nn);
+
+        const Index Nb = iprimary.size();
+
+        for(Index k = 0; k < Nb; k += blocksize)
+        {
+            const auto m = std::min(blocksize, Nb - k);
+            dmu.resize(m);
+            if(dydxf.size())
+            {
+                dmuf.resize(m);
+                dmuf.noalias() = dydxf.middleRows(k, m) * dxf;
+                dmu = dmuf.array().cast<double>();
+            }
+            else dmu.matrix().noalias() = dydx.middleRows(k, m) * dx;
+            if(curved)
+                dmu = (dmu - t * dmudxpdxn.segment(k, m).array()).abs() + 0.5 * t * t * ddyn.segment(k, m).array().abs();
+            const auto tol = reltol * mu0(iprimary.segment(k, m)).array().abs() + abstol;
+            if(!(dmu.abs() < tol).all()) // note this also fails if any value is NaN
+                return false;
+        }
+
+        return true;
+    }
+
+    /// Return the estimated errors in the predicted chemical potentials of the primary species at given *x = (w, c)*.
+    auto primarySpeciesChemicalPotentialsErrorEstimate(VectorXdConstRef const& x) const -> VectorXd
+    {
+        const auto dx = changeFromReference(x);
+
+        const auto t = curvatureProjection(dx);
 
-        const auto dmuidw0 = dudw0.row(Nu - Nn + i); // The derivatives *dμ[i]/dw* of the chemical potential of the i-th species.
-        const auto dmuidc0 = dudc0.row(Nu - Nn + i); // The derivatives *dμ[i]/dc* of the chemical potential of the i-th species.
-        const auto mui0 = u0[Nu - Nn + i];
+        auto const& iprimary = optstate0.jb;
 
-        return mui0 + dmuidw0.dot(dw) + dmuidc0.dot(dc);
+        if(!packed)
+        {
+            VectorXd errors(iprimary.size());
+            for(auto k = 0; k < iprimary.size(); ++k)
+                errors[k] = speciesChemicalPotentialErrorEstimate(iprimary[k], dx, t);
+            return errors;
+        }
+
+        const auto Nb = iprimary.size();
+
+        ArrayXd dmu = storedDerivativesTimes(dx).head(Nb).array();
+
+        if(withinCurvatureTrustInterval(t))
+            dmu = (dmu - t * dmudxpdxn.array()).abs() + 0.5 * t * t * ddyn.head(Nb).array().abs();
+
+        return dmu.abs().matrix();
     }
 
     /// Return the chemical potential of a species at given reference conditions.
     auto speciesChemicalPotentialReference(Index i) const -> double
     {
         assert(i < Nn);
-        return u0[Nu - Nn + i];
+        return nu0[Nn + Nu - Nn + i]; // the chemical potentials of the species are the last Nn entries in u, which follows n in nu0
+    }
+
+    /// Return the reference chemical equilibrium state reconstructed from the stored data.
+    auto referenceState() const -> ChemicalState
+    {
+        ChemicalState state0(system);
+        state0.setTemperature(getT(optstate0.p, x0.head(Nw)));
+        state0.setPressure(getP(optstate0.p, x0.head(Nw)));
+        state0.setSpeciesAmounts(nu0.head(Nn).array());
+        state0.props().update(nu0.tail(Nu).array());
+        setReferenceEquilibrium(state0.equilibrium());
+        return state0;
+    }
+
+    /// Return the derivatives of *y = (n, p, q, u[iu])* with respect to *x = (w, c)* in double precision.
+    auto derivatives() const -> MatrixXd
+    {
+        MatrixXd stored = dydxf.size() ? MatrixXd(dydxf.cast<double>()) : dydx;
+        if(order.empty())
+            return stored;
+        MatrixXd result(stored.rows(), stored.cols());
+        for(auto r = 0; r < order.size(); ++r)
+            result.row(order[r]) = stored.row(r);
+        return result;
+    }
+
+    /// Return the change in the directional derivatives *(dy/dx)·dx* of *y* to the neighbor reference state.
+    auto curvature() const -> VectorXd
+    {
+        return originalOrder(ddyn);
+    }
+
+    /// Return the number of bytes used to store the reference data of the predictor.
+    auto memoryUsage() const -> Index
+    {
+        const auto optbytes = (optstate0.x.size() + optstate0.p.size() + optstate0.ye.size() + optstate0.s.size()) * sizeof(double)
+            + (optstate0.jb.size() + optstate0.jn.size()) * sizeof(Eigen::Index);
+        const auto refbytes = (nu0.size() + x0.size()) * sizeof(double);
+        const auto derivbytes = dydx.size() * sizeof(double) + dydxf.size() * sizeof(float);
+        const auto curvaturebytes = (dxn.size() + ddyn.size() + tn.size() + dmudxpdxn.size()) * sizeof(double);
+        const auto indexbytes = (iu.size() + imu.size() + order.size()) * sizeof(Index);
+        return sizeof(Impl) + optbytes + refbytes + derivbytes + curvaturebytes + indexbytes;
     }
 };
 
 EquilibriumPredictor::EquilibriumPredictor(ChemicalState const& state0, EquilibriumSensitivity const& sensitivity0)
-: pimpl(new Impl(state0, sensitivity0))
+: pimpl(new Impl(state0, sensitivity0, false))
+{}
+
+EquilibriumPredictor::EquilibriumPredictor(ChemicalState const& state0, EquilibriumSensitivity const& sensitivity0, bool singleprecision)
+: pimpl(new Impl(state0, sensitivity0, singleprecision))
+{}
+
+EquilibriumPredictor::EquilibriumPredictor(ChemicalState const& state0, Indices const& iu, MatrixXdConstRef derivatives, bool singleprecision)
+: pimpl(new Impl(state0, iu, derivatives, singleprecision))
 {}
 
 EquilibriumPredictor::EquilibriumPredictor(EquilibriumPredictor const& other)
 : pimpl(new Impl(*other.pimpl))
 {}
 
+EquilibriumPredictor::EquilibriumPredictor(EquilibriumPredictor&& other) noexcept
+: pimpl(std::move(other.pimpl))
+{}
+
 EquilibriumPredictor::~EquilibriumPredictor()
 {}
 
@@ -178,6 +583,16 @@ auto EquilibriumPredictor::operator=(EquilibriumPredictor other) -> EquilibriumP
     return *this;
 }
 
+auto EquilibriumPredictor::setCurvature(EquilibriumPredictor const& neighbor) -> void
+{
+    pimpl->setCurvature(*neighbor.pimpl);
+}
+
+auto EquilibriumPredictor::setCurvature(VectorXdConstRef const& dx, VectorXdConstRef const& ddy) -> void
+{
+    pimpl->setCurvature(dx, ddy);
+}
+
 auto EquilibriumPredictor::predict(ChemicalState& state, EquilibriumConditions const& conditions) const -> void
 {
     pimpl->predict(state, conditions);
@@ -193,9 +608,79 @@ auto EquilibriumPredictor::speciesChemicalPotentialPredicted(Index ispecies, Vec
     return pimpl->speciesChemicalPotentialPredicted(ispecies, dw, dc);
 }
 
+auto EquilibriumPredictor::primarySpeciesChemicalPotentialsWithinTolerance(VectorXdConstRef const& x, double reltol, double abstol) const -> bool
+{
+    return pimpl->primarySpeciesChemicalPotentialsWithinTolerance(x, reltol, abstol);
+}
+
+auto EquilibriumPredictor::primarySpeciesChemicalPotentialsErrorEstimate(VectorXdConstRef const& x) const -> VectorXd
+{
+    return pimpl->primarySpeciesChemicalPotentialsErrorEstimate(x);
+}
+
 auto EquilibriumPredictor::speciesChemicalPotentialReference(Index ispecies) const -> double
 {
     return pimpl->speciesChemicalPotentialReference(ispecies);
 }
 
+auto EquilibriumPredictor::referenceState() const -> ChemicalState
+{
+    return pimpl->referenceState();
+}
+
+auto EquilibriumPredictor::referenceInputVariables() const -> ArrayXdConstRef
+{
+    return pimpl->x0.head(pimpl->Nw).array();
+}
+
+auto EquilibriumPredictor::referenceComponentAmounts() const -> ArrayXdConstRef
+{
+    return pimpl->x0.tail(pimpl->x0.size() - pimpl->Nw).array();
+}
+
+auto EquilibriumPredictor::referencePrimarySpecies() const -> ArrayXlConstRef
+{
+    return pimpl->optstate0.jb;
+}
+
+auto EquilibriumPredictor::propertyIndices() const -> Indices const&
+{
+    return pimpl->iu;
+}
+
+auto EquilibriumPredictor::derivatives() const -> MatrixXd
+{
+    return pimpl->derivatives();
+}
+
+auto EquilibriumPredictor::singlePrecision() const -> bool
+{
+    return pimpl->dydxf.size() > 0;
+}
+
+auto EquilibriumPredictor::curvatureDirection() const -> VectorXdConstRef
+{
+    return pimpl->dxn;
+}
+
+auto EquilibriumPredictor::curvature() const -> VectorXd
+{
+    return pimpl->curvature();
+}
+
+auto EquilibriumPredictor::names() const -> SharedPtr<Names const> const&
+{
+    return pimpl->names;
+}
+
+auto EquilibriumPredictor::shareNames(SharedPtr<Names const> const& names) -> void
+{
+    pimpl->shareNames(names);
+}
+
+auto EquilibriumPredictor::memoryUsage() const -> Index
+{
+    return pimpl->memoryUsage();
+}
+
 } // namespace Reaktoro
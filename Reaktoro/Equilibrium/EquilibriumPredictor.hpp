@@ -29,29 +29,86 @@ class EquilibriumConditions;
 class EquilibriumSensitivity;
 
 /// Used to predict a chemical equilibrium state at given conditions using first-order Taylor approximation.
+/// The prediction can be improved with a second-order correction along the
+/// direction to a neighbor reference state (see @ref setCurvature).
 class EquilibriumPredictor
 {
 public:
+    /// The names of the input variables *w* and control variables *p* and *q* of the chemical equilibrium problem.
+    struct Names
+    {
+        /// The names of the input variables *w*.
+        Strings w;
+
+        /// The names of the control variables *p*.
+        Strings p;
+
+        /// The names of the control variables *q*.
+        Strings q;
+    };
+
     /// Construct a EquilibriumPredictor object.
     /// @param state0 The reference chemical equilibrium state from which first-order Taylor predictions are made.
     /// @param sensitivity0 The sensitivity derivatives of the chemical equilibrium state at the reference point.
     EquilibriumPredictor(ChemicalState const& state0, EquilibriumSensitivity const& sensitivity0);
 
+    /// Construct a EquilibriumPredictor object.
+    /// @param state0 The reference chemical equilibrium state from which first-order Taylor predictions are made.
+    /// @param sensitivity0 The sensitivity derivatives of the chemical equilibrium state at the reference point.
+    /// @param singleprecision The flag indicating if the sensitivity derivatives are stored in single precision to reduce memory usage.
+    EquilibriumPredictor(ChemicalState const& state0, EquilibriumSensitivity const& sensitivity0, bool singleprecision);
+
+    /// Construct a EquilibriumPredictor object with sensitivity derivatives previously returned by @ref derivatives.
+    /// @param state0 The reference chemical equilibrium state from which first-order Taylor predictions are made.
+    /// @param iu The indices of the entries in the serialized chemical properties *u* whose derivatives are given (see @ref propertyIndices).
+    /// @param derivatives The derivatives of *y = (n, p, q, u[iu])* with respect to *x = (w, c)* at the reference point.
+    /// @param singleprecision The flag indicating if the sensitivity derivatives are stored in single precision to reduce memory usage.
+    EquilibriumPredictor(ChemicalState const& state0, Indices const& iu, MatrixXdConstRef derivatives, bool singleprecision);
+
     /// Construct a copy of a EquilibriumPredictor object.
     EquilibriumPredictor(EquilibriumPredictor const& other);
 
+    /// Construct a EquilibriumPredictor object by taking over the data of another, left empty.
+    EquilibriumPredictor(EquilibriumPredictor&& other) noexcept;
+
     /// Destroy this EquilibriumPredictor object.
     ~EquilibriumPredictor();
 
     /// Assign a copy of a EquilibriumPredictor object to this.
     auto operator=(EquilibriumPredictor other) -> EquilibriumPredictor&;
 
-    /// Perform a first-order Taylor prediction of the chemical state at given conditions.
+    /// Set the directional second-order derivatives of the predictor using the reference state and sensitivity derivatives of a neighbor predictor.
+    /// The change in the sensitivity derivatives from the reference state to
+    /// the neighbor one, along the change *dx = x1 - x0* in *x = (w, c)*
+    /// between them, determines the second-order derivatives along *dx*. The
+    /// predictions then add the correction *½t²[(dy/dx)₁ - (dy/dx)₀]dx*, in
+    /// which *t* is the projection of *x - x0* on *dx* (with *t = 1* at the
+    /// neighbor state), and the acceptance test estimates the errors of the
+    /// predictions instead of bounding their first-order changes (see
+    /// @ref primarySpeciesChemicalPotentialsErrorEstimate). This is done only
+    /// within the trust interval *|t| ≤ 1*. Beyond the neighbor state, the
+    /// predictions and the acceptance test remain of first order. The neighbor
+    /// should have the same primary species, so that the chemical
+    /// equilibrium states change smoothly between both.
+    /// @param neighbor The predictor at the neighbor reference state.
+    auto setCurvature(EquilibriumPredictor const& neighbor) -> void;
+
+    /// Set the directional second-order derivatives of the predictor along a given change in *x = (w, c)*.
+    /// @param dx The change *dx = x1 - x0* in *x = (w, c)* from the reference state to a neighbor one (see @ref curvatureDirection).
+    /// @param ddy The change in the directional derivatives *(dy/dx)·dx* of *y = (n, p, q, u[iu])* from the reference state to the neighbor one (see @ref curvature).
+    auto setCurvature(VectorXdConstRef const& dx, VectorXdConstRef const& ddy) -> void;
+
+    /// Perform a Taylor prediction of the chemical state at given conditions.
+    /// This prediction is of first order, or of second order along the
+    /// direction to a neighbor reference state (see @ref setCurvature).
+    /// Only the chemical properties selected in the sensitivity derivatives
+    /// (see EquilibriumSensitivity::selectProperties) are predicted. The
+    /// others are kept at their values in the reference state.
     /// @param[out] state The predicted chemical equilibrium state
     /// @param conditions The conditons at which the chemical equilibrium state must be satisfied
     auto predict(ChemicalState& state, EquilibriumConditions const& conditions) const -> void;
 
-    /// Perform a first-order Taylor prediction of the chemical state at given conditions.
+    /// Perform a Taylor prediction of the chemical state at given conditions.
     /// @param[out] state The predicted chemical equilibrium state
     /// @param dw The change in the values of the input variables *w*.
     /// @param dc The change in the values of the initial amounts of conservative components *c*.
@@ -60,9 +117,86 @@ public:
     /// Perform a first-order Taylor prediction of the chemical potential of a species at given conditions.
     auto speciesChemicalPotentialPredicted(Index ispecies, VectorXdConstRef const& dw, VectorXdConstRef const& dc) const -> double;
 
+    /// Check if the predicted changes in the chemical potentials of the primary species at given conditions are within tolerances.
+    /// This is the acceptance test of a first-order Taylor prediction, in which
+    /// |μ<sub>i</sub> - μ<sub>i</sub><sup>0</sup>| < reltol·|μ<sub>i</sub><sup>0</sup>| + abstol
+    /// must hold for every primary species *i* of the reference state. The
+    /// derivatives of these chemical potentials are stored as the first rows
+    /// of the sensitivity derivatives at construction, so that the test is a
+    /// matrix-vector product evaluated in blocks of contiguous rows, returning
+    /// false as soon as one block fails. If the
+    /// chemical potentials of some primary species are not among the predicted
+    /// chemical properties, the species are tested one at a time instead, and
+    /// the test fails for those species.
+    /// @param x The input variables *w* followed by the amounts of the conservative components *c*.
+    /// @param reltol The relative tolerance on the changes of the chemical potentials of the primary species.
+    /// @param abstol The absolute tolerance on the changes of the chemical potentials of the primary species (in J/mol).
+    /// @note If second-order derivatives are available (see @ref setCurvature),
+    /// the estimated errors of the chemical potentials of the primary species
+    /// are tested instead of their predicted changes (see @ref primarySpeciesChemicalPotentialsErrorEstimate).
+    auto primarySpeciesChemicalPotentialsWithinTolerance(VectorXdConstRef const& x, double reltol, double abstol) const -> bool;
+
+    /// Return the estimated errors in the predicted chemical potentials of the primary species at given conditions (in J/mol).
+    /// Without second-order derivatives, these are the absolute predicted
+    /// changes |μ<sub>i</sub> - μ<sub>i</sub><sup>0</sup>|, which bound the
+    /// error of a first-order prediction. With second-order derivatives along
+    /// *dx* (see @ref setCurvature), the change along *dx* is trusted and the
+    /// error is estimated as |Δμ<sub>i</sub><sup>⊥</sup>| + ½t²|Δ(dμ<sub>i</sub>/dx)·dx|,
+    /// where Δμ<sub>i</sub><sup>⊥</sup> is the first-order change orthogonal to *dx*.
+    /// This is used only within the trust interval *|t| ≤ 1*, beyond which the
+    /// absolute predicted changes are returned as without second-order derivatives.
+    /// @param x The input variables *w* followed by the amounts of the conservative components *c*.
+    auto primarySpeciesChemicalPotentialsErrorEstimate(VectorXdConstRef const& x) const -> VectorXd;
+
     /// Return the chemical potential of a species at given reference conditions.
     auto speciesChemicalPotentialReference(Index ispecies) const -> double;
 
+    /// Return the reference chemical equilibrium state, reconstructed from the data stored in the predictor.
+    auto referenceState() const -> ChemicalState;
+
+    /// Return the input variables *w* at the reference chemical equilibrium state.
+    auto referenceInputVariables() const -> ArrayXdConstRef;
+
+    /// Return the amounts of the conservative components *c* at the reference chemical equilibrium state.
+    auto referenceComponentAmounts() const -> ArrayXdConstRef;
+
+    /// Return the indices of the primary species at the reference chemical equilibrium state.
+    auto referencePrimarySpecies() const -> ArrayXlConstRef;
+
+    /// Return the indices of the entries in the serialized chemical properties *u* that are predicted.
+    auto propertyIndices() const -> Indices const&;
+
+    /// Return the derivatives of *y = (n, p, q, u[iu])* with respect to *x = (w, c)* at the reference chemical equilibrium state.
+    /// These are the sensitivity derivatives given at construction, stored
+    /// in a single contiguous matrix, with *iu* given by @ref propertyIndices.
+    /// The rows of the chemical potentials of the primary species are stored
+    /// first for fast acceptance tests, and this method returns the rows in
+    /// the order of *y*.
+    auto derivatives() const -> MatrixXd;
+
+    /// Return true if the sensitivity derivatives are stored in single precision.
+    auto singlePrecision() const -> bool;
+
+    /// Return the change *dx = x1 - x0* in *x = (w, c)* to the neighbor reference state used for second-order derivatives (empty if not available).
+    auto curvatureDirection() const -> VectorXdConstRef;
+
+    /// Return the change in the directional derivatives *(dy/dx)·dx* of *y = (n, p, q, u[iu])* to the neighbor reference state (empty if not available).
+    auto curvature() const -> VectorXd;
+
+    /// Return the names of the input variables *w* and control variables *p* and *q* used by this predictor.
+    auto names() const -> SharedPtr<Names const> const&;
+
+    /// Share the names of the input variables *w* and control variables *p* and *q* of another predictor of the same chemical equilibrium problem.
+    /// Predictors of the same chemical equilibrium problem (e.g., those in a
+    /// SmartEquilibriumKnowledgeBase object) can then store these names once.
+    /// @param names The names returned by @ref names of the other predictor.
+    auto shareNames(SharedPtr<Names const> const& names) -> void;
+
+    /// Return the number of bytes used by this predictor to store its reference data and sensitivity derivatives.
+    /// The names of the input and control variables are not included, since
+    /// these can be shared among predictors (see @ref shareNames).
+    auto memoryUsage() const -> Index;
+
 private:
     struct Impl;
 
@@ -29,9 +29,25 @@ void exportEquilibriumProjector(py::module& m)
 {
     py::class_<EquilibriumPredictor>(m, "EquilibriumPredictor")
         .def(py::init<ChemicalState const&, EquilibriumSensitivity const&>())
-        .def("predict", py::overload_cast<ChemicalState&, EquilibriumConditions const&>(&EquilibriumPredictor::predict, py::const_), "Perform a first-order Taylor prediction of the chemical state at given conditions.")
-        .def("predict", py::overload_cast<ChemicalState&, VectorXdConstRef const&, VectorXdConstRef const&>(&EquilibriumPredictor::predict, py::const_), "Perform a first-order Taylor prediction of the chemical state at given conditions.")
+        .def(py::init<ChemicalState const&, EquilibriumSensitivity const&, bool>())
+        .def(py::init<ChemicalState const&, Indices const&, MatrixXdConstRef, bool>())
+        .def("setCurvature", py::overload_cast<EquilibriumPredictor const&>(&EquilibriumPredictor::setCurvature), "Set the directional second-order derivatives of the predictor using the reference state and sensitivity derivatives of a neighbor predictor.")
+        .def("setCurvature", py::overload_cast<VectorXdConstRef const&, VectorXdConstRef const&>(&EquilibriumPredictor::setCurvature), "Set the directional second-order derivatives of the predictor along a given change in x = (w, c).")
+        .def("predict", py::overload_cast<ChemicalState&, EquilibriumConditions const&>(&EquilibriumPredictor::predict, py::const_), "Perform a Taylor prediction of the chemical state at given conditions.")
+        .def("predict", py::overload_cast<ChemicalState&, VectorXdConstRef const&, VectorXdConstRef const&>(&EquilibriumPredictor::predict, py::const_), "Perform a Taylor prediction of the chemical state at given conditions.")
         .def("speciesChemicalPotentialPredicted", &EquilibriumPredictor::speciesChemicalPotentialPredicted, "Perform a first-order Taylor prediction of the chemical potential of a species at given conditions.")
+        .def("primarySpeciesChemicalPotentialsWithinTolerance", &EquilibriumPredictor::primarySpeciesChemicalPotentialsWithinTolerance, "Check if the predicted changes in the chemical potentials of the primary species at given conditions are within tolerances.")
+        .def("primarySpeciesChemicalPotentialsErrorEstimate", &EquilibriumPredictor::primarySpeciesChemicalPotentialsErrorEstimate, "Return the estimated errors in the predicted chemical potentials of the primary species at given conditions (in J/mol).")
         .def("speciesChemicalPotentialReference", &EquilibriumPredictor::speciesChemicalPotentialReference, "Return the chemical potential of a species at given reference conditions.")
+        .def("referenceState", &EquilibriumPredictor::referenceState, "Return the reference chemical equilibrium state, reconstructed from the data stored in the predictor.")
+        .def("referenceInputVariables", &EquilibriumPredictor::referenceInputVariables, "Return the input variables w at the reference chemical equilibrium state.")
+        .def("referenceComponentAmounts", &EquilibriumPredictor::referenceComponentAmounts, "Return the amounts of the conservative components c at the reference chemical equilibrium state.")
+        .def("referencePrimarySpecies", &EquilibriumPredictor::referencePrimarySpecies, "Return the indices of the primary species at the reference chemical equilibrium state.")
+        .def("propertyIndices", &EquilibriumPredictor::propertyIndices, "Return the indices of the entries in the serialized chemical properties u that are predicted.")
+        .def("derivatives", &EquilibriumPredictor::derivatives, "Return the derivatives of y = (n, p, q, u[iu]) with respect to x = (w, c) at the reference chemical equilibrium state.")
+        .def("singlePrecision", &EquilibriumPredictor::singlePrecision, "Return true if the sensitivity derivatives are stored in single precision.")
+        .def("curvatureDirection", &EquilibriumPredictor::curvatureDirection, "Return the change dx = x1 - x0 in x = (w, c) to the neighbor reference state used for second-order derivatives (empty if not available).")
+        .def("curvature", &EquilibriumPredictor::curvature, "Return the change in the directional derivatives (dy/dx)*dx of y = (n, p, q, u[iu]) to the neighbor reference state (empty if not available).")
+        .def("memoryUsage", &EquilibriumPredictor::memoryUsage, "Return the number of bytes used by this predictor to store its reference data and sensitivity derivatives.")
         ;
 }
@@ -27,6 +27,7 @@
 #include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
+#include <Reaktoro/Math/MathUtils.hpp>
 using namespace Reaktoro;
 
 auto createStandardThermoModelH2O() -> StandardThermoModel
@@ -158,6 +159,70 @@ TEST_CASE("Testing EquilibriumPredictor", "[EquilibriumPredictor]")
             CHECK( predictor.speciesChemicalPotentialReference(i) == Approx(props0.speciesChemicalPotential(i)) );
             CHECK( predictor.speciesChemicalPotentialPredicted(i, dw, dc) == Approx(props.speciesChemicalPotential(i)) );
         }
+
+        // Check EquilibriumPredictor::primarySpeciesChemicalPotentialsWithinTolerance against a test on each primary species
+        VectorXd x(w.size() + c.size());
+        x << w, c;
+
+        for(auto reltol : { 1e-6, 1e-3, 1e-1 })
+        {
+            auto expected = true;
+            for(auto i : state0.equilibrium().indicesPrimarySpecies())
+            {
+                const auto mu0 = predictor.speciesChemicalPotentialReference(i);
+                const auto mu1 = predictor.speciesChemicalPotentialPredicted(i, dw, dc);
+                expected = expected && std::abs(mu1 - mu0) < reltol * std::abs(mu0) + 1.0;
+            }
+            CHECK( predictor.primarySpeciesChemicalPotentialsWithinTolerance(x, reltol, 1.0) == expected );
+        }
+
+        CHECK( predictor.primarySpeciesChemicalPotentialsWithinTolerance(x, 1e+3, 1.0) ); // large enough tolerance
+        CHECK_FALSE( predictor.primarySpeciesChemicalPotentialsWithinTolerance(x, 0.0, 0.0) ); // zero tolerance
+
+        // Check the reference data stored in compact form in the predictor
+        const ChemicalState refstate = predictor.referenceState();
+
+        CHECK( VectorXd(refstate.speciesAmounts()).isApprox(n0) );
+        CHECK( VectorXd(refstate.props()).isApprox(u0) );
+        CHECK( VectorXd(refstate.equilibrium().p()).isApprox(p0) );
+        CHECK( VectorXd(refstate.equilibrium().c()).isApprox(c0) );
+        CHECK( refstate.temperature() == Approx(300.0) );
+        CHECK( refstate.pressure() == Approx(1.0e5) );
+
+        const MatrixXd derivatives = predictor.derivatives();
+
+        CHECK( derivatives.rows() == n.size() + p.size() + q.size() + u.size() );
+        CHECK( derivatives.cols() == w.size() + c.size() );
+        CHECK( derivatives.topLeftCorner(n.size(), w.size()).isApprox(dndw0) );
+        CHECK( derivatives.bottomRightCorner(u.size(), c.size()).isApprox(dudc0) );
+
+        // Check EquilibriumPredictor with sensitivity derivatives stored in single precision
+        EquilibriumPredictor predictorsp(state0, sensitivity0, true);
+
+        CHECK( predictorsp.singlePrecision() );
+        CHECK( predictorsp.memoryUsage() < predictor.memoryUsage() );
+
+        ChemicalState statesp(state);
+        predictorsp.predict(statesp, conditions);
+
+        CHECK( largestRelativeDifference(statesp.speciesAmounts(), state.speciesAmounts()) < 1e-4 );
+
+        for(auto i = 0; i < n.size(); ++i)
+            CHECK( predictorsp.speciesChemicalPotentialPredicted(i, dw, dc) == Approx(props.speciesChemicalPotential(i)).epsilon(1e-5) );
+
+        // Check EquilibriumPredictor constructed with derivatives returned by another predictor
+        EquilibriumPredictor predictorcopy(refstate, predictor.propertyIndices(), derivatives, false);
+
+        ChemicalState statecopy(state);
+        predictorcopy.predict(statecopy, conditions);
+
+        CHECK( VectorXd(statecopy.speciesAmounts()).isApprox(n) );
+        CHECK( VectorXd(statecopy.props()).isApprox(u) );
+
+        // Check the acceptance test when the chemical potentials of the primary species are not among the predicted chemical properties (it fails instead of raising an error)
+        EquilibriumPredictor predictornomu(refstate, Indices{}, derivatives.topRows(n.size() + p.size() + q.size()), false);
+
+        CHECK_FALSE( predictornomu.primarySpeciesChemicalPotentialsWithinTolerance(x, 1e+3, 1.0) );
     }
 
     SECTION("when the system is closed, temperature and pressure given, O2 is a meta-stable basic species - sensitivity derivatives should be zero")
@@ -322,4 +387,204 @@ TEST_CASE("Testing EquilibriumPredictor", "[EquilibriumPredictor]")
             CHECK( predictor.speciesChemicalPotentialPredicted(i, dw, dc) == Approx(props.speciesChemicalPotential(i)) );
         }
     }
+
+    SECTION("when second-order derivatives are estimated with a neighbor reference state")
+    {
+        EquilibriumSpecs specs(system);
+        specs.temperature(); // specify temperature is constrained
+        specs.pressure();    // specify pressure is constrained
+
+        EquilibriumSolver solver(specs);
+
+        // Return the chemical equilibrium state and its sensitivity derivatives at a given temperature
+        auto equilibrate = [&](double T)
+        {
+            EquilibriumConditions conditions(specs);
+            conditions.temperature(T);
+            conditions.pressure(1.0e5);
+
+            ChemicalState state(system);
+            state.set("H2O" , 55.00, "mol");
+            state.set("NaCl", 0.100, "mol");
+            state.set("O2"  , 0.001, "mol");
+
+            EquilibriumSensitivity sensitivity(specs);
+            solver.solve(state, sensitivity, conditions);
+            state.props().update(state);
+
+            return std::make_pair(state, sensitivity);
+        };
+
+        const auto [state0, sensitivity0] = equilibrate(300.0);
+        const auto [state1, sensitivity1] = equilibrate(320.0);
+        const auto [statem, sensitivitym] = equilibrate(310.0);
+
+        EquilibriumPredictor predictor1st(state0, sensitivity0);
+        EquilibriumPredictor predictor2nd(state0, sensitivity0);
+        EquilibriumPredictor predictor1(state1, sensitivity1);
+
+        CHECK( predictor2nd.curvatureDirection().size() == 0 );
+        CHECK_THROWS( predictor2nd.setCurvature(predictor2nd) ); // the neighbor state must differ from the reference state
+
+        predictor2nd.setCurvature(predictor1);
+
+        const VectorXd w0 = state0.equilibrium().w();
+        const VectorXd c0 = state0.equilibrium().c();
+        const VectorXd w1 = state1.equilibrium().w();
+        const VectorXd c1 = state1.equilibrium().c();
+
+        VectorXd x0(w0.size() + c0.size());
+        VectorXd x1(w1.size() + c1.size());
+        x0 << w0, c0;
+        x1 << w1, c1;
+
+        const VectorXd dx = x1 - x0;
+        const MatrixXd J0 = predictor1st.derivatives();
+        const MatrixXd J1 = predictor1.derivatives();
+
+        CHECK( predictor2nd.curvatureDirection().isApprox(dx) );
+        CHECK( predictor2nd.curvature().isApprox((J1 - J0) * dx) );
+        CHECK( predictor2nd.memoryUsage() > predictor1st.memoryUsage() );
+
+        // At the neighbor state, the second-order prediction is the trapezoidal rule n0 + (J0 + J1)dx/2
+        ChemicalState state(state1);
+        predictor2nd.predict(state, dx.head(w0.size()), dx.tail(c0.size()));
+
+        const auto Nn = system.species().size();
+        const VectorXd n0 = state0.speciesAmounts();
+        const VectorXd n = n0 + 0.5 * (J0 + J1).topRows(Nn) * dx;
+
+        CHECK( VectorXd(state.speciesAmounts()).isApprox(n) );
+
+        // At the neighbor state, the change in the inputs is along the direction to it, so only the second-order term is in the error estimate
+        const VectorXd errors = predictor2nd.primarySpeciesChemicalPotentialsErrorEstimate(x1);
+        const VectorXd ddy = predictor2nd.curvature();
+        const auto iprimary = state0.equilibrium().indicesPrimarySpecies();
+        const auto Nyu = J0.rows() - Nn; // the chemical potentials of the species are the last Nn rows in the derivatives
+
+        for(auto k = 0; k < iprimary.size(); ++k)
+            CHECK( errors[k] == Approx(0.5 * std::abs(ddy[Nyu + iprimary[k]])) );
+
+        // The second-order prediction is more accurate than the first-order one between both reference states
+        const VectorXd dxm = 0.5 * dx;
+
+        ChemicalState statem1st(statem);
+        ChemicalState statem2nd(statem);
+        predictor1st.predict(statem1st, dxm.head(w0.size()), dxm.tail(c0.size()));
+        predictor2nd.predict(statem2nd, dxm.head(w0.size()), dxm.tail(c0.size()));
+
+        const VectorXd nm = statem.speciesAmounts();
+        const VectorXd nm1st = statem1st.speciesAmounts();
+        const VectorXd nm2nd = statem2nd.speciesAmounts();
+
+        CHECK( (nm2nd - nm).norm() < (nm1st - nm).norm() );
+
+        // The error estimates of the second-order predictor along the direction to the neighbor are smaller than the first-order ones
+        const VectorXd xm = x0 + dxm;
+
+        const auto errorm1st = predictor1st.primarySpeciesChemicalPotentialsErrorEstimate(xm).maxCoeff();
+        const auto errorm2nd = predictor2nd.primarySpeciesChemicalPotentialsErrorEstimate(xm).maxCoeff();
+
+        CHECK( errorm2nd < errorm1st );
+
+        // With an absolute tolerance between both error estimates, the second-order acceptance test succeeds where the first-order one fails
+        const auto abstol = 0.5 * (errorm1st + errorm2nd);
+
+        CHECK( predictor2nd.primarySpeciesChemicalPotentialsWithinTolerance(xm, 0.0, abstol) );
+        CHECK_FALSE( predictor1st.primarySpeciesChemicalPotentialsWithinTolerance(xm, 0.0, abstol) );
+
+        // Beyond the neighbor state, the second-order derivatives are not trusted, and the predictions and their error estimates are of first order
+        const VectorXd dxf = 3.0 * dx;
+        const VectorXd xf = x0 + dxf;
+
+        CHECK( predictor2nd.primarySpeciesChemicalPotentialsErrorEstimate(xf).isApprox(predictor1st.primarySpeciesChemicalPotentialsErrorEstimate(xf)) );
+
+        ChemicalState statef1st(state0);
+        ChemicalState statef2nd(state0);
+        predictor1st.predict(statef1st, dxf.head(w0.size()), dxf.tail(c0.size()));
+        predictor2nd.predict(statef2nd, dxf.head(w0.size()), dxf.tail(c0.size()));
+
+        CHECK( VectorXd(statef2nd.speciesAmounts()).isApprox(VectorXd(statef1st.speciesAmounts())) );
+    }
+
+    SECTION("when only the sensitivity derivatives of the chemical potentials of the species are computed")
+    {
+        EquilibriumSpecs specs(system);
+        specs.temperature(); // specify temperature is constrained
+        specs.pressure();    // specify pressure is constrained
+
+        EquilibriumConditions conditions0(specs);
+        conditions0.temperature(300.0);
+        conditions0.pressure(1.0e5);
+
+        ChemicalState state0(system);
+        state0.set("H2O" , 55.00, "mol");
+        state0.set("NaCl", 0.100, "mol");
+        state0.set("O2"  , 0.001, "mol");
+
+        EquilibriumSolver solver(specs);
+
+        EquilibriumSensitivity sensitivity_all(specs);
+        ChemicalState state_all = state0;
+        solver.solve(state_all, sensitivity_all, conditions0);
+
+        EquilibriumSensitivity sensitivity0(specs);
+        sensitivity0.selectSpeciesChemicalPotentials();
+        solver.solve(state0, sensitivity0, conditions0);
+
+        const auto Nn = system.species().size();
+        const auto Nu = sensitivity_all.dudw().rows();
+
+        CHECK( sensitivity_all.allPropertiesSelected() );
+        CHECK( sensitivity_all.propertyIndices().size() == Nu );
+        CHECK( sensitivity0.propertyIndices().size() == Nn );
+        CHECK( sensitivity0.propertyIndices().front() == Nu - Nn );
+
+        CHECK( sensitivity0.dndw().isApprox(sensitivity_all.dndw()) );
+        CHECK( sensitivity0.dndc().isApprox(sensitivity_all.dndc()) );
+        CHECK( sensitivity0.dudw().isApprox(sensitivity_all.dudw().bottomRows(Nn)) );
+        CHECK( sensitivity0.dudc().isApprox(sensitivity_all.dudc().bottomRows(Nn)) );
+
+        state0.props().update(state0);
+        EquilibriumPredictor predictor(state0, sensitivity0);
+
+        ChemicalState state(system);
+        state.set("H2O" , 55.50, "mol");
+        state.set("NaCl", 0.150, "mol");
+        state.set("O2"  , 0.002, "mol");
+
+        EquilibriumConditions conditions(specs);
+        conditions.temperature(330.0);
+        conditions.pressure(1.1e5);
+
+        const VectorXd w = conditions.inputValues();
+        const VectorXd c = conditions.initialComponentAmountsGetOrCompute(state);
+
+        const VectorXd w0 = conditions0.inputValues();
+        const VectorXd c0 = state0.equilibrium().c();
+
+        const VectorXd dw = w - w0;
+        const VectorXd dc = c - c0;
+
+        const VectorXd u0 = state0.props();
+        const VectorXd mu = u0.tail(Nn) + sensitivity0.dudw()*dw + sensitivity0.dudc()*dc;
+
+        for(auto i = 0; i < Nn; ++i)
+            CHECK( predictor.speciesChemicalPotentialPredicted(i, dw, dc) == Approx(mu[i]) );
+
+        predictor.predict(state, conditions);
+
+        const VectorXd u = state.props();
+
+        CHECK( u.tail(Nn).isApprox(mu) );
+        CHECK( u.head(Nu - Nn).isApprox(u0.head(Nu - Nn)) ); // the other chemical properties are kept at their reference values
+
+        // Check that no total derivatives of chemical properties are computed if none is selected
+        sensitivity0.selectProperties({});
+        solver.solve(state0, sensitivity0, conditions0);
+
+        CHECK( sensitivity0.dudw().rows() == 0 );
+        CHECK( sensitivity0.dudc().rows() == 0 );
+        CHECK( sensitivity0.dndw().isApprox(sensitivity_all.dndw()) );
+    }
 }
@@ -20,8 +20,10 @@
 // Reaktoro includes
 #include <Reaktoro/Common/ArrayStream.hpp>
 #include <Reaktoro/Common/Enumerate.hpp>
+#include <Reaktoro/Core/ActivityProps.hpp>
 #include <Reaktoro/Core/ChemicalProps.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumDims.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
@@ -72,18 +74,36 @@ struct EquilibriumProps::Impl
     PropertyGetterFn const getT;       ///< The temperature getter function for the given equilibrium specifications.
     PropertyGetterFn const getP;       ///< The pressure getter function for the given equilibrium specifications.
     MatrixXd dudnpw;                   ///< The partial derivatives of the serialized chemical properties *u* with respect to *(n, p, w)*.
-    ArrayStream<real> stream;          ///< The array stream used during serialize and deserialize of chemical properties.
     bool assemblying_jacobian = false; ///< The flag indicating if the full Jacobian matrix is been constructed.
+    Indices phaseoffsets;              ///< The index of the first species in each phase.
+    Vec<ActivityProps> aprops;         ///< The auxiliary activity properties of each phase used to evaluate their activity models with analytic derivatives.
+    Vec<ActivityJacobian> jacobians;   ///< The analytic derivatives of the activities of the species in each phase.
+    ArrayXr xp;                        ///< The auxiliary mole fractions of the species in a phase.
 
     /// Construct an EquilibriumProps::Impl object.
     Impl(const EquilibriumSpecs& specs)
     : state(specs.system()), specs(specs), dims(specs), getT(createTemperatureGetterFn(specs)), getP(createPressureGetterFn(specs))
     {
         // Initialize Jacobian matrix dudnpw with zeros (to avoid uninitialized values)
+        ArrayStream<real> stream;
         state.props().serialize(stream);
         const auto Nu = stream.data().rows();
         const auto Nnpw = dims.Nn + dims.Np + dims.Nw;
         dudnpw = zeros(Nu, Nnpw);
+
+        // Initialize the auxiliary activity properties used to evaluate the analytic derivatives of the activity models
+        auto const& phases = specs.system().phases();
+        phaseoffsets.resize(phases.size());
+        aprops.resize(phases.size());
+        jacobians.resize(phases.size());
+        auto offset = 0;
+        for(auto i = 0; i < phases.size(); ++i)
+        {
+            const auto length = phases[i].species().size();
+            phaseoffsets[i] = offset;
+            aprops[i] = ActivityProps::create(length);
+            offset += length;
+        }
     }
 
     /// Update the chemical properties of the chemical system.
@@ -108,14 +128,47 @@ struct EquilibriumProps::Impl
         {
             const auto Nnpw = dims.Nn + dims.Np + dims.Nw;
             assert(inpw < Nnpw);
-            state.props().serialize(stream);
-            auto col = dudnpw.col(inpw);
-            const auto size = col.size();
-            for(auto i = 0; i < size; ++i)
-                col[i] = grad(stream.data()[i]);
+            state.props().gatherGrad(dudnpw.col(inpw));
         }
     }
 
+    /// Compute the derivatives *∂(µ/RT)/∂n* of the species in a phase with the analytic derivatives of its activity model.
+    auto dudnPhase(Index iphase, VectorXrConstRef n, VectorXrConstRef p, VectorXrConstRef w, bool useIdealModel, MatrixXdRef dudnp) -> bool
+    {
+        auto const& phase = specs.system().phase(iphase);
+        const auto offset = phaseoffsets[iphase];
+        const auto length = phase.species().size();
+
+        const auto np = n.segment(offset, length);
+        const auto nsum = np.sum();
+        if(nsum == 0.0)
+            return false;
+
+        xp = np.array()/nsum;
+
+        auto const T = getT(p, w);
+        auto const P = getP(p, w);
+
+        auto const& model = useIdealModel ? phase.idealActivityModel() : phase.activityModel();
+
+        auto& jac = jacobians[iphase];
+        jac.available = false;
+        aprops[iphase].jacobian = &jac;
+        model(aprops[iphase], { T, P, xp });
+        aprops[iphase].jacobian = nullptr;
+
+        if(!jac.available)
+            return false;
+
+        // Convert the derivatives with respect to mole fractions into derivatives with respect to species amounts (µ/RT = µ°/RT + ln(a))
+        const VectorXd xd = xp.matrix().cast<double>();
+        dudnp.noalias() = jac.ln_a_x;
+        dudnp.colwise() -= jac.ln_a_x * xd;
+        dudnp /= double(nsum);
+
+        return true;
+    }
+
     /// Return the partial derivatives *du/dn*.
     auto dudn() const -> MatrixXdConstRef
     {
@@ -162,6 +215,11 @@ auto EquilibriumProps::update(VectorXrConstRef n, VectorXrConstRef p, VectorXrCo
     pimpl->update(n, p, w, useIdealModel, inpw);
 }
 
+auto EquilibriumProps::dudnPhase(Index iphase, VectorXrConstRef n, VectorXrConstRef p, VectorXrConstRef w, bool useIdealModel, MatrixXdRef dudnp) -> bool
+{
+    return pimpl->dudnPhase(iphase, n, p, w, useIdealModel, dudnp);
+}
+
 auto EquilibriumProps::assembleFullJacobianBegin() -> void
 {
     pimpl->assemblying_jacobian = true;
@@ -69,6 +69,22 @@ public:
     /// @param inpw The index of the variable in (n, p, w) currently seeded for autodiff computation.
     auto update(VectorXrConstRef n, VectorXrConstRef p, VectorXrConstRef w, bool useIdealModel, long inpw) -> void;
 
+    /// Compute the derivatives *∂(µ/RT)/∂n* of the species in a phase with the analytic derivatives of its activity model.
+    /// This uses the derivatives of the activities with respect to mole
+    /// fractions that the activity model of the phase computes when requested
+    /// via ActivityPropsBase::jacobian, without automatic differentiation.
+    /// The chemical properties of the system are not updated. The derivatives
+    /// with respect to *p* and *w* (e.g., temperature and pressure) are still
+    /// computed with automatic differentiation (see @ref dudp and @ref dudw).
+    /// @param iphase The index of the phase.
+    /// @param n The amounts of the species.
+    /// @param p The values of the *p* control variables (e.g., T, P, n[H+] in case U, V and pH are given).
+    /// @param w The input variables *w* in the chemical equilibrium problem (e.g., U, V, pH).
+    /// @param useIdealModel If true, the ideal activity model of the phase is used.
+    /// @param[out] dudnp The derivatives *∂(µ/RT)/∂n* of the species in the phase with respect to their amounts.
+    /// @return False if the activity model does not provide analytic derivatives or the phase has no species amounts, in which case `dudnp` is not changed.
+    auto dudnPhase(Index iphase, VectorXrConstRef n, VectorXrConstRef p, VectorXrConstRef w, bool useIdealModel, MatrixXdRef dudnp) -> bool;
+
     /// Enable recording of derivatives of the chemical properties with respect
     /// to *(n, p, w)* to contruct its full Jacobian matrix.
     /// Consider a series of forward automatic differentiation passes to
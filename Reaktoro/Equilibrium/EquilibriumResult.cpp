@@ -19,10 +19,51 @@
 
 namespace Reaktoro {
 
+auto EquilibriumProfiling::operator+=(EquilibriumProfiling const& other) -> EquilibriumProfiling&
+{
+    solve += other.solve;
+    optima += other.optima;
+    retry += other.retry;
+    evaluations += other.evaluations;
+    linear_solves += other.linear_solves;
+    chemical_props += other.chemical_props;
+    standard_thermo += other.standard_thermo;
+    activity += other.activity;
+    hessian += other.hessian;
+    grad_p += other.grad_p;
+    grad_w += other.grad_w;
+
+    return *this;
+}
+
 auto EquilibriumResult::operator+=(const EquilibriumResult& other) -> EquilibriumResult&
 {
     optima += other.optima;
+    profiling += other.profiling;
+    hessian_refreshes += other.hessian_refreshes;
+    hessian_reuses += other.hessian_reuses;
     return *this;
 }
 
+auto EquilibriumBatchResult::succeeded() const -> bool
+{
+    for(auto const& result : results)
+        if(result.failed())
+            return false;
+    return true;
+}
+
+auto EquilibriumBatchResult::failed() const -> bool
+{
+    return !succeeded();
+}
+
+auto EquilibriumBatchResult::iterations() const -> Index
+{
+    Index sum = 0;
+    for(auto const& result : results)
+        sum += result.iterations();
+    return sum;
+}
+
 } // namespace Reaktoro
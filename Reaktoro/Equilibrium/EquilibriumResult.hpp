@@ -20,8 +20,57 @@
 // Optima includes
 #include <Optima/Result.hpp>
 
+// Reaktoro includes
+#include <Reaktoro/Common/Profiling.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
 namespace Reaktoro {
 
+/// Used to provide profiling information of the operations during a chemical equilibrium calculation.
+/// This information is only recorded if EquilibriumOptions::profiling is
+/// true. No recording code is compiled if Reaktoro is built with
+/// `REAKTORO_DISABLE_PROFILING` defined.
+struct EquilibriumProfiling
+{
+    /// The calls to EquilibriumSolver::solve.
+    ProfilingCounter solve;
+
+    /// The calls to the Optima solver (more than one per solve call if the retry path is taken).
+    ProfilingCounter optima;
+
+    /// The retries of a failed calculation with alternative Optima options in EquilibriumSolver::solve.
+    ProfilingCounter retry;
+
+    /// The evaluations of the chemical properties and their derivatives requested by the Optima solver.
+    ProfilingCounter evaluations;
+
+    /// The linear solves in the Optima solver, one per iteration.
+    /// Their elapsed time is estimated as the time spent in the Optima solver
+    /// outside the evaluations of chemical properties and their derivatives.
+    ProfilingCounter linear_solves;
+
+    /// The updates of the chemical properties of the system.
+    ProfilingCounter chemical_props;
+
+    /// The evaluations of the standard thermodynamic models of the species in a phase.
+    ProfilingCounter standard_thermo;
+
+    /// The evaluations of the activity model of a phase.
+    ProfilingCounter activity;
+
+    /// The assemblies of the Hessian matrix of the Gibbs energy function with respect to *x = (n, q)*.
+    ProfilingCounter hessian;
+
+    /// The assemblies of the derivatives with respect to the *p* control variables (EquilibriumSetup::updateGradP).
+    ProfilingCounter grad_p;
+
+    /// The assemblies of the derivatives with respect to the input variables *w* (EquilibriumSetup::updateGradW).
+    ProfilingCounter grad_w;
+
+    /// Self addition of another EquilibriumProfiling instance to this one.
+    auto operator+=(EquilibriumProfiling const& other) -> EquilibriumProfiling&;
+};
+
 /// A type used to describe the result of an equilibrium calculation
 /// @see ChemicalState
 struct EquilibriumResult
@@ -38,8 +87,46 @@ struct EquilibriumResult
     /// The result of the optimisation calculation using Optima.
     Optima::Result optima;
 
+    /// The profiling information of the calculation (recorded only if EquilibriumOptions::profiling is true).
+    EquilibriumProfiling profiling;
+
+    /// The number of times the Hessian matrix of the Gibbs energy function was computed in the calculation.
+    Index hessian_refreshes = 0;
+
+    /// The number of times the Hessian matrix of the Gibbs energy function of a previous iteration was reused in the calculation (see EquilibriumOptions::hessian_reuse).
+    Index hessian_reuses = 0;
+
     /// Apply an addition assignment to this instance
     auto operator+=(const EquilibriumResult& other) -> EquilibriumResult&;
 };
 
+/// A type used to describe the result of a batch of equilibrium calculations
+/// @see EquilibriumSolver
+struct EquilibriumBatchResult
+{
+    /// Return true if all calculations in the batch succeeded.
+    auto succeeded() const -> bool;
+
+    /// Return true if at least one calculation in the batch failed.
+    auto failed() const -> bool;
+
+    /// Return the total number of iterations of all calculations in the batch.
+    auto iterations() const -> Index;
+
+    /// The result of each equilibrium calculation in the batch, in the same order as the chemical states.
+    Vec<EquilibriumResult> results;
+
+    /// The elapsed time of each equilibrium calculation in the batch (in s).
+    Vec<double> timings;
+
+    /// The elapsed wall-clock time of the entire batch of equilibrium calculations (in s).
+    double time_wall = 0.0;
+
+    /// The sum of the elapsed times of all equilibrium calculations in the batch (in s).
+    double time_total = 0.0;
+
+    /// The number of threads used to perform the batch of equilibrium calculations.
+    Index num_threads = 0;
+};
+
 } // namespace Reaktoro
@@ -24,11 +24,49 @@ using namespace Reaktoro;
 
 void exportEquilibriumResult(py::module& m)
 {
+    py::class_<ProfilingCounter>(m, "ProfilingCounter")
+        .def(py::init<>())
+        .def_readwrite("count", &ProfilingCounter::count, "The number of executions of the operation.")
+        .def_readwrite("time", &ProfilingCounter::time, "The accumulated elapsed time of the executions of the operation (in seconds).")
+        .def(py::self += py::self)
+        ;
+
+    py::class_<EquilibriumProfiling>(m, "EquilibriumProfiling")
+        .def(py::init<>())
+        .def_readwrite("solve", &EquilibriumProfiling::solve, "The calls to EquilibriumSolver::solve.")
+        .def_readwrite("optima", &EquilibriumProfiling::optima, "The calls to the Optima solver (more than one per solve call if the retry path is taken).")
+        .def_readwrite("retry", &EquilibriumProfiling::retry, "The retries of a failed calculation with alternative Optima options in EquilibriumSolver::solve.")
+        .def_readwrite("evaluations", &EquilibriumProfiling::evaluations, "The evaluations of the chemical properties and their derivatives requested by the Optima solver.")
+        .def_readwrite("linear_solves", &EquilibriumProfiling::linear_solves, "The linear solves in the Optima solver, one per iteration.")
+        .def_readwrite("chemical_props", &EquilibriumProfiling::chemical_props, "The updates of the chemical properties of the system.")
+        .def_readwrite("standard_thermo", &EquilibriumProfiling::standard_thermo, "The evaluations of the standard thermodynamic models of the species in a phase.")
+        .def_readwrite("activity", &EquilibriumProfiling::activity, "The evaluations of the activity model of a phase.")
+        .def_readwrite("hessian", &EquilibriumProfiling::hessian, "The assemblies of the Hessian matrix of the Gibbs energy function with respect to x = (n, q).")
+        .def_readwrite("grad_p", &EquilibriumProfiling::grad_p, "The assemblies of the derivatives with respect to the p control variables.")
+        .def_readwrite("grad_w", &EquilibriumProfiling::grad_w, "The assemblies of the derivatives with respect to the input variables w.")
+        .def(py::self += py::self)
+        ;
+
     py::class_<EquilibriumResult>(m, "EquilibriumResult")
         .def(py::init<>())
         .def("succeeded", &EquilibriumResult::succeeded, "Return true if the calculation succeeded.")
         .def("failed", &EquilibriumResult::failed, "Return true if the calculation failed.")
         .def("iterations", &EquilibriumResult::iterations, "Return the number of iterations in the calculation.")
         .def_readwrite("optima", &EquilibriumResult::optima)
+        .def_readwrite("profiling", &EquilibriumResult::profiling)
+        .def_readwrite("hessian_refreshes", &EquilibriumResult::hessian_refreshes)
+        .def_readwrite("hessian_reuses", &EquilibriumResult::hessian_reuses)
+        ;
+
+    py::class_<EquilibriumBatchResult>(m, "EquilibriumBatchResult")
+        .def(py::init<>())
+        .def("succeeded", &EquilibriumBatchResult::succeeded, "Return true if all calculations in the batch succeeded.")
+        .def("failed", &EquilibriumBatchResult::failed, "Return true if at least one calculation in the batch failed.")
+        .def("iterations", &EquilibriumBatchResult::iterations, "Return the total number of iterations of all calculations in the batch.")
+        .def_readwrite("results", &EquilibriumBatchResult::results)
+        .def_readwrite("timings", &EquilibriumBatchResult::timings)
+        .def_readwrite("time_wall", &EquilibriumBatchResult::time_wall)
+        .def_readwrite("time_total", &EquilibriumBatchResult::time_total)
+        .def_readwrite("num_threads", &EquilibriumBatchResult::num_threads)
         ;
 }
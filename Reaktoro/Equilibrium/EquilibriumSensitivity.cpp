@@ -17,7 +17,11 @@
 
 #include "EquilibriumSensitivity.hpp"
 
+// C++ includes
+#include <numeric>
+
 // Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumDims.hpp>
 
 namespace Reaktoro {
@@ -51,6 +55,59 @@ auto EquilibriumSensitivity::initialize(EquilibriumSpecs const& specs) -> void
     mdqdc.resize(Nq, Nc);
 }
 
+auto EquilibriumSensitivity::selectAllProperties() -> void
+{
+    mselectall = true;
+    mselectmu = false;
+    mselected.clear();
+}
+
+auto EquilibriumSensitivity::selectSpeciesChemicalPotentials() -> void
+{
+    mselectall = false;
+    mselectmu = true;
+    mselected.clear();
+}
+
+auto EquilibriumSensitivity::selectProperties(Indices const& iu) -> void
+{
+    mselectall = false;
+    mselectmu = false;
+    mselected = iu;
+}
+
+auto EquilibriumSensitivity::allPropertiesSelected() const -> bool
+{
+    return mselectall;
+}
+
+auto EquilibriumSensitivity::updatePropertyIndices(Index Nu) -> void
+{
+    if(mselectall)
+    {
+        miu.resize(Nu);
+        std::iota(miu.begin(), miu.end(), 0);
+    }
+    else if(mselectmu)
+    {
+        const auto Nn = msystem.species().size();
+        errorif(Nn > Nu, "Expecting the serialized chemical properties to contain the chemical potentials of the ", Nn, " species, but its size is ", Nu, ".");
+        miu.resize(Nn);
+        std::iota(miu.begin(), miu.end(), Nu - Nn); // the chemical potentials of the species are the last Nn entries in u
+    }
+    else
+    {
+        for(auto i : mselected)
+            errorif(i >= Nu, "The selected entry ", i, " in the serialized chemical properties is out of range (its size is ", Nu, ").");
+        miu = mselected;
+    }
+}
+
+auto EquilibriumSensitivity::propertyIndices() const -> Indices const&
+{
+    return miu;
+}
+
 auto EquilibriumSensitivity::dndw(String const& wid) const -> VectorXdConstRef
 {
     const auto idx = index(minputs, wid);
@@ -43,8 +43,36 @@ public:
     explicit EquilibriumSensitivity(EquilibriumSpecs const& specs);
 
     /// Initialize this EquilibriumSensitivity object with given equilibrium problem specifications.
+    /// The selection of chemical properties whose total derivatives are
+    /// computed (see @ref selectAllProperties) is not changed.
     auto initialize(EquilibriumSpecs const& specs) -> void;
 
+    //======================================================================
+    // SELECTION OF CHEMICAL PROPERTIES WITH COMPUTED TOTAL DERIVATIVES
+    //======================================================================
+
+    /// Select all chemical properties *u* for the computation of their total derivatives (the default).
+    auto selectAllProperties() -> void;
+
+    /// Select only the chemical potentials of the species for the computation of total derivatives of chemical properties *u*.
+    auto selectSpeciesChemicalPotentials() -> void;
+
+    /// Select given entries in the serialized chemical properties *u* for the computation of their total derivatives.
+    /// Use an empty list of indices if only the derivatives of the species
+    /// amounts and control variables are needed, in which case no total
+    /// derivatives of chemical properties are computed.
+    /// @param iu The indices of the selected entries in *u* (see ChemicalProps::serialize).
+    auto selectProperties(Indices const& iu) -> void;
+
+    /// Return true if all chemical properties *u* are selected for the computation of their total derivatives.
+    auto allPropertiesSelected() const -> bool;
+
+    /// Update the indices of the selected entries in the serialized chemical properties *u* for given size of *u*.
+    auto updatePropertyIndices(Index Nu) -> void;
+
+    /// Return the indices of the entries in the serialized chemical properties *u* corresponding to the rows of @ref dudw and @ref dudc.
+    auto propertyIndices() const -> Indices const&;
+
     //======================================================================
     // DERIVATIVES OF SPECIES AMOUNTS WITH RESPECT TO INPUT PARAMETERS
     //======================================================================
@@ -122,9 +150,11 @@ public:
     //======================================================================
 
     /// Return the total derivatives of the chemical properties *u* with respect to input variables *w*.
+    /// Only the rows of the selected chemical properties are available (see @ref propertyIndices).
     auto dudw() const -> MatrixXdConstRef;
 
     /// Return the total derivatives of the chemical properties *u* with respect to component amounts *c*.
+    /// Only the rows of the selected chemical properties are available (see @ref propertyIndices).
     auto dudc() const -> MatrixXdConstRef;
 
     /// Set the total derivatives of the chemical properties *u* with respect to input variables *w*.
@@ -163,6 +193,18 @@ private:
 
     /// The total derivatives of the chemical properties *u* with respect to component amounts *c*.
     MatrixXd mdudc;
+
+    /// The flag indicating if all chemical properties are selected for the computation of their total derivatives.
+    bool mselectall = true;
+
+    /// The flag indicating if the chemical potentials of the species are selected for the computation of their total derivatives.
+    bool mselectmu = false;
+
+    /// The indices of the selected entries in *u* when neither all chemical properties nor the chemical potentials of the species are selected.
+    Indices mselected;
+
+    /// The indices of the entries in *u* corresponding to the rows of *du/dw* and *du/dc*.
+    Indices miu;
 };
 
 } // namespace Reaktoro
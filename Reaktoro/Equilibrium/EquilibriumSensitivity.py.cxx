@@ -31,6 +31,12 @@ void exportEquilibriumSensitivity(py::module& m)
         .def(py::init<>())
         .def(py::init<EquilibriumSpecs const&>())
         .def("initialize", &EquilibriumSensitivity::initialize, "Initialize this EquilibriumSensitivity object with given equilibrium problem specifications.")
+        .def("selectAllProperties", &EquilibriumSensitivity::selectAllProperties, "Select all chemical properties u for the computation of their total derivatives (the default).")
+        .def("selectSpeciesChemicalPotentials", &EquilibriumSensitivity::selectSpeciesChemicalPotentials, "Select only the chemical potentials of the species for the computation of total derivatives of chemical properties u.")
+        .def("selectProperties", &EquilibriumSensitivity::selectProperties, "Select given entries in the serialized chemical properties u for the computation of their total derivatives.")
+        .def("allPropertiesSelected", &EquilibriumSensitivity::allPropertiesSelected, "Return true if all chemical properties u are selected for the computation of their total derivatives.")
+        .def("updatePropertyIndices", &EquilibriumSensitivity::updatePropertyIndices, "Update the indices of the selected entries in the serialized chemical properties u for given size of u.")
+        .def("propertyIndices", &EquilibriumSensitivity::propertyIndices, return_internal_ref, "Return the indices of the entries in the serialized chemical properties u corresponding to the rows of dudw and dudc.")
         .def("dndw", py::overload_cast<String const&>(&EquilibriumSensitivity::dndw, py::const_), return_internal_ref, "Return the derivatives of the species amounts n with respect to an input variable in w.")
         .def("dndw", py::overload_cast<>(&EquilibriumSensitivity::dndw, py::const_), return_internal_ref, "Return the derivatives of the species amounts n with respect to the input variables w.")
         .def("dndw", py::overload_cast<MatrixXdConstRef>(&EquilibriumSensitivity::dndw), "Set the derivatives of the species amounts n with respect to the input variables w.")
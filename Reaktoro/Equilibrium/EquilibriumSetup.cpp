@@ -17,10 +17,17 @@
 
 #include "EquilibriumSetup.hpp"
 
+// C++ includes
+#include <cmath>
+#include <numeric>
+#include <random>
+
 // Reaktoro includes
+#include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Enumerate.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Profiling.hpp>
 #include <Reaktoro/Core/ChemicalProps.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
@@ -31,6 +38,7 @@
 #include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumProps.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumRestrictions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
 
 namespace Reaktoro {
@@ -83,6 +91,30 @@ struct EquilibriumSetup::Impl
     ArrayXr mu;                               ///< The auxiliary vector of chemical potentials of the species.
     VectorXl isbasicvar;                      ///< The bitmap that indicates which variables in x = (n, q) are currently basic variables.
     Indices ipps;                             ///< The indices of the pure phase species (i.e., species composing single-phase species, whose chemical potentials do not depend on composition)
+    Indices iphase;                           ///< The index of the phase containing each species.
+    Indices phaseoffsets;                     ///< The index of the first species in each phase.
+    Indices phasesizes;                       ///< The number of species in each phase.
+    Vec<Indices> dependents;                  ///< The phases (including itself) whose chemical potentials depend on the amounts of the species in each phase (determined in @ref determinePhaseDependents).
+    Vec<Indices> conflicts;                   ///< The phases whose species cannot be seeded together with those of each phase, because the chemical potentials of some phase depend on both.
+    Vec<bool> dependents_settled;             ///< The flags indicating if the dependents of each phase were determined with positive amounts of all its species, and thus need not be determined again.
+    std::minstd_rand dependents_rng;          ///< The generator of the random weights with which the amounts of the species are seeded in @ref determinePhaseDependents.
+    Vec<Indices> seedgroups;                  ///< The groups of species (at most one per phase) whose amounts are seeded simultaneously when computing columns of Hxx.
+    Indices seedgroupcounts;                  ///< The auxiliary number of seed groups already containing a species of each phase.
+    Indices iseeded;                          ///< The auxiliary indices of the species whose columns in Hxx are computed in an update of Hxx.
+    bool assembling_jacobian = false;         ///< The flag indicating if the Jacobian matrix of the chemical properties is being assembled.
+    bool hnn_offblock_dirty = false;          ///< The flag indicating if Hnn in Hxx may have non-zero entries outside the diagonal blocks of the phases.
+    EquilibriumProfiling* profiling = nullptr;///< The profiling information being recorded in the current calculation (if any).
+    VectorXd xgradx;                          ///< The values of x at the last update of the derivatives with respect to x (used in the Hessian reuse test).
+    VectorXd pgradx;                          ///< The values of p at the last update of the derivatives with respect to x (used in the Hessian reuse test).
+    VectorXd wgradx;                          ///< The values of w when the derivatives with respect to x were last computed.
+    VectorXl ibasicvarsgradx;                 ///< The indices of the basic variables when the derivatives with respect to x were last computed.
+    double stepnorm = 0.0;                    ///< The norm of the step in (x, p) between the last two updates of the derivatives with respect to x.
+    bool gradx_computed = false;              ///< The flag indicating if the derivatives with respect to x have been computed at least once.
+    bool reusing_grads = false;               ///< The flag indicating if the derivatives with respect to x and p of a previous iteration are reused in the current one.
+    bool reuse_forced = false;                ///< The flag indicating if the derivatives with respect to x and p are reused within and across calculations regardless of the options (see EquilibriumSetup::setHessianReuseForced).
+    Index consecutive_reuses = 0;             ///< The number of consecutive updates in which the derivatives with respect to x and p have been reused.
+    Index hessian_refreshes = 0;              ///< The number of times the derivatives with respect to x and p have been computed since the last reset.
+    Index hessian_reuses = 0;                 ///< The number of times the derivatives with respect to x and p have been reused since the last reset.
 
     // -------------------------------------------- //
     // ------ CONVENIENT AUXILIARY VARIABLES ------ //
@@ -127,7 +159,7 @@ struct EquilibriumSetup::Impl
         F.resize(Nx + Np);
         gx.resize(Nx);
         vp.resize(Np);
-        Hxx.resize(Nx, Nx);
+        Hxx = MatrixXd::Zero(Nx, Nx);
         Hxp.resize(Nx, Np);
         Hxc.resize(Nx, Nwc);
         Vpx.resize(Np, Nx);
@@ -146,28 +178,46 @@ struct EquilibriumSetup::Impl
                 ipps.push_back(offset);
             offset += size;
         }
+
+        // Initialize the phase structure of the species used when seeding several species amounts at once
+        const auto Nk = system.phases().size();
+        iphase.resize(Nn);
+        phaseoffsets.resize(Nk);
+        phasesizes.resize(Nk);
+        seedgroupcounts.resize(Nk);
+        iseeded.reserve(Nn);
+        offset = 0;
+        for(auto k = 0; k < Nk; ++k)
+        {
+            const auto size = system.phase(k).species().size();
+            phaseoffsets[k] = offset;
+            phasesizes[k] = size;
+            for(auto i = offset; i < offset + size; ++i)
+                iphase[i] = k;
+            offset += size;
+        }
     }
 
-    auto assembleLowerBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0) const -> VectorXd
+    auto assembleLowerBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0, VectorXdRef xlower) const -> void
     {
-        VectorXd xlower = constants(Nx, -inf);
+        errorif(xlower.size() != Nx, "Expecting a lower bound vector with size ", Nx, " but given one has size ", xlower.size(), " instead.");
+        xlower.fill(-inf);
         auto nlower = xlower.head(Nn);
         const auto n0 = state0.speciesAmounts();
         for(auto [i, val] : restrictions.speciesCannotDecreaseBelow()) nlower[i] = val;
         for(auto i : restrictions.speciesCannotDecrease()) nlower[i] = n0[i]; // this comes after, in case a species cannot strictly decrease
         for(auto& val : nlower) val = std::max(val, options.epsilon); // ensure the upper bounds of the species amounts are not below the minimum amount value given in EquilibriumOptions::epsilon. TODO: Issue a warning when lower/upper bound of a species amount is changed to EquilibriumOptions::epsilon.
-        return xlower;
     }
 
-    auto assembleUpperBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0) const -> VectorXd
+    auto assembleUpperBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0, VectorXdRef xupper) const -> void
     {
-        VectorXd xupper = constants(Nx, inf);
+        errorif(xupper.size() != Nx, "Expecting an upper bound vector with size ", Nx, " but given one has size ", xupper.size(), " instead.");
+        xupper.fill(inf);
         auto nupper = xupper.head(Nn);
         const auto n0 = state0.speciesAmounts();
         for(auto [i, val] : restrictions.speciesCannotIncreaseAbove()) nupper[i] = val;
         for(auto i : restrictions.speciesCannotIncrease()) nupper[i] = n0[i]; // this comes after, in case a species cannot strictly increase
         for(auto& val : nupper) val = std::max(val, options.epsilon); // ensure the upper bounds of the species amounts are not below the minimum amount value given in EquilibriumOptions::epsilon.
-        return xupper;
     }
 
     auto update(VectorXrConstRef xx, VectorXrConstRef pp, VectorXrConstRef ww) -> void
@@ -178,7 +228,9 @@ struct EquilibriumSetup::Impl
         p = pp;
         w = ww;
 
-        props.update(n, p, w, options.use_ideal_activity_models);
+        profileit(profiling, chemical_props, props.update(n, p, w, options.use_ideal_activity_models));
+
+        reusing_grads = false;
 
         updateF();
         updateGibbsEnergy(); // let this after updateF because of update in mu performed by updateF
@@ -186,8 +238,55 @@ struct EquilibriumSetup::Impl
         vp = F.tail(Np);
     }
 
+    /// Return true if the derivatives with respect to x and p of a previous iteration can be reused in the current one (see EquilibriumOptions::hessian_reuse).
+    /// The derivatives are reused while the steps in (x, p) between
+    /// consecutive updates of these derivatives contract fast enough, which
+    /// indicates that the calculation is converging and that the derivatives
+    /// have changed little. They are always recomputed if the input variables
+    /// w or the basic variables have changed since their last computation, or
+    /// if the full Jacobian of the chemical properties is being assembled.
+    auto canReuseGradX(VectorXlConstRef ibasicvars) -> bool
+    {
+        const auto previousstepnorm = stepnorm;
+
+        stepnorm = xgradx.size() == Nx ?
+            std::sqrt((x.cast<double>() - xgradx).squaredNorm() + (p.cast<double>() - pgradx).squaredNorm()) : 0.0;
+
+        xgradx = x.cast<double>();
+        pgradx = p.cast<double>();
+
+        if(!(options.hessian_reuse || reuse_forced) || !gradx_computed || assembling_jacobian)
+            return false;
+
+        if(consecutive_reuses >= options.hessian_reuse_max_iterations)
+            return false;
+
+        if(ibasicvars.size() != ibasicvarsgradx.size() || ibasicvars != ibasicvarsgradx)
+            return false;
+
+        if((w.cast<double>().array() != wgradx.array()).any())
+            return false;
+
+        return stepnorm <= options.hessian_reuse_contraction_rate * previousstepnorm;
+    }
+
     auto updateGradX(VectorXlConstRef ibasicvars) -> void
     {
+        reusing_grads = canReuseGradX(ibasicvars);
+
+        if(reusing_grads)
+        {
+            ++hessian_reuses;
+            ++consecutive_reuses;
+            return;
+        }
+
+        ++hessian_refreshes;
+        consecutive_reuses = 0;
+        gradx_computed = true;
+        ibasicvarsgradx = ibasicvars;
+        wgradx = w.cast<double>();
+
         isbasicvar.fill(false);
         isbasicvar(ibasicvars).fill(true);
 
@@ -199,41 +298,80 @@ struct EquilibriumSetup::Impl
                 Hnn(i, i) += tau/(n[i].val() * n[i].val());
         };
 
-        if(Np == 0)
+        auto Hnn = Hxx.topLeftCorner(Nn, Nn);
+
+        auto assemble_blocks = [&](EquilibriumHessianBlocks const& blocks)
         {
-            auto Hnn = Hxx.topLeftCorner(Nn, Nn);
+            // Assemble only the diagonal blocks of the phases in Hnn, whose remaining entries are zero unless overwritten by full columns
+            // Note: Hxx remains a dense matrix because the block-diagonal structure cannot be passed to Optima
+            if(hnn_offblock_dirty)
+                Hnn.fill(0.0);
+            hnn_offblock_dirty = false;
+            blocks.assemble(Hnn);
+        };
 
+        if(Np == 0)
+        {
             if(options.hessian == GibbsHessian::ApproxDiagonal)
             {
-                Hnn = hessian.diagonal(n);
+                assemble_blocks(hessian.diagonalBlocks(n));
                 add_log_barrier_contrib(Hnn);
             }
             else if(options.hessian == GibbsHessian::Approx)
             {
-                Hnn = hessian.approximate(n);
+                assemble_blocks(hessian.approximateBlocks(n));
                 add_log_barrier_contrib(Hnn);
             }
             else if(options.hessian == GibbsHessian::PartiallyExact)
             {
-                Hnn = hessian.approximate(n);
+                assemble_blocks(hessian.approximateBlocks(n));
                 add_log_barrier_contrib(Hnn);
 
                 // Update columns of Hxx and Vpx corresponding to primary species
-                for(auto i : ibasicvars)
+                if(usingSeedingByPhase())
+                {
+                    iseeded.clear();
+                    for(auto i : ibasicvars)
+                        if(i < Nn) // skip `q` variables (when implicit titrants are currently primary species)
+                            iseeded.push_back(i);
+                    updateGradXSeedingByPhase(iseeded);
+                }
+                else
                 {
-                    if(i >= Nn) continue; // i corresponds to a `q` variable, and the implicit titrant is currently a primary species
-                    updateFx(i);
-                    Hxx.col(i) = grad(F.head(Nx));
+                    hnn_offblock_dirty = true;
+                    for(auto i : ibasicvars)
+                    {
+                        if(i >= Nn) continue; // i corresponds to a `q` variable, and the implicit titrant is currently a primary species
+                        updateFx(i);
+                        Hxx.col(i) = grad(F.head(Nx));
+                    }
                 }
             }
             else // case GibbsHessian::Exact
             {
                 // Update Hxx and Vpx columns for all species
-                for(auto i = 0; i < Nn; ++i)
+                if(usingAnalyticActivityDerivatives())
                 {
-                    updateFx(i);
-                    Hxx.col(i) = grad(F.head(Nx));
-                    Vpx.col(i) = grad(F.tail(Np));
+                    if(hnn_offblock_dirty)
+                        Hnn.fill(0.0);
+                    hnn_offblock_dirty = false;
+                    updateGradXAnalyticByPhase();
+                }
+                else if(usingSeedingByPhase())
+                {
+                    iseeded.resize(Nn);
+                    std::iota(iseeded.begin(), iseeded.end(), 0);
+                    updateGradXSeedingByPhase(iseeded);
+                }
+                else
+                {
+                    hnn_offblock_dirty = true;
+                    for(auto i = 0; i < Nn; ++i)
+                    {
+                        updateFx(i);
+                        Hxx.col(i) = grad(F.head(Nx));
+                        Vpx.col(i) = grad(F.tail(Np));
+                    }
                 }
             }
         }
@@ -243,6 +381,7 @@ struct EquilibriumSetup::Impl
             // wrt temperature, pressure, mole fractions. By default, these methods should be
             // computed using autodiff. They can be override, however, for more efficient
             // computations (manually).
+            hnn_offblock_dirty = true;
             for(auto i = 0; i < Nn; ++i)
             {
                 updateFx(i);
@@ -256,8 +395,223 @@ struct EquilibriumSetup::Impl
         Vpx.rightCols(Nq).fill(0.0);  // these are derivatives w.r.t. amounts of implicit titrants q
     }
 
+    /// Return true if columns of Hxx can be computed by seeding several species amounts at once (one species per phase).
+    /// This requires that the residuals of the equation constraints (absent
+    /// here since Np = 0) and the Jacobian matrix of the chemical properties
+    /// (not being assembled) are not needed, since these may depend on
+    /// species in any phase.
+    auto usingSeedingByPhase() const -> bool
+    {
+        return options.hessian_seeding_by_phase && Np == 0 && !assembling_jacobian;
+    }
+
+    /// Return true if the exact diagonal blocks of Hxx can be computed with the analytic derivatives of the activity models of the phases.
+    /// This has the same requirements as @ref usingSeedingByPhase, which is
+    /// the fallback used in @ref updateGradXAnalyticByPhase for the phases
+    /// whose activity models do not provide analytic derivatives or that
+    /// depend on other phases.
+    auto usingAnalyticActivityDerivatives() const -> bool
+    {
+        return options.hessian_analytic_activity_derivatives && usingSeedingByPhase();
+    }
+
+    /// Update the columns of Hxx corresponding to all species using the analytic derivatives of the activity models of the phases.
+    /// The diagonal block of a phase is computed with EquilibriumProps::dudnPhase
+    /// using the same activity model (ideal or not) that an automatic
+    /// differentiation pass would use for its species (see
+    /// @ref useIdealModelForGradWrtVariableN). The columns of the species in
+    /// single-species phases and in phases whose activity models do not
+    /// provide analytic derivatives are computed with @ref updateGradXSeedingByPhase.
+    /// So are the columns of the species in phases on which the chemical
+    /// potentials of other phases depend, since these columns have non-zero
+    /// entries outside the diagonal block of their phase. The entries of Hnn
+    /// outside the diagonal blocks are assumed to be zero already.
+    auto updateGradXAnalyticByPhase() -> void
+    {
+        determinePhaseDependents();
+
+        iseeded.clear();
+        for(auto k = 0; k < phasesizes.size(); ++k)
+        {
+            const auto offset = phaseoffsets[k];
+            const auto size = phasesizes[k];
+            const auto useIdealModel = useIdealModelForGradWrtVariableN(offset);
+
+            auto samemodel = true;
+            for(auto i = offset; i < offset + size; ++i)
+                samemodel = samemodel && useIdealModelForGradWrtVariableN(i) == useIdealModel;
+
+            auto block = Hxx.block(offset, offset, size, size);
+            if(size > 1 && samemodel && dependents[k].size() == 1 && props.dudnPhase(k, n, p, w, useIdealModel, block))
+                continue;
+
+            for(auto i = offset; i < offset + size; ++i)
+                iseeded.push_back(i);
+        }
+
+        if(iseeded.size())
+            updateGradXSeedingByPhase(iseeded);
+    }
+
+    /// Determine the phases whose chemical potentials depend on the amounts of the species in each phase.
+    /// The chemical potentials of the species in a phase usually depend only
+    /// on the amounts of the species in that phase. This is not the case for
+    /// activity models that read the state of another phase via
+    /// ActivityProps::extra (e.g., ion exchange models, which depend on the
+    /// ionic strength of the aqueous phase). These dependencies are detected
+    /// with one evaluation of the chemical properties per phase in which the
+    /// amounts of all its species are seeded at once, with distinct random
+    /// weights so that their contributions do not cancel out. The check of a
+    /// phase is repeated in later calls while some of its species have zero
+    /// amounts, since a dependency may vanish at such states. Dependencies are
+    /// only ever added, never removed.
+    auto determinePhaseDependents() -> void
+    {
+        const auto Nk = phasesizes.size();
+        const auto useIdealModel = options.use_ideal_activity_models;
+
+        if(dependents_settled.empty())
+        {
+            dependents.resize(Nk);
+            conflicts.resize(Nk);
+            dependents_settled.resize(Nk, false);
+        }
+
+        std::uniform_real_distribution<double> weight(0.5, 1.5);
+
+        auto changed = false;
+        for(auto k = 0; k < Nk; ++k)
+        {
+            if(dependents_settled[k])
+                continue;
+
+            const auto offset = phaseoffsets[k];
+            const auto size = phasesizes[k];
+
+            auto positive = true;
+            for(auto i = offset; i < offset + size; ++i)
+            {
+                n[i][1] = weight(dependents_rng);
+                positive = positive && n[i] > 0.0;
+            }
+
+            profileit(profiling, chemical_props, props.update(n, p, w, useIdealModel));
+            updateF();
+
+            for(auto j = 0; j < Nk; ++j)
+            {
+                if(contains(dependents[k], j))
+                    continue;
+                if(j == k || !grad(F.segment(phaseoffsets[j], phasesizes[j])).isZero(0.0))
+                {
+                    dependents[k].push_back(j);
+                    changed = true;
+                }
+            }
+
+            for(auto i = offset; i < offset + size; ++i)
+                autodiff::unseed(n[i]);
+
+            dependents_settled[k] = positive;
+        }
+
+        if(!changed)
+            return;
+
+        // Two phases conflict if the chemical potentials of some phase depend on the amounts of the species in both of them
+        for(auto a = 0; a < Nk; ++a)
+        {
+            conflicts[a].clear();
+            for(auto b = 0; b < Nk; ++b)
+                if(a != b && containsfn(dependents[a], [&](auto j) { return contains(dependents[b], j); }))
+                    conflicts[a].push_back(b);
+        }
+    }
+
+    /// Return true if a species of a given phase can be added to a group of species whose amounts are seeded simultaneously.
+    auto canJoinSeedGroup(Index k, Indices const& group) const -> bool
+    {
+        for(auto j : group)
+            if(iphase[j] == k || contains(conflicts[k], iphase[j]))
+                return false;
+        return true;
+    }
+
+    /// Update the columns of Hxx corresponding to given species by seeding the amounts of one species per phase simultaneously.
+    /// The chemical potentials of the species in a phase usually depend only
+    /// on the amounts of the species in that phase. Thus, a single evaluation
+    /// of the chemical properties with the amounts of one species per phase
+    /// seeded produces the diagonal blocks of Hxx for all these species at
+    /// once. The number of evaluations is reduced from the number of given
+    /// species to the largest number of given species in a single phase.
+    /// Phases whose chemical potentials depend on other phases (see
+    /// @ref determinePhaseDependents) are handled by never seeding together
+    /// the species of two phases on which a same phase depends, and by
+    /// computing the entries of the columns of these species in the rows of
+    /// all phases that depend on them.
+    auto updateGradXSeedingByPhase(Indices const& ispecies) -> void
+    {
+        determinePhaseDependents();
+
+        // Distribute the species among seed groups, each with at most one species per phase, no conflicting phases, and with the same choice of activity models
+        for(auto& group : seedgroups)
+            group.clear();
+
+        Index numgroups = 0;
+        for(auto useIdealModel : { false, true })
+        {
+            const auto start = numgroups;
+            std::fill(seedgroupcounts.begin(), seedgroupcounts.end(), 0);
+            for(auto i : ispecies)
+            {
+                if(useIdealModelForGradWrtVariableN(i) != useIdealModel)
+                    continue;
+                const auto k = iphase[i];
+                auto igroup = start + seedgroupcounts[k];
+                if(conflicts[k].size())
+                    while(igroup < numgroups && !canJoinSeedGroup(k, seedgroups[igroup]))
+                        ++igroup;
+                seedgroupcounts[k] = igroup - start + 1;
+                if(igroup >= seedgroups.size())
+                    seedgroups.resize(igroup + 1);
+                seedgroups[igroup].push_back(i);
+                numgroups = std::max<Index>(numgroups, igroup + 1);
+            }
+        }
+
+        for(Index igroup = 0; igroup < numgroups; ++igroup)
+        {
+            auto const& group = seedgroups[igroup];
+
+            const auto useIdealModel = useIdealModelForGradWrtVariableN(group.front());
+
+            for(auto i : group)
+                autodiff::seed(n[i]);
+
+            profileit(profiling, chemical_props, props.update(n, p, w, useIdealModel));
+            updateF();
+
+            for(auto i : group)
+            {
+                auto col = Hxx.col(i);
+                col.head(Nn).fill(0.0);
+                for(auto j : dependents[iphase[i]])
+                    col.segment(phaseoffsets[j], phasesizes[j]) = grad(F.segment(phaseoffsets[j], phasesizes[j]));
+                if(dependents[iphase[i]].size() > 1)
+                    hnn_offblock_dirty = true;
+            }
+
+            for(auto i : group)
+                autodiff::unseed(n[i]);
+        }
+    }
+
     auto updateGradP() -> void
     {
+        // Keep Hxp and Vpp of a previous iteration if Hxx and Vpx are also being reused
+        if(reusing_grads)
+            return;
+
         // Update Hxp and Vpp
         for(auto i = 0; i < Np; ++i)
         {
@@ -315,7 +669,7 @@ struct EquilibriumSetup::Impl
         const auto useIdealModel = useIdealModelForGradWrtVariableN(i); // in case of little or no dependency of the thermochemical properties on n[i] (i.e., chemical props should have very little dependency in general on tiny species amounts)
         const auto inpw = i; // the index of n[i] in the extended vector (n, p, w)
         autodiff::seed(n[i]);
-        props.update(n, p, w, useIdealModel, inpw);
+        profileit(profiling, chemical_props, props.update(n, p, w, useIdealModel, inpw));
         updateF();
         autodiff::unseed(n[i]);
     }
@@ -325,7 +679,7 @@ struct EquilibriumSetup::Impl
         const auto useIdealModel = useIdealModelForGradWrtVariableQ(i); // in case of little or no dependency of the thermochemical properties on q[i] (i.e., chemical props has no dependency on amounts of implicit titrants such as [H+] when fixing pH)
         const auto inpw = -1; // the index of q[i] in the extended vector (n, p, w) is not defined
         autodiff::seed(q[i]);
-        props.update(n, p, w, useIdealModel, inpw);
+        profileit(profiling, chemical_props, props.update(n, p, w, useIdealModel, inpw));
         updateF();
         autodiff::unseed(q[i]);
     }
@@ -336,7 +690,7 @@ struct EquilibriumSetup::Impl
         const auto useIdealModel = useIdealModelForGradWrtVariableP(i); // in case of little or no dependency of the thermochemical properties on p[i] (e.g., chemical props has no dependency on the amount of a titrant, but it has on temperature and pressure if one of these are unknown p variables)
         const auto inpw = Nn + i; // the index of p[i] in the extended vector (n, p, w)
         autodiff::seed(p[i]);
-        props.update(n, p, w, useIdealModel, inpw);
+        profileit(profiling, chemical_props, props.update(n, p, w, useIdealModel, inpw));
         updateF();
         autodiff::unseed(p[i]);
     }
@@ -347,7 +701,7 @@ struct EquilibriumSetup::Impl
         const auto useIdealModel = useIdealModelForGradWrtVariableW(i); // in case of little or no dependency of the thermochemical properties on w[i] (e.g., chemical props has no dependency on the designated value of pH, but it has on given values of temperature and pressure)
         const auto inpw = Nn + Np + i; // the index of w[i] in the extended vector (n, p, w)
         autodiff::seed(w[i]);
-        props.update(n, p, w, useIdealModel, inpw);
+        profileit(profiling, chemical_props, props.update(n, p, w, useIdealModel, inpw));
         updateF();
         autodiff::unseed(w[i]);
     }
@@ -422,7 +776,7 @@ struct EquilibriumSetup::Impl
 
     auto usingDiagonalApproxDerivatives() -> bool
     {
-        return options.hessian == GibbsHessian::ApproxDiagonal;
+        return options.hessian == GibbsHessian::ApproxDiagonal || (Np == 0 && ipps.size() == Nn); // Hnn is also diagonal when every phase has a single species
     }
 
     auto useIdealModelForGradWrtVariableN(Index i) -> bool
@@ -488,6 +842,44 @@ auto EquilibriumSetup::setOptions(EquilibriumOptions const& opts) -> void
     pimpl->options = opts;
 }
 
+auto EquilibriumSetup::setProfiling(EquilibriumProfiling* profiling) -> void
+{
+    pimpl->profiling = profiling;
+}
+
+auto EquilibriumSetup::numHessianRefreshes() const -> Index
+{
+    return pimpl->hessian_refreshes;
+}
+
+auto EquilibriumSetup::numHessianReuses() const -> Index
+{
+    return pimpl->hessian_reuses;
+}
+
+auto EquilibriumSetup::setHessianReuseForced(bool forced) -> void
+{
+    pimpl->reuse_forced = forced;
+}
+
+auto EquilibriumSetup::resetHessianReuse(bool discard) -> void
+{
+    pimpl->hessian_refreshes = 0;
+    pimpl->hessian_reuses = 0;
+    pimpl->consecutive_reuses = 0;
+
+    // Let the first update of the derivatives in the next calculation pass the contraction test, so that those of the previous calculation are reused if the input and basic variables have not changed
+    if((pimpl->options.hessian_reuse_across_calculations || pimpl->reuse_forced) && !discard)
+        pimpl->stepnorm = inf;
+    else
+    {
+        // Otherwise, the derivatives of the previous calculation are not reused, and the steps of the next calculation are not compared with those of the previous one
+        pimpl->gradx_computed = false;
+        pimpl->xgradx.resize(0);
+        pimpl->stepnorm = 0.0;
+    }
+}
+
 auto EquilibriumSetup::dims() const -> EquilibriumDims const&
 {
     return pimpl->dims;
@@ -520,12 +912,26 @@ auto EquilibriumSetup::Aep() const -> MatrixXdConstRef
 
 auto EquilibriumSetup::assembleLowerBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0) const -> VectorXd
 {
-    return pimpl->assembleLowerBoundsVector(restrictions, state0);
+    VectorXd xlower(pimpl->Nx);
+    pimpl->assembleLowerBoundsVector(restrictions, state0, xlower);
+    return xlower;
+}
+
+auto EquilibriumSetup::assembleLowerBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0, VectorXdRef xlower) const -> void
+{
+    pimpl->assembleLowerBoundsVector(restrictions, state0, xlower);
 }
 
 auto EquilibriumSetup::assembleUpperBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0) const -> VectorXd
 {
-    return pimpl->assembleUpperBoundsVector(restrictions, state0);
+    VectorXd xupper(pimpl->Nx);
+    pimpl->assembleUpperBoundsVector(restrictions, state0, xupper);
+    return xupper;
+}
+
+auto EquilibriumSetup::assembleUpperBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0, VectorXdRef xupper) const -> void
+{
+    pimpl->assembleUpperBoundsVector(restrictions, state0, xupper);
 }
 
 auto EquilibriumSetup::update(VectorXrConstRef x, VectorXrConstRef p, VectorXrConstRef w) -> void
@@ -535,17 +941,17 @@ auto EquilibriumSetup::update(VectorXrConstRef x, VectorXrConstRef p, VectorXrCo
 
 auto EquilibriumSetup::updateGradX(VectorXlConstRef ibasicvars) -> void
 {
-    pimpl->updateGradX(ibasicvars);
+    profileit(pimpl->profiling, hessian, pimpl->updateGradX(ibasicvars));
 }
 
 auto EquilibriumSetup::updateGradP() -> void
 {
-    pimpl->updateGradP();
+    profileit(pimpl->profiling, grad_p, pimpl->updateGradP());
 }
 
 auto EquilibriumSetup::updateGradW() -> void
 {
-    pimpl->updateGradW();
+    profileit(pimpl->profiling, grad_w, pimpl->updateGradW());
 }
 
 auto EquilibriumSetup::getGibbsEnergy() -> real
@@ -605,11 +1011,13 @@ auto EquilibriumSetup::usingDiagonalApproxDerivatives() -> bool
 
 auto EquilibriumSetup::assembleChemicalPropsJacobianBegin() -> void
 {
+    pimpl->assembling_jacobian = true;
     pimpl->props.assembleFullJacobianBegin();
 }
 
 auto EquilibriumSetup::assembleChemicalPropsJacobianEnd() -> void
 {
+    pimpl->assembling_jacobian = false;
     pimpl->props.assembleFullJacobianEnd();
 }
 
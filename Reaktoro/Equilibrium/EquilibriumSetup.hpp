@@ -33,6 +33,7 @@ class EquilibriumProps;
 class EquilibriumRestrictions;
 class EquilibriumSpecs;
 struct EquilibriumOptions;
+struct EquilibriumProfiling;
 
 /// Used to construct the optimization problem for a chemical equilibrium calculation.
 class EquilibriumSetup
@@ -53,6 +54,31 @@ public:
     /// Set the options for the solution of the equilibrium problem.
     auto setOptions(EquilibriumOptions const& options) -> void;
 
+    /// Set the object in which the profiling information of the current calculation is recorded (`nullptr` to stop recording).
+    auto setProfiling(EquilibriumProfiling* profiling) -> void;
+
+    /// Return the number of times the derivatives with respect to *x* and *p* were computed since the last call to @ref resetHessianReuse.
+    auto numHessianRefreshes() const -> Index;
+
+    /// Return the number of times the derivatives with respect to *x* and *p* of a previous iteration were reused since the last call to @ref resetHessianReuse.
+    /// @see EquilibriumOptions::hessian_reuse
+    auto numHessianReuses() const -> Index;
+
+    /// Set whether the derivatives with respect to *x* and *p* are reused within and across calculations regardless of the options.
+    /// When forced, the derivatives are reused as if both
+    /// EquilibriumOptions::hessian_reuse and
+    /// EquilibriumOptions::hessian_reuse_across_calculations were enabled,
+    /// without changing the options (e.g., in a sequence of closely related
+    /// calculations such as those with multiple right-hand sides).
+    auto setHessianReuseForced(bool forced) -> void;
+
+    /// Reset the number of computations and reuses of the derivatives with respect to *x* and *p* to zero.
+    /// Call this method at the beginning of each calculation. The derivatives
+    /// computed in a previous calculation are then recomputed in the first
+    /// iteration of the next one, unless EquilibriumOptions::hessian_reuse_across_calculations is enabled.
+    /// @param discard If true, the derivatives computed in a previous calculation are always recomputed in the next one (e.g., before retrying a calculation that failed).
+    auto resetHessianReuse(bool discard = false) -> void;
+
     /// Return the dimensions of the variables in the equilibrium problem.
     auto dims() const -> EquilibriumDims const&;
 
@@ -81,6 +107,18 @@ public:
     /// @param state0 The initial chemical state of the system.
     auto assembleUpperBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0) const -> VectorXd;
 
+    /// Assemble the lower bound vector `xlower` in the optimization problem where *x = (n, q)* without allocating memory.
+    /// @param restrictions The lower and upper bounds information of the species.
+    /// @param state0 The initial chemical state of the system.
+    /// @param[out] xlower The lower bound vector with length equal to the number of variables *x*.
+    auto assembleLowerBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0, VectorXdRef xlower) const -> void;
+
+    /// Assemble the upper bound vector `xupper` in the optimization problem where *x = (n, q)* without allocating memory.
+    /// @param restrictions The lower and upper bounds information of the species.
+    /// @param state0 The initial chemical state of the system.
+    /// @param[out] xupper The upper bound vector with length equal to the number of variables *x*.
+    auto assembleUpperBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0, VectorXdRef xupper) const -> void;
+
     /// Update the chemical potentials and residuals of the equilibrium constraints.
     /// @param x The amounts of the species and implicit titrants, @eq{x = (n, q)}.
     /// @param p The values of the *p* control variables (e.g., temperature, pressure, and/or amounts of explicit titrants).
@@ -128,6 +166,9 @@ public:
     auto usingPartiallyExactDerivatives() -> bool;
 
     /// Return true if a diagonal structure is adopted for the Hessian matrix *Hxx*.
+    /// This is the case when approximate diagonal derivatives are used (see
+    /// GibbsHessian::ApproxDiagonal) and also when *Hxx* is structurally
+    /// diagonal because every phase in the system has a single species.
     auto usingDiagonalApproxDerivatives() -> bool;
 
     /// Enable recording of derivatives of the chemical properties with respect
@@ -22,11 +22,15 @@
 #include <Reaktoro/Core/ChemicalProps.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Phases.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumDims.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumRestrictions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSetup.hpp>
+#include <Reaktoro/Extensions/Phreeqc/PhreeqcDatabase.hpp>
+#include <Reaktoro/Models/ActivityModels/ActivityModelDebyeHuckel.hpp>
+#include <Reaktoro/Models/ActivityModels/ActivityModelIonExchange.hpp>
 using namespace Reaktoro;
 
 using autodiff::jacobian;
@@ -564,3 +568,69 @@ TEST_CASE("Testing EquilibriumSetup", "[EquilibriumSetup]")
         }
     }
 }
+
+TEST_CASE("Testing EquilibriumSetup with phases coupled through their activity models", "[EquilibriumSetup]")
+{
+    PhreeqcDatabase db("phreeqc.dat");
+
+    AqueousPhase solution(speciate("H O C Na Ca Mg Cl"));
+    solution.set(ActivityModelDebyeHuckel());
+
+    IonExchangePhase exchange("NaX CaX2 MgX2"); // the activity coefficients of the exchange species depend on the ionic strength of the aqueous phase
+    exchange.set(ActivityModelIonExchangeGainesThomas());
+
+    GaseousPhase gases("CO2(g) H2O(g)");
+
+    ChemicalSystem system(db, solution, exchange, gases);
+
+    const auto Nn = system.species().size();
+
+    const auto iaqueous = 0;  // the index of the aqueous phase
+    const auto iexchange = 1; // the index of the ion exchange phase
+
+    const auto naqueous = system.phase(iaqueous).species().size();
+    const auto nexchange = system.phase(iexchange).species().size();
+
+    EquilibriumSpecs specs(system);
+    specs.temperature();
+    specs.pressure();
+
+    ArrayXr n = ArrayXr::Constant(Nn, 0.1);
+    n[system.species().index("H2O")] = 55.0;
+
+    const VectorXr x = n.matrix();
+    const VectorXr p;
+    const VectorXr w{{298.15, 1.0e5}};
+
+    const VectorXl ibasicvars = VectorXl::LinSpaced(Nn, 0, Nn - 1);
+
+    EquilibriumOptions options;
+
+    auto computeGibbsHessianX = [&](EquilibriumOptions const& options) -> MatrixXd
+    {
+        EquilibriumSetup setup(specs);
+        setup.setOptions(options);
+        setup.update(x, p, w);
+        setup.updateGradX(ibasicvars);
+        return setup.getGibbsHessianX();
+    };
+
+    for(auto mode : { GibbsHessian::Exact, GibbsHessian::PartiallyExact })
+    {
+        options.hessian = mode;
+
+        options.hessian_seeding_by_phase = false;
+        const MatrixXd Hxx = computeGibbsHessianX(options);
+
+        // The entries coupling the ion exchange species to the aqueous species are not zero
+        CHECK( !Hxx.block(naqueous, 0, nexchange, naqueous).isZero() );
+
+        options.hessian_seeding_by_phase = true;
+        CHECK( computeGibbsHessianX(options).isApprox(Hxx) );
+
+        options.hessian_analytic_activity_derivatives = true;
+        CHECK( computeGibbsHessianX(options).isApprox(Hxx) );
+
+        options.hessian_analytic_activity_derivatives = false;
+    }
+}
@@ -17,6 +17,10 @@
 
 #include "EquilibriumSolver.hpp"
 
+// C++ includes
+#include <cmath>
+#include <thread>
+
 // Optima includes
 #include <Optima/Options.hpp>
 #include <Optima/Problem.hpp>
@@ -26,9 +30,11 @@
 #include <Optima/State.hpp>
 
 // Reaktoro includes
-#include <Reaktoro/Common/ArrayStream.hpp>
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Profiling.hpp>
+#include <Reaktoro/Common/ThreadPool.hpp>
+#include <Reaktoro/Common/TimeUtils.hpp>
 #include <Reaktoro/Common/Warnings.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
@@ -41,6 +47,7 @@
 #include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSetup.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
+#include <Reaktoro/ODML/KdTree.hpp>
 
 namespace Reaktoro {
 
@@ -83,9 +90,17 @@ struct EquilibriumSolver::Impl
     /// The optimization problem to be configured for a chemical equilibrium calculation.
     Optima::Problem optproblem;
 
+    /// The values of the input variables in the current equilibrium calculation.
+    VectorXr w;
+
     /// The optimization state of the calculation.
     Optima::State optstate;
 
+    /// The optimization state at the start of the calculation, restored before a retry (see @ref solveOptProblemWithRetry).
+    /// This is copy-assigned in each calculation, without memory allocation
+    /// once it has the size of the optimization state.
+    Optima::State optstatebkp;
+
     /// The optimization sensitivity of the calculation.
     Optima::Sensitivity optsensitivity;
 
@@ -95,8 +110,29 @@ struct EquilibriumSolver::Impl
     /// The result of the equilibrium calculation
     EquilibriumResult result;
 
-    /// The array stream used to clean up autodiff seed values from the last ChemicalProps update step.
-    ArrayStream<double> stream;
+    /// The initial guess for the species amounts in the next equilibrium calculation only (empty if none).
+    ArrayXd nguess;
+
+    /// The initial guess for the *p* control variables in the next equilibrium calculation only, with NaN for default ones (empty if none).
+    ArrayXd pguess;
+
+    /// The profiling information of the current equilibrium calculation (if EquilibriumOptions::profiling is true).
+    EquilibriumProfiling profiling;
+
+    /// The profiling information of the thermodynamic model evaluations in the current equilibrium calculation.
+    ThermoModelsProfiling thermoprofiling;
+
+    /// The object recording profiling information in the current equilibrium calculation (`nullptr` if profiling is not active).
+    EquilibriumProfiling* activeprofiling = nullptr;
+
+    /// The thread pool used for batch equilibrium calculations (created on demand).
+    SharedPtr<ThreadPool> pool;
+
+    /// The equilibrium solvers used by the worker threads in batch equilibrium calculations (created on demand).
+    Vec<SharedPtr<Impl>> workers;
+
+    /// The flag indicating this is a worker solver in batch equilibrium calculations, whose chemical system is a clone of that of the equilibrated chemical states.
+    bool worker = false;
 
     /// Construct a Impl instance with given EquilibriumConditions object.
     Impl(EquilibriumSpecs const& specs)
@@ -104,6 +140,9 @@ struct EquilibriumSolver::Impl
     {
         // Initialize the equilibrium solver with the default options
         setOptions(options);
+
+        // Initialize the parts of the optimization problem that are the same for all equilibrium calculations
+        initOptProblem();
     }
 
     /// Set the options of the equilibrium solver.
@@ -152,12 +191,33 @@ struct EquilibriumSolver::Impl
         optsolver.setOptions(options.optima);
     }
 
-    /// Update the optimization problem before a new equilibrium calculation.
-    auto updateOptProblem(ChemicalState const& state0, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions)
+    /// Update the chemical properties and their derivatives needed by the objective and constraint functions of the optimization problem.
+    auto updateResources(VectorXdConstRef x, VectorXdConstRef p, Optima::ObjectiveOptions const& fopts, Optima::ConstraintOptions const& vopts) -> void
     {
-        // The input variables for the equilibrium calculation
-        const VectorXr w = conditions.inputValuesGetOrCompute(state0);
+        setup.update(x, p, w);
+
+        if(fopts.eval.fxc || vopts.eval.ddc)
+            setup.assembleChemicalPropsJacobianBegin();
+
+        if(fopts.eval.fxx || vopts.eval.ddx)
+            setup.updateGradX(fopts.ibasicvars);
+        if(fopts.eval.fxp || vopts.eval.ddp)
+            setup.updateGradP();
+        if(fopts.eval.fxc || vopts.eval.ddc)
+            setup.updateGradW();
+
+        if(fopts.eval.fxc || vopts.eval.ddc)
+            setup.assembleChemicalPropsJacobianEnd();
+    }
 
+    /// Initialize the optimization problem with the parts that do not change among equilibrium calculations.
+    /// The dimensions, the resources, objective and constraint functions, the
+    /// coefficient matrices of the linear equality constraints, and the
+    /// Jacobian matrix of `be` with respect to `c` depend only on the
+    /// equilibrium specifications. They are set once here and only `be`, the
+    /// bounds, and the input variables `w` are updated in @ref updateOptProblem.
+    auto initOptProblem()
+    {
         // Create the Optima::Dims object with dimension info of the optimization problem
         optdims = Optima::Dims();
         optdims.x  = dims.Nx;
@@ -165,30 +225,17 @@ struct EquilibriumSolver::Impl
         optdims.be = dims.Nc;
         optdims.c  = dims.Nw + dims.Nc; // c' = (w, c) where w are the input variables and c are the amounts of components
 
-        // Recreate a new Optima::Problem problem (TODO: Avoid recreation of Optima::Problem object for each equilibrium calculation)
+        // Create the Optima::Problem problem
         optproblem = Optima::Problem(optdims);
 
         // Set the resources function in the Optima::Problem object
-        optproblem.r = [=](VectorXdConstRef x, VectorXdConstRef p, VectorXdConstRef c, Optima::ObjectiveOptions fopts, Optima::ConstraintOptions hopts, Optima::ConstraintOptions vopts) mutable
+        optproblem.r = [this](VectorXdConstRef x, VectorXdConstRef p, VectorXdConstRef c, Optima::ObjectiveOptions fopts, Optima::ConstraintOptions hopts, Optima::ConstraintOptions vopts)
         {
-            setup.update(x, p, w);
-
-            if(fopts.eval.fxc || vopts.eval.ddc)
-                setup.assembleChemicalPropsJacobianBegin();
-
-            if(fopts.eval.fxx || vopts.eval.ddx)
-                setup.updateGradX(fopts.ibasicvars);
-            if(fopts.eval.fxp || vopts.eval.ddp)
-                setup.updateGradP();
-            if(fopts.eval.fxc || vopts.eval.ddc)
-                setup.updateGradW();
-
-            if(fopts.eval.fxc || vopts.eval.ddc)
-                setup.assembleChemicalPropsJacobianEnd();
+            profileit(activeprofiling, evaluations, updateResources(x, p, fopts, vopts));
         };
 
         // Set the objective function in the Optima::Problem object
-        optproblem.f = [=](Optima::ObjectiveResultRef res, VectorXdConstRef x, VectorXdConstRef p, VectorXdConstRef c, Optima::ObjectiveOptions opts) mutable
+        optproblem.f = [this](Optima::ObjectiveResultRef res, VectorXdConstRef x, VectorXdConstRef p, VectorXdConstRef c, Optima::ObjectiveOptions opts)
         {
             res.f = setup.getGibbsEnergy();
             res.fx = setup.getGibbsGradX();
@@ -209,7 +256,7 @@ struct EquilibriumSolver::Impl
         };
 
         // Set the external constraint function in the Optima::Problem object
-        optproblem.v = [=](Optima::ConstraintResultRef res, VectorXdConstRef x, VectorXdConstRef p, VectorXdConstRef c, Optima::ConstraintOptions opts) mutable
+        optproblem.v = [this](Optima::ConstraintResultRef res, VectorXdConstRef x, VectorXdConstRef p, VectorXdConstRef c, Optima::ConstraintOptions opts)
         {
             res.val = setup.getConstraintResiduals();
 
@@ -229,24 +276,40 @@ struct EquilibriumSolver::Impl
         optproblem.Aex = setup.Aex();
         optproblem.Aep = setup.Aep();
 
+        // Set the values of the input variables for sensitivity derivatives
+        optproblem.c = zeros(optdims.c);
+
+        // Set the Jacobian matrix d(be)/dc = [d(be)/dw d(be)/db]
+        // The left Nw x Nb block is zero. The right Nb x Nb block is identity!
+        optproblem.bec.setZero();
+        optproblem.bec.rightCols(dims.Nc).diagonal().setOnes();
+
+        // Initialize the vector of input variables used in the resources function
+        w.resize(dims.Nw);
+    }
+
+    /// Update the optimization problem before a new equilibrium calculation.
+    /// Only the input variables, the right-hand side vector `be`, and the
+    /// bounds of the variables are updated here, in place, without any memory
+    /// allocation (see @ref initOptProblem).
+    auto updateOptProblem(ChemicalState const& state0, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions)
+    {
+        // The input variables for the equilibrium calculation
+        conditions.inputValuesGetOrCompute(state0, w);
+
         /// Set the right-hand side vector be of the linear equality constraints.
-        optproblem.be = conditions.initialComponentAmountsGetOrCompute(state0);
+        conditions.initialComponentAmountsGetOrCompute(state0, optproblem.be);
 
         // Set the lower and upper bounds of the species amounts
-        optproblem.xlower = setup.assembleLowerBoundsVector(restrictions, state0);
-        optproblem.xupper = setup.assembleUpperBoundsVector(restrictions, state0);
+        setup.assembleLowerBoundsVector(restrictions, state0, optproblem.xlower);
+        setup.assembleUpperBoundsVector(restrictions, state0, optproblem.xupper);
 
         // Set the lower and upper bounds of the *p* control variables
         optproblem.plower = conditions.lowerBoundsControlVariablesP();
         optproblem.pupper = conditions.upperBoundsControlVariablesP();
 
-        // Set the values of the input variables for sensitivity derivatives
-        optproblem.c = zeros(optdims.c);
-
-        // Set the Jacobian matrix d(be)/dc = [d(be)/dw d(be)/db]
-        // The left Nw x Nb block is zero. The right Nb x Nb block is identity!
-        optproblem.bec.setZero();
-        optproblem.bec.rightCols(dims.Nc).diagonal().setOnes();
+        // Reset the values of the input variables for sensitivity derivatives
+        optproblem.c.fill(0.0);
     }
 
     /// Update the initial state variables before the new equilibrium calculation.
@@ -277,14 +340,36 @@ struct EquilibriumSolver::Impl
         }
         else if(specs.isPressureUnknown())
             optstate.p[0] = state0.pressure();
+
+        // Overwrite n and p with the initial guess given for this calculation only (if any)
+        if(nguess.size())
+            optstate.x.head(dims.Nn) = nguess;
+
+        for(auto i = 0; i < pguess.size(); ++i)
+            if(!std::isnan(pguess[i]))
+                optstate.p[i] = pguess[i];
+
+        nguess.resize(0);
+        pguess.resize(0);
+    }
+
+    /// Set the initial guess for the species amounts and the *p* control variables in the next equilibrium calculation only.
+    auto setInitialGuess(ArrayXdConstRef n, ArrayXdConstRef p) -> void
+    {
+        errorif(n.size() != dims.Nn, "Expecting an initial guess for the amounts of the ", dims.Nn, " species in the system, but got ", n.size(), " values instead.");
+        errorif(p.size() != dims.Np, "Expecting an initial guess for the ", dims.Np, " p control variables, but got ", p.size(), " values instead.");
+        nguess = n;
+        pguess = p;
     }
 
     /// Update the chemical state object with computed optimization state.
     auto updateChemicalState(ChemicalState& state, EquilibriumConditions const& conditions)
     {
-        // Update the ChemicalProps object in state
+        // Update the ChemicalProps object in state (only its values in a worker solver, so that the state keeps referring to its own chemical system, not the cloned one of the worker)
         auto& props = state.props();
-        props = setup.chemicalProps();
+        if(worker)
+            props.update(VectorXr(setup.chemicalProps()).array());
+        else props = setup.chemicalProps();
 
         // TODO: In Optima, make sure check for convergence does not compute
         // any derivatives. Use F.updateSkipJacobian(u) instead of F.update(u)
@@ -296,9 +381,7 @@ struct EquilibriumSolver::Impl
 
         // Make sure the derivative information in the underlying chemical
         // properties of the system are zeroed out!
-        ArrayStream<double> stream;
-        props.serialize(stream);
-        props.deserialize(stream);
+        props.clearSeeds();
 
         // Update other state variables in the ChemicalState object
         state.setTemperature(props.temperature());
@@ -341,49 +424,147 @@ struct EquilibriumSolver::Impl
         sensitivity.dndc(dndc);
         sensitivity.dqdc(dqdc);
         sensitivity.dpdc(dpdc);
-        sensitivity.dudw(dudw + dudn*dndw + dudp*dpdw);
-        sensitivity.dudc(dudn*dndc + dudp*dpdc);
+
+        // Compute the total derivatives of only the chemical properties selected in the sensitivity object
+        sensitivity.updatePropertyIndices(dudn.rows());
+
+        auto const& iu = sensitivity.propertyIndices();
+
+        if(sensitivity.allPropertiesSelected())
+        {
+            sensitivity.dudw(dudw + dudn*dndw + dudp*dpdw);
+            sensitivity.dudc(dudn*dndc + dudp*dpdc);
+        }
+        else
+        {
+            sensitivity.dudw(dudw(iu, Eigen::all) + dudn(iu, Eigen::all)*dndw + dudp(iu, Eigen::all)*dpdw);
+            sensitivity.dudc(dudn(iu, Eigen::all)*dndc + dudp(iu, Eigen::all)*dpdc);
+        }
     }
 
-    auto solve(ChemicalState& state) -> EquilibriumResult
+    /// Start recording profiling information for the current equilibrium calculation if EquilibriumOptions::profiling is true.
+    auto startProfiling() -> void
     {
-        return solve(state, xconditions, xrestrictions);
+        profiling = {};
+        thermoprofiling = {};
+
+#ifdef REAKTORO_DISABLE_PROFILING
+        activeprofiling = nullptr;
+#else
+        activeprofiling = options.profiling ? &profiling : nullptr;
+#endif
+
+        setup.setProfiling(activeprofiling);
     }
 
-    auto solve(ChemicalState& state, EquilibriumRestrictions const& restrictions) -> EquilibriumResult
+    /// Stop recording profiling information for the current equilibrium calculation and gather the collected data.
+    auto stopProfiling(double solvetime) -> void
     {
-        return solve(state, xconditions, restrictions);
+        setup.setProfiling(nullptr);
+
+        if(!activeprofiling)
+            return;
+
+        profiling.solve.count += 1;
+        profiling.solve.time += solvetime;
+        profiling.standard_thermo = thermoprofiling.standard_thermo;
+        profiling.activity = thermoprofiling.activity;
+
+        // Optima does not expose its linear solves, so their time is estimated
+        // as the time spent in Optima outside the resources function evaluations.
+        profiling.linear_solves.time = std::max(profiling.optima.time - profiling.evaluations.time, 0.0);
+
+        activeprofiling = nullptr;
     }
 
-    auto solve(ChemicalState& state, EquilibriumConditions const& conditions) -> EquilibriumResult
+    /// Solve the optimization problem and record its profiling information (if active).
+    auto solveOptProblem() -> void
     {
-        return solve(state, conditions, xrestrictions);
+        profileit(activeprofiling, optima, result.optima = optsolver.solve(optproblem, optstate));
+
+        if(activeprofiling)
+            activeprofiling->linear_solves.count += result.optima.iterations;
     }
 
-    auto solve(ChemicalState& state, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> EquilibriumResult
+    /// Solve the optimization problem and, in case of failure, try once more with alternative Optima options.
+    /// The derivatives with respect to *x* and *p* of a previous calculation
+    /// are discarded only before the retry (see @ref EquilibriumSetup::resetHessianReuse).
+    auto solveOptProblemWithRetry() -> void
     {
-        updateOptProblem(state, conditions, restrictions);
-        updateOptState(state);
+        optstatebkp = optstate;
+
+        const auto refreshes0 = setup.numHessianRefreshes();
+        const auto reuses0 = setup.numHessianReuses();
 
-        const auto optstatebkp = optstate;
+        solveOptProblem();
 
-        result.optima = optsolver.solve(optproblem, optstate);
+        auto refreshes = setup.numHessianRefreshes() - refreshes0;
+        auto reuses = setup.numHessianReuses() - reuses0;
 
         if(!result.optima.succeeded)
         {
+            tic(RETRY_STEP)
+
             auto optionsbkp = options;
             options.optima.backtracksearch.apply_min_max_fix_and_accept = !options.optima.backtracksearch.apply_min_max_fix_and_accept;
             setOptions(options);
             optstate = optstatebkp;
-            result.optima = optsolver.solve(optproblem, optstate);
+            setup.resetHessianReuse(true); // do not reuse the derivatives computed in the failed attempt
+            solveOptProblem();
+            refreshes += setup.numHessianRefreshes();
+            reuses += setup.numHessianReuses();
             options = optionsbkp;
             setOptions(options);
+
+            if(activeprofiling)
+            {
+                activeprofiling->retry.count += 1;
+                activeprofiling->retry.time += toc(RETRY_STEP);
+            }
         }
 
         warningif(!result.optima.succeeded && Warnings::isEnabled(906), EQUILIBRIUM_FAILURE_MESSAGE);
 
+        result.hessian_refreshes = refreshes;
+        result.hessian_reuses = reuses;
+    }
+
+    auto solve(ChemicalState& state) -> EquilibriumResult
+    {
+        return solve(state, xconditions, xrestrictions);
+    }
+
+    auto solve(ChemicalState& state, EquilibriumRestrictions const& restrictions) -> EquilibriumResult
+    {
+        return solve(state, xconditions, restrictions);
+    }
+
+    auto solve(ChemicalState& state, EquilibriumConditions const& conditions) -> EquilibriumResult
+    {
+        return solve(state, conditions, xrestrictions);
+    }
+
+    auto solve(ChemicalState& state, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> EquilibriumResult
+    {
+        startProfiling();
+
+        ThermoModelsProfilingScope thermoscope(activeprofiling ? &thermoprofiling : nullptr);
+
+        tic(SOLVE_STEP)
+
+        updateOptProblem(state, conditions, restrictions);
+        updateOptState(state);
+
+        setup.resetHessianReuse();
+
+        solveOptProblemWithRetry();
+
         updateChemicalState(state, conditions);
 
+        stopProfiling(toc(SOLVE_STEP));
+
+        result.profiling = profiling;
+
         return result;
     }
 
@@ -406,16 +587,175 @@ struct EquilibriumSolver::Impl
     {
         EquilibriumResult result;
 
+        startProfiling();
+
+        ThermoModelsProfilingScope thermoscope(activeprofiling ? &thermoprofiling : nullptr);
+
+        tic(SOLVE_STEP)
+
         updateOptProblem(state, conditions, restrictions);
         updateOptState(state);
 
-        result.optima = optsolver.solve(optproblem, optstate, optsensitivity);
+        setup.resetHessianReuse();
+
+        profileit(activeprofiling, optima, result.optima = optsolver.solve(optproblem, optstate, optsensitivity));
+
+        if(activeprofiling)
+            activeprofiling->linear_solves.count += result.optima.iterations;
+
+        result.hessian_refreshes = setup.numHessianRefreshes();
+        result.hessian_reuses = setup.numHessianReuses();
 
         updateChemicalState(state, conditions);
         updateEquilibriumSensitivity(sensitivity);
 
+        stopProfiling(toc(SOLVE_STEP));
+
+        result.profiling = profiling;
+
         return result;
     }
+
+    /// Initialize the thread pool and the worker equilibrium solvers for batch equilibrium calculations.
+    auto initializeBatchWorkers()
+    {
+        const auto numthreads = options.batch_num_threads != 0 ?
+            options.batch_num_threads : std::max<Index>(std::thread::hardware_concurrency(), 1);
+
+        if(!pool || pool->size() != numthreads)
+        {
+            pool = std::make_shared<ThreadPool>(numthreads);
+            workers.clear();
+        }
+
+        // Each worker uses a cloned chemical system so that memoized thermodynamic and activity models are not shared among threads
+        while(workers.size() < numthreads)
+        {
+            workers.push_back(std::make_shared<Impl>(specs.clone()));
+            workers.back()->worker = true;
+        }
+
+        // The Hessian matrix is not reused across the calculations of a worker, since the cells it solves depend on the scheduling of the threads
+        auto workeroptions = options;
+        workeroptions.hessian_reuse_across_calculations = false;
+
+        for(auto& worker : workers)
+            worker->setOptions(workeroptions);
+    }
+
+    auto solve(Vec<ChemicalState>& states) -> EquilibriumBatchResult
+    {
+        Vec<EquilibriumConditions> conditions(states.size(), xconditions);
+        return solve(states, conditions);
+    }
+
+    auto solve(Vec<ChemicalState>& states, Vec<EquilibriumConditions> const& conditions) -> EquilibriumBatchResult
+    {
+        errorif(states.size() != conditions.size(), "Expecting the same number of chemical states and equilibrium conditions "
+            "in the batch equilibrium calculation, but got ", states.size(), " and ", conditions.size(), " respectively.");
+
+        const auto batchstart = time();
+
+        initializeBatchWorkers();
+
+        const auto num_cells = states.size();
+
+        EquilibriumBatchResult batchresult;
+        batchresult.results.resize(num_cells);
+        batchresult.timings.resize(num_cells);
+        batchresult.num_threads = pool->size();
+
+        pool->parallelFor(num_cells, [&](Index ithread, Index i)
+        {
+            const auto cellstart = time();
+            batchresult.results[i] = workers[ithread]->solve(states[i], conditions[i]);
+            batchresult.timings[i] = elapsed(cellstart);
+        });
+
+        // Accumulate the elapsed times in order so that the result does not depend on the scheduling of the threads
+        for(auto const& timing : batchresult.timings)
+            batchresult.time_total += timing;
+
+        batchresult.time_wall = elapsed(batchstart);
+
+        return batchresult;
+    }
+
+    auto solve(Vec<ChemicalState>& states, MatrixXdConstRef c0) -> EquilibriumBatchResult
+    {
+        return solve(states, c0, xconditions);
+    }
+
+    auto solve(Vec<ChemicalState>& states, MatrixXdConstRef c0, EquilibriumConditions const& conditions) -> EquilibriumBatchResult
+    {
+        errorif(c0.rows() != dims.Nc, "Expecting the amounts of ", dims.Nc, " conservative components "
+            "in each column of the matrix in the multiple right-hand side equilibrium calculation, but got ", c0.rows(), ".");
+        errorif(states.size() != c0.cols(), "Expecting the same number of chemical states and columns in the matrix of amounts of conservative components "
+            "in the multiple right-hand side equilibrium calculation, but got ", states.size(), " and ", c0.cols(), " respectively.");
+
+        const auto multistart = time();
+
+        const auto num_rhs = states.size();
+
+        EquilibriumBatchResult batchresult;
+        batchresult.results.resize(num_rhs);
+        batchresult.timings.resize(num_rhs);
+        batchresult.num_threads = 1;
+
+        if(num_rhs == 0)
+            return batchresult;
+
+        // The derivatives with respect to x and p are reused within and across the calculations (unless disabled), since these share the same input variables and are warm-started from nearby solutions
+        setup.setHessianReuseForced(options.hessian_reuse_multiple_rhs);
+
+        // Stop forcing the reuse of the derivatives when leaving this method, also if an exception is thrown
+        struct ForcedReuseGuard
+        {
+            EquilibriumSetup& setup;
+            ~ForcedReuseGuard() { setup.setHessianReuseForced(false); }
+        } guard{ setup };
+
+        // The amounts of conservative components of the computed states, used to find the nearest one to warm-start each calculation
+        KdTree computed(dims.Nc);
+
+        for(Index i = 0; i < num_rhs; ++i)
+        {
+            const auto rhsstart = time();
+
+            startProfiling();
+
+            ThermoModelsProfilingScope thermoscope(activeprofiling ? &thermoprofiling : nullptr);
+
+            // Let the first iteration of this calculation reuse the derivatives of the last iteration of the previous one (see EquilibriumSetup::resetHessianReuse)
+            setup.resetHessianReuse();
+
+            // The input variables and the bounds of the variables are evaluated with the chemical state of each calculation
+            updateOptProblem(states[i], conditions, xrestrictions);
+
+            // Warm-start the calculation from the already computed state with the nearest amounts of conservative components
+            updateOptState(states[computed.empty() ? i : computed.nearest(c0.col(i), 1).front()]);
+
+            optproblem.be = c0.col(i);
+
+            solveOptProblemWithRetry();
+
+            updateChemicalState(states[i], conditions);
+
+            computed.insert(c0.col(i));
+
+            stopProfiling(elapsed(rhsstart));
+
+            result.profiling = profiling;
+
+            batchresult.results[i] = result;
+            batchresult.timings[i] = elapsed(rhsstart);
+            batchresult.time_total += batchresult.timings[i];
+        }
+
+        batchresult.time_wall = elapsed(multistart);
+
+        return batchresult;
+    }
 };
 
 EquilibriumSolver::EquilibriumSolver(ChemicalSystem const& system)
@@ -428,7 +768,14 @@ EquilibriumSolver::EquilibriumSolver(EquilibriumSpecs const& specs)
 
 EquilibriumSolver::EquilibriumSolver(EquilibriumSolver const& other)
 : pimpl(new Impl(*other.pimpl))
-{}
+{
+    // The functions in the copied Optima::Problem object must refer to the new Impl object
+    pimpl->initOptProblem();
+
+    // The thread pool and its worker solvers are never shared among EquilibriumSolver objects
+    pimpl->pool = {};
+    pimpl->workers = {};
+}
 
 EquilibriumSolver::~EquilibriumSolver()
 {}
@@ -479,9 +826,34 @@ auto EquilibriumSolver::solve(ChemicalState& state, EquilibriumSensitivity& sens
     return pimpl->solve(state, sensitivity, conditions, restrictions);
 }
 
+auto EquilibriumSolver::solve(Vec<ChemicalState>& states) -> EquilibriumBatchResult
+{
+    return pimpl->solve(states);
+}
+
+auto EquilibriumSolver::solve(Vec<ChemicalState>& states, Vec<EquilibriumConditions> const& conditions) -> EquilibriumBatchResult
+{
+    return pimpl->solve(states, conditions);
+}
+
+auto EquilibriumSolver::solve(Vec<ChemicalState>& states, MatrixXdConstRef c0) -> EquilibriumBatchResult
+{
+    return pimpl->solve(states, c0);
+}
+
+auto EquilibriumSolver::solve(Vec<ChemicalState>& states, MatrixXdConstRef c0, EquilibriumConditions const& conditions) -> EquilibriumBatchResult
+{
+    return pimpl->solve(states, c0, conditions);
+}
+
 auto EquilibriumSolver::setOptions(EquilibriumOptions const& options) -> void
 {
     pimpl->setOptions(options);
 }
 
+auto EquilibriumSolver::setInitialGuess(ArrayXdConstRef n, ArrayXdConstRef p) -> void
+{
+    pimpl->setInitialGuess(n, p);
+}
+
 } // namespace Reaktoro
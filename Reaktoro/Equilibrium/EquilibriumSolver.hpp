@@ -31,6 +31,7 @@ class EquilibriumConditions;
 class EquilibriumRestrictions;
 class EquilibriumSensitivity;
 class EquilibriumSpecs;
+struct EquilibriumBatchResult;
 struct EquilibriumOptions;
 struct EquilibriumResult;
 
@@ -109,6 +110,71 @@ public:
     /// @param restrictions The reactivity restrictions on the amounts of selected species
     auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> EquilibriumResult;
 
+    //=================================================================================================================
+    //
+    // BATCH CHEMICAL EQUILIBRIUM METHODS
+    //
+    //=================================================================================================================
+
+    /// Equilibrate a batch of chemical states in parallel.
+    /// Each chemical state is equilibrated independently on one of the worker
+    /// threads of this solver (see EquilibriumOptions::batch_num_threads).
+    /// Every worker thread uses its own copy of this solver and of the
+    /// underlying chemical system (see ChemicalSystem::clone), so the
+    /// computed states do not depend on the number of threads used, and they
+    /// keep referring to their own chemical system. For the same reason,
+    /// EquilibriumOptions::hessian_reuse_across_calculations is ignored by the
+    /// worker solvers, since the chemical states each one equilibrates depend
+    /// on the scheduling of the threads.
+    /// @param[in,out] states The initial guesses for the calculations (in) and the computed equilibrium states (out)
+    auto solve(Vec<ChemicalState>& states) -> EquilibriumBatchResult;
+
+    /// Equilibrate a batch of chemical states in parallel respecting given constraint conditions.
+    /// @param[in,out] states The initial guesses for the calculations (in) and the computed equilibrium states (out)
+    /// @param conditions The specified constraint conditions to be attained at chemical equilibrium for each chemical state
+    /// @see solve(Vec<ChemicalState>&)
+    auto solve(Vec<ChemicalState>& states, Vec<EquilibriumConditions> const& conditions) -> EquilibriumBatchResult;
+
+    //=================================================================================================================
+    //
+    // MULTIPLE RIGHT-HAND SIDE CHEMICAL EQUILIBRIUM METHODS
+    //
+    //=================================================================================================================
+
+    /// Equilibrate chemical states for several amounts of conservative components at the same conditions.
+    /// This method is intended for calculations such as titration curves, in
+    /// which the same equilibrium problem is solved at identical conditions
+    /// (e.g., temperature and pressure) for different amounts of conservative
+    /// components (e.g., those from Material::componentAmounts). The input
+    /// conditions and the bounds of the species amounts are evaluated with
+    /// each chemical state. The calculations are performed sequentially, in
+    /// the order of the columns of @p c0, and each one is warm-started from the
+    /// already computed equilibrium state whose amounts of conservative
+    /// components are nearest to its own (found with a k-d tree). Thus, only
+    /// the first chemical state is used as an initial guess. The calculations
+    /// share the following: the Optima problem, which is updated (not
+    /// recreated) for each calculation; the standard thermodynamic properties
+    /// of the species, which depend only on temperature and pressure and are
+    /// thus evaluated once and then returned by the memoized thermodynamic
+    /// models; and the Hessian matrix of the Gibbs energy function, which is
+    /// reused within and across the calculations as in
+    /// EquilibriumOptions::hessian_reuse and
+    /// EquilibriumOptions::hessian_reuse_across_calculations, whether or not
+    /// these options are enabled, unless
+    /// EquilibriumOptions::hessian_reuse_multiple_rhs is disabled. The options
+    /// of this solver are not changed. The linear systems of each iteration are
+    /// still factorized by Optima, which does not expose its factorizations.
+    /// @param[in,out] states The initial guess for the first calculation (in) and the computed equilibrium states (out)
+    /// @param c0 The amounts of conservative components for each calculation (one column per chemical state)
+    auto solve(Vec<ChemicalState>& states, MatrixXdConstRef c0) -> EquilibriumBatchResult;
+
+    /// Equilibrate chemical states for several amounts of conservative components at the same given constraint conditions.
+    /// @param[in,out] states The initial guess for the first calculation (in) and the computed equilibrium states (out)
+    /// @param c0 The amounts of conservative components for each calculation (one column per chemical state)
+    /// @param conditions The specified constraint conditions to be attained at chemical equilibrium for all chemical states
+    /// @see solve(Vec<ChemicalState>&, MatrixXdConstRef)
+    auto solve(Vec<ChemicalState>& states, MatrixXdConstRef c0, EquilibriumConditions const& conditions) -> EquilibriumBatchResult;
+
     //=================================================================================================================
     //
     // MISCELLANEOUS METHODS
@@ -118,6 +184,18 @@ public:
     /// Set the options of the equilibrium solver.
     auto setOptions(EquilibriumOptions const& options) -> void;
 
+    /// Set the initial guess for the species amounts and the *p* control variables in the next equilibrium calculation only.
+    /// By default, the initial guess for the species amounts are those in the
+    /// given chemical state, which also determine the amounts of the
+    /// components to be conserved. Use this method to start the next
+    /// calculation from a better estimate of the equilibrium state instead
+    /// (e.g., one extrapolated from previous calculations), without changing
+    /// the amounts of the components. The entries of `p` that are NaN keep
+    /// their default initial guess.
+    /// @param n The initial guess for the amounts of the species (in mol)
+    /// @param p The initial guess for the *p* control variables
+    auto setInitialGuess(ArrayXdConstRef n, ArrayXdConstRef p) -> void;
+
 private:
     struct Impl;
 
@@ -33,6 +33,40 @@ using namespace Reaktoro;
 
 void exportEquilibriumSolver(py::module& m)
 {
+    // The chemical states in the batch are copied so that the computed states are written back to the given Python objects
+    auto solveBatch = [](EquilibriumSolver& self, Vec<ChemicalState*> const& states, Vec<EquilibriumConditions> const& conditions)
+    {
+        Vec<ChemicalState> batch;
+        batch.reserve(states.size());
+        for(auto const* state : states)
+            batch.push_back(*state);
+        EquilibriumBatchResult result;
+        {
+            py::gil_scoped_release release;
+            result = conditions.empty() ? self.solve(batch) : self.solve(batch, conditions);
+        }
+        for(auto i = 0; i < states.size(); ++i)
+            *states[i] = batch[i];
+        return result;
+    };
+
+    // The chemical states are copied so that the computed states are written back to the given Python objects
+    auto solveMultiRhs = [](EquilibriumSolver& self, Vec<ChemicalState*> const& states, MatrixXdConstRef c0, EquilibriumConditions const* conditions)
+    {
+        Vec<ChemicalState> batch;
+        batch.reserve(states.size());
+        for(auto const* state : states)
+            batch.push_back(*state);
+        EquilibriumBatchResult result;
+        {
+            py::gil_scoped_release release;
+            result = conditions ? self.solve(batch, c0, *conditions) : self.solve(batch, c0);
+        }
+        for(auto i = 0; i < states.size(); ++i)
+            *states[i] = batch[i];
+        return result;
+    };
+
     py::class_<EquilibriumSolver>(m, "EquilibriumSolver")
         .def(py::init<ChemicalSystem const&>())
         .def(py::init<EquilibriumSpecs const&>())
@@ -47,6 +81,10 @@ void exportEquilibriumSolver(py::module& m)
         .def("solve", py::overload_cast<ChemicalState&, EquilibriumSensitivity&, EquilibriumConditions const&>(&EquilibriumSolver::solve), "Equilibrate a chemical state respecting given constraint conditions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("conditions"))
         .def("solve", py::overload_cast<ChemicalState&, EquilibriumSensitivity&, EquilibriumConditions const&, EquilibriumRestrictions const&>(&EquilibriumSolver::solve), "Equilibrate a chemical state respecting given constraint conditions and reactivity restrictions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("conditions"), py::arg("restrictions"))
 
+        .def("solve", solveBatch, "Equilibrate a batch of chemical states in parallel respecting given constraint conditions (if any).", py::arg("states"), py::arg("conditions") = Vec<EquilibriumConditions>{})
+        .def("solve", solveMultiRhs, "Equilibrate chemical states for several amounts of conservative components at the same constraint conditions (if any).", py::arg("states"), py::arg("c0"), py::arg("conditions") = nullptr)
+
         .def("setOptions", &EquilibriumSolver::setOptions)
+        .def("setInitialGuess", &EquilibriumSolver::setInitialGuess)
         ;
 }
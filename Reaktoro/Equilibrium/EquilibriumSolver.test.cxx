@@ -35,6 +35,7 @@
 #include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
 #include <Reaktoro/Extensions/Phreeqc/PhreeqcDatabase.hpp>
+#include <Reaktoro/Models/ActivityModels/ActivityModelIonExchange.hpp>
 #include <Reaktoro/Models/ActivityModels/ActivityModelPhreeqc.hpp>
 using namespace Reaktoro;
 
@@ -466,6 +467,48 @@ TEST_CASE("Testing EquilibriumSolver", "[EquilibriumSolver]")
                 CHECK( state.speciesAmount("Halite") == Approx(0.030) );
             }
         }
+
+        WHEN("the exact Hessian is computed with and without seeding one species per phase at once")
+        {
+            options.epsilon = 1e-16;
+
+            ChemicalState state1 = state;
+            ChemicalState state2 = state;
+
+            options.hessian_seeding_by_phase = true;
+            solver.setOptions(options);
+            auto result1 = solver.solve(state1);
+
+            options.hessian_seeding_by_phase = false;
+            solver.setOptions(options);
+            auto result2 = solver.solve(state2);
+
+            CHECK( result1.succeeded() );
+            CHECK( result2.succeeded() );
+            CHECK( result1.iterations() == result2.iterations() );
+            CHECK( state1.speciesAmounts().isApprox(state2.speciesAmounts()) );
+        }
+
+        WHEN("the exact Hessian is computed with and without analytic derivatives of the activity models")
+        {
+            options.epsilon = 1e-16;
+            options.hessian_seeding_by_phase = true;
+
+            ChemicalState state1 = state;
+            ChemicalState state2 = state;
+
+            options.hessian_analytic_activity_derivatives = true;
+            solver.setOptions(options);
+            auto result1 = solver.solve(state1);
+
+            options.hessian_analytic_activity_derivatives = false;
+            solver.setOptions(options);
+            auto result2 = solver.solve(state2);
+
+            CHECK( result1.succeeded() );
+            CHECK( result2.succeeded() );
+            CHECK( state1.speciesAmounts().isApprox(state2.speciesAmounts()) );
+        }
     }
 
     SECTION("There is only pure water with given pH")
@@ -683,4 +726,397 @@ TEST_CASE("Testing EquilibriumSolver", "[EquilibriumSolver]")
         CHECK( result.succeeded() );
         CHECK( result.iterations() <= 32 ); // macOS: 28 iterations, Linux & Windows: 32 iterations
     }
+
+    SECTION("There is an aqueous solution in equilibrium with an ion exchange phase whose activity model depends on the aqueous phase")
+    {
+        PhreeqcDatabase db("phreeqc.dat");
+
+        AqueousPhase solution(speciate("H O C Na Ca Mg Cl"));
+        solution.set(ActivityModelPhreeqc(db));
+
+        IonExchangePhase exchange("NaX CaX2 MgX2");
+        exchange.set(ActivityModelIonExchangeGainesThomas());
+
+        ChemicalSystem system(db, solution, exchange);
+
+        ChemicalState state(system);
+        state.temperature(25.0, "celsius");
+        state.pressure(1.0, "bar");
+        state.set("H2O" , 1.0 , "kg");
+        state.set("Na+" , 1.10, "mmol");
+        state.set("Mg+2", 0.48, "mmol");
+        state.set("Ca+2", 1.90, "mmol");
+        state.set("NaX" , 0.06, "mmol");
+
+        EquilibriumSolver solver(system);
+
+        WHEN("the exact Hessian is computed with and without seeding one species per phase at once")
+        {
+            ChemicalState state1 = state;
+            ChemicalState state2 = state;
+
+            options.hessian_seeding_by_phase = true;
+            solver.setOptions(options);
+            auto result1 = solver.solve(state1);
+
+            options.hessian_seeding_by_phase = false;
+            solver.setOptions(options);
+            auto result2 = solver.solve(state2);
+
+            CHECK( result1.succeeded() );
+            CHECK( result2.succeeded() );
+            CHECK( result1.iterations() == result2.iterations() );
+            CHECK( state1.speciesAmounts().isApprox(state2.speciesAmounts()) );
+        }
+    }
+
+    SECTION("There is an aqueous solution equilibrated repeatedly with the same and with copied solvers")
+    {
+        Phases phases(db);
+        phases.add( AqueousPhase(speciate("H O Na Cl")) );
+
+        ChemicalSystem system(phases);
+
+        EquilibriumSpecs specs(system);
+        specs.temperature();
+        specs.pressure();
+
+        ChemicalState state0(system);
+        state0.setSpeciesAmount("H2O" , 55.0, "mol");
+        state0.setSpeciesAmount("NaCl", 0.10, "mol");
+
+        EquilibriumSolver solver(specs);
+        solver.setOptions(options);
+
+        EquilibriumConditions conditions(specs);
+        conditions.pressure(P, "bar");
+
+        // Alternate temperatures so that the input variables and bounds in the reused optimization problem change between calls
+        for(auto temperature : { 25.0, 60.0, 25.0 })
+        {
+            conditions.temperature(temperature, "celsius");
+
+            ChemicalState state = state0;
+            result = solver.solve(state, conditions);
+
+            CHECK( result.succeeded() );
+            CHECK( state.temperature() == Approx(temperature + 273.15) );
+
+            EquilibriumSolver copy = solver; // the copied solver must not refer to the optimization problem of the original one
+
+            ChemicalState statecopy = state0;
+            result = copy.solve(statecopy, conditions);
+
+            CHECK( result.succeeded() );
+            CHECK( statecopy.speciesAmounts().isApprox(state.speciesAmounts()) );
+        }
+    }
+
+    SECTION("There is a batch of aqueous solutions at different temperatures and pressures")
+    {
+        PhreeqcDatabase db("phreeqc.dat");
+
+        AqueousPhase aqueousphase(speciate("H O Na Cl C Ca"));
+        aqueousphase.set(ActivityModelPhreeqc(db));
+
+        MineralPhases minerals("Calcite Halite");
+
+        ChemicalSystem system(db, aqueousphase, minerals);
+
+        EquilibriumSpecs specs(system);
+        specs.temperature();
+        specs.pressure();
+
+        const auto num_cells = 20;
+
+        Vec<ChemicalState> states;
+        Vec<EquilibriumConditions> conditions;
+
+        for(auto i = 0; i < num_cells; ++i)
+        {
+            ChemicalState state(system);
+            state.set("H2O", 1.0, "kg");
+            state.set("Na+", 0.1 * (i + 1), "mol");
+            state.set("Cl-", 0.1 * (i + 1), "mol");
+            state.set("CO2", 0.5, "mol");
+            state.set("Calcite", 1.0, "mol");
+            states.push_back(state);
+
+            EquilibriumConditions cellconditions(specs);
+            cellconditions.temperature(25.0 + 5.0 * i, "celsius");
+            cellconditions.pressure(1.0 + 10.0 * i, "bar");
+            conditions.push_back(cellconditions);
+        }
+
+        EquilibriumSolver solver(specs);
+
+        // The equilibrium states computed one at a time, each independently of the previous ones, are used as reference
+        auto referenceoptions = options;
+        referenceoptions.hessian_reuse_across_calculations = false;
+        solver.setOptions(referenceoptions);
+
+        Vec<ChemicalState> expected = states;
+        Vec<Index> iterations(num_cells);
+
+        for(auto i = 0; i < num_cells; ++i)
+        {
+            result = solver.solve(expected[i], conditions[i]);
+            CHECK( result.succeeded() );
+            iterations[i] = result.iterations();
+        }
+
+        // The results do not depend on the number of threads, even if the Hessian matrix could be reused across the calculations of a worker solver
+        for(auto [numthreads, reuse] : { Pair<Index, bool>{ 1, false }, { 4, false }, { 1, true }, { 4, true } })
+        {
+            options.batch_num_threads = numthreads;
+            options.hessian_reuse_across_calculations = reuse;
+            solver.setOptions(options);
+
+            Vec<ChemicalState> computed = states;
+
+            auto batchresult = solver.solve(computed, conditions);
+
+            CHECK( batchresult.succeeded() );
+            CHECK( batchresult.num_threads == numthreads );
+            CHECK( batchresult.results.size() == num_cells );
+            CHECK( batchresult.timings.size() == num_cells );
+
+            for(auto i = 0; i < num_cells; ++i)
+            {
+                CHECK( batchresult.results[i].iterations() == iterations[i] );
+                CHECK( computed[i].temperature() == expected[i].temperature() );
+                CHECK( computed[i].pressure() == expected[i].pressure() );
+                CHECK( computed[i].speciesAmounts().isApprox(expected[i].speciesAmounts()) );
+                checkChemicalEquilibriumStateHasZeroDerivativeValues(computed[i]);
+
+                // The computed states refer to the chemical system of the caller, not the cloned ones of the worker solvers
+                CHECK( computed[i].props().system().id() == system.id() );
+                CHECK( computed[i].props().temperature() == expected[i].props().temperature() );
+            }
+        }
+
+        // Mismatched number of chemical states and equilibrium conditions
+        conditions.pop_back();
+        CHECK_THROWS( solver.solve(states, conditions) );
+    }
+
+    SECTION("There is an aqueous solution equilibrated for several amounts of conservative components")
+    {
+        Phases phases(db);
+        phases.add( AqueousPhase(speciate("H O Na Cl")) );
+
+        ChemicalSystem system(phases);
+
+        EquilibriumSpecs specs(system);
+        specs.temperature();
+        specs.pressure();
+
+        EquilibriumConditions conditions(specs);
+        conditions.temperature(T, "celsius");
+        conditions.pressure(P, "bar");
+
+        EquilibriumSolver solver(specs);
+        solver.setOptions(options);
+
+        ChemicalState state0(system);
+        state0.setSpeciesAmount("H2O", 55.0, "mol");
+
+        // The amounts of NaCl are not sorted so that the nearest computed states are not always the previous ones
+        const auto amountsNaCl = { 0.1, 0.5, 0.2, 0.4, 0.3 };
+        const auto num_rhs = amountsNaCl.size();
+
+        const auto A = system.formulaMatrix();
+
+        MatrixXd c0(A.rows(), num_rhs);
+
+        // The equilibrium states computed one at a time are used as reference
+        Vec<ChemicalState> expected;
+
+        for(auto amountNaCl : amountsNaCl)
+        {
+            ChemicalState state = state0;
+            state.setSpeciesAmount("NaCl", amountNaCl, "mol");
+
+            c0.col(expected.size()) = A * state.speciesAmounts().matrix();
+
+            result = solver.solve(state, conditions);
+
+            CHECK( result.succeeded() );
+
+            expected.push_back(state);
+        }
+
+        Vec<ChemicalState> computed(num_rhs, state0);
+
+        auto multiresult = solver.solve(computed, c0, conditions);
+
+        CHECK( multiresult.succeeded() );
+        CHECK( multiresult.num_threads == 1 );
+        CHECK( multiresult.results.size() == num_rhs );
+        CHECK( multiresult.timings.size() == num_rhs );
+
+        for(auto i = 0; i < num_rhs; ++i)
+        {
+            CHECK( computed[i].temperature() == expected[i].temperature() );
+            CHECK( computed[i].pressure() == expected[i].pressure() );
+            CHECK( computed[i].speciesAmounts().matrix().isApprox(expected[i].speciesAmounts().matrix(), 1e-6) );
+            CHECK( computed[i].equilibrium().initialComponentAmounts().matrix().isApprox(c0.col(i)) );
+            checkChemicalEquilibriumStateHasZeroDerivativeValues(computed[i]);
+        }
+
+        // The Hessian matrices are reused in these calculations even though this is not enabled in the options of the solver
+        Index hessian_reuses = 0;
+        for(auto const& res : multiresult.results)
+            hessian_reuses += res.hessian_reuses;
+
+        CHECK_FALSE( options.hessian_reuse );
+        CHECK( hessian_reuses > 0 );
+
+        // The reuse of the Hessian matrices is no longer forced afterwards
+        result = solver.solve(computed.front(), conditions);
+
+        CHECK( result.hessian_reuses == 0 );
+
+        // The reuse of the Hessian matrices in these calculations can be disabled
+        options.hessian_reuse_multiple_rhs = false;
+        solver.setOptions(options);
+
+        computed.assign(num_rhs, state0);
+        multiresult = solver.solve(computed, c0, conditions);
+
+        CHECK( multiresult.succeeded() );
+        for(auto const& res : multiresult.results)
+            CHECK( res.hessian_reuses == 0 );
+
+        // Mismatched number of chemical states and columns of amounts of conservative components
+        computed.pop_back();
+        CHECK_THROWS( solver.solve(computed, c0, conditions) );
+    }
+
+    SECTION("There is an aqueous solution and a gaseous solution equilibrated with and without Hessian reuse")
+    {
+        Phases phases(db);
+        phases.add( AqueousPhase(speciate("H O Na Cl C")) );
+        phases.add( GaseousPhase(speciate("H O C")) );
+
+        ChemicalSystem system(phases);
+
+        ChemicalState state0(system);
+        state0.setTemperature(T, "celsius");
+        state0.setPressure(P, "bar");
+        state0.setSpeciesAmount("H2O" , 55.0, "mol");
+        state0.setSpeciesAmount("NaCl", 0.01, "mol");
+        state0.setSpeciesAmount("CO2" , 10.0, "mol");
+
+        EquilibriumSolver solver(system);
+
+        options.hessian_reuse = false;
+        solver.setOptions(options);
+
+        ChemicalState expected = state0;
+        result = solver.solve(expected);
+
+        CHECK( result.succeeded() );
+        CHECK( result.hessian_refreshes > 0 );
+        CHECK( result.hessian_reuses == 0 );
+
+        options.hessian_reuse = true;
+        solver.setOptions(options);
+
+        ChemicalState state = state0;
+        result = solver.solve(state);
+
+        CHECK( result.succeeded() );
+        CHECK( result.hessian_refreshes > 0 );
+        CHECK( result.hessian_reuses > 0 );
+        CHECK( state.speciesAmounts().matrix().isApprox(expected.speciesAmounts().matrix(), 1e-6) );
+        checkChemicalEquilibriumStateHasZeroDerivativeValues(state);
+
+        result = solver.solve(state); // the derivatives of the previous calculation are not reused in this one
+
+        CHECK( result.succeeded() );
+        CHECK( result.hessian_refreshes > 0 );
+
+        options.hessian_reuse_max_iterations = 0; // no reuse is possible in this case
+        solver.setOptions(options);
+
+        state = state0;
+        result = solver.solve(state);
+
+        CHECK( result.succeeded() );
+        CHECK( result.hessian_reuses == 0 );
+    }
+
+    SECTION("There is an aqueous solution and a gaseous solution whose failed calculation is retried with Hessian reuse")
+    {
+        Phases phases(db);
+        phases.add( AqueousPhase(speciate("H O Na Cl C")) );
+        phases.add( GaseousPhase(speciate("H O C")) );
+
+        ChemicalSystem system(phases);
+
+        ChemicalState state(system);
+        state.setTemperature(T, "celsius");
+        state.setPressure(P, "bar");
+        state.setSpeciesAmount("H2O" , 55.0, "mol");
+        state.setSpeciesAmount("NaCl", 0.01, "mol");
+        state.setSpeciesAmount("CO2" , 10.0, "mol");
+
+        EquilibriumSolver solver(system);
+
+        options.hessian_reuse = true;
+        options.hessian_reuse_across_calculations = true;
+        options.optima.maxiters = 1; // the calculation fails and is retried from the same initial guess
+        solver.setOptions(options);
+
+        result = solver.solve(state);
+
+        // The retry recomputes the derivatives instead of reusing those of the last iteration of the failed attempt
+        CHECK_FALSE( result.succeeded() );
+        CHECK( result.hessian_refreshes >= 2 );
+        CHECK( result.hessian_reuses == 0 );
+    }
+
+    SECTION("There is an aqueous solution equilibrated with and without profiling")
+    {
+        Phases phases(db);
+        phases.add( AqueousPhase(speciate("H O Na Cl C")) );
+
+        ChemicalSystem system(phases);
+
+        ChemicalState state0(system);
+        state0.setSpeciesAmount("H2O" , 55.0, "mol");
+        state0.setSpeciesAmount("NaCl", 0.10, "mol");
+        state0.setSpeciesAmount("CO2" , 0.10, "mol");
+
+        EquilibriumSolver solver(system);
+        solver.setOptions(options);
+
+        ChemicalState state = state0;
+        result = solver.solve(state);
+
+        CHECK( result.succeeded() );
+        CHECK( result.profiling.solve.count == 0 );
+        CHECK( result.profiling.chemical_props.count == 0 );
+
+        options.profiling = true;
+        solver.setOptions(options);
+
+        state = state0;
+        result = solver.solve(state);
+
+        CHECK( result.succeeded() );
+
+#ifndef REAKTORO_DISABLE_PROFILING
+        CHECK( result.profiling.solve.count == 1 );
+        CHECK( result.profiling.optima.count >= 1 );
+        CHECK( result.profiling.evaluations.count > 0 );
+        CHECK( result.profiling.linear_solves.count >= result.iterations() );
+        CHECK( result.profiling.chemical_props.count >= result.profiling.evaluations.count );
+        CHECK( result.profiling.standard_thermo.count > 0 );
+        CHECK( result.profiling.activity.count > 0 );
+        CHECK( result.profiling.hessian.count > 0 );
+        CHECK( result.profiling.solve.time >= result.profiling.optima.time );
+#endif
+    }
 }
@@ -424,12 +424,13 @@ auto EquilibriumSpecs::lnActivity(Species const& species) -> void
     qvar.name = "[" + species.name() + "]";
     qvar.substance = species.formula();
     qvar.id = pid;
+    const auto G0model = species.standardThermoModel(); // captured by value so that copies of these specs do not share memoization state
     qvar.fn = [=](ChemicalProps const& props, VectorXrConstRef const& p, VectorXrConstRef const& w)
     {
         auto const& T = props.temperature();
         auto const& P = props.pressure();
         auto const& R = universalGasConstant;
-        const auto u0 = species.standardThermoProps(T, P).G0;
+        const auto u0 = G0model(T, P).G0;
         return u0 + R*T*w[idx];
     };
     addControlVariableQ(qvar);
@@ -468,12 +469,13 @@ auto EquilibriumSpecs::fugacity(String gas) -> void
     qvar.name = "[" + species.name() + "]";
     qvar.substance = species.formula();
     qvar.id = pid;
+    const auto G0model = species.standardThermoModel();
     qvar.fn = [=](ChemicalProps const& props, VectorXrConstRef const& p, VectorXrConstRef const& w)
     {
         auto const& T = props.temperature();
         auto const& P = props.pressure();
         auto const& R = universalGasConstant;
-        const auto u0 = species.standardThermoProps(T, P).G0;
+        const auto u0 = G0model(T, P).G0;
         return u0 + R*T*log(w[idx]);
     };
     addControlVariableQ(qvar);
@@ -491,12 +493,13 @@ auto EquilibriumSpecs::pH() -> void
     qvar.name = "[H+]";
     qvar.substance = "H+";
     qvar.id = pid;
+    const auto G0model = species.standardThermoModel();
     qvar.fn = [=](ChemicalProps const& props, VectorXrConstRef const& p, VectorXrConstRef const& w)
     {
         auto const& T = props.temperature();
         auto const& P = props.pressure();
         auto const& R = universalGasConstant;
-        const auto u0 = species.standardThermoProps(T, P).G0;
+        const auto u0 = G0model(T, P).G0;
         const auto pH = w[idx];
         return u0 + R*T*(-pH*ln10);
     };
@@ -515,12 +518,13 @@ auto EquilibriumSpecs::pMg() -> void
     qvar.name = "[Mg+2]";
     qvar.substance = "Mg+2";
     qvar.id = pid;
+    const auto G0model = species.standardThermoModel();
     qvar.fn = [=](ChemicalProps const& props, VectorXrConstRef const& p, VectorXrConstRef const& w)
     {
         auto const& T  = props.temperature();
         auto const& P  = props.pressure();
         auto const& R  = universalGasConstant;
-        const auto u0  = species.standardThermoProps(T, P).G0;
+        const auto u0  = G0model(T, P).G0;
         const auto pMg = w[idx];
         return u0 + R*T*(-pMg*ln10);
     };
@@ -800,6 +804,13 @@ auto EquilibriumSpecs::addInput(String const& var) -> Index
 //
 //=================================================================================================
 
+auto EquilibriumSpecs::clone() const -> EquilibriumSpecs
+{
+    EquilibriumSpecs copy = *this;
+    copy.m_system = m_system.clone();
+    return copy;
+}
+
 auto EquilibriumSpecs::system() const -> ChemicalSystem const&
 {
     return m_system;
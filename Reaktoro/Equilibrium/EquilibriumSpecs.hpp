@@ -704,6 +704,10 @@ public:
     //
     //=================================================================================================
 
+    /// Return a deep copy of these chemical equilibrium specifications with a cloned chemical system.
+    /// @see ChemicalSystem::clone
+    auto clone() const -> EquilibriumSpecs;
+
     /// Return the chemical system associated with the equilibrium conditions.
     auto system() const -> ChemicalSystem const&;
 
@@ -0,0 +1,710 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "SmartEquilibriumKnowledgeBase.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <shared_mutex>
+
+// Optima includes
+#include <Optima/State.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumDims.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
+
+namespace Reaktoro {
+namespace {
+
+using Cell = SmartEquilibriumSolver::Cell;
+using Cluster = SmartEquilibriumSolver::Cluster;
+using Record = SmartEquilibriumSolver::Record;
+
+/// The identifier at the beginning of a file with saved learned calculations.
+const char filemagic[8] = { 'R', 'K', 'T', 'S', 'M', 'E', 'K', 'B' };
+
+/// The version of the binary format of a file with saved learned calculations.
+const std::uint64_t fileversion = 1;
+
+/// Used to write the learned calculations of a knowledge base in a binary file.
+/// Every number is written with 8 bytes so that all values in the file are
+/// aligned and can be read in place once the file is read into memory.
+struct BinaryWriter
+{
+    std::ofstream out;
+
+    explicit BinaryWriter(String const& filename)
+    : out(filename, std::ios::binary)
+    {
+        errorif(!out, "Could not open file `", filename, "` for writing the learned calculations of a SmartEquilibriumKnowledgeBase object.");
+    }
+
+    auto bytes(void const* data, std::size_t size) -> void
+    {
+        out.write(static_cast<char const*>(data), size);
+    }
+
+    auto integer(std::int64_t value) -> void
+    {
+        bytes(&value, sizeof(value));
+    }
+
+    auto number(double value) -> void
+    {
+        bytes(&value, sizeof(value));
+    }
+
+    template<typename Array>
+    auto integers(Array const& values) -> void
+    {
+        integer(values.size());
+        for(auto i = 0; i < values.size(); ++i)
+            integer(values[i]);
+    }
+
+    auto numbers(ArrayXdConstRef values) -> void
+    {
+        integer(values.size());
+        bytes(values.data(), values.size() * sizeof(double));
+    }
+
+    auto matrix(MatrixXdConstRef values) -> void
+    {
+        const MatrixXd tmp = values; // ensure contiguous column-major storage
+        integer(tmp.rows());
+        integer(tmp.cols());
+        bytes(tmp.data(), tmp.size() * sizeof(double));
+    }
+
+    auto queue(PriorityQueue const& queue) -> void
+    {
+        integers(queue.priorities());
+        integers(queue.order());
+    }
+};
+
+/// Used to read the learned calculations of a knowledge base from a binary file read into memory.
+/// The arrays of numbers are returned as views of the file contents in memory,
+/// from which the learned calculations are then reconstructed.
+class BinaryReader
+{
+public:
+    explicit BinaryReader(String const& filename)
+    : filename(filename)
+    {
+        std::ifstream in(filename, std::ios::binary | std::ios::ate);
+        errorif(!in, "Could not open file `", filename, "` for reading the learned calculations of a SmartEquilibriumKnowledgeBase object.");
+        size = in.tellg();
+        buffer.resize(size / sizeof(double) + 1);
+        in.seekg(0);
+        in.read(reinterpret_cast<char*>(buffer.data()), size);
+        errorif(!in, "Could not read the learned calculations of a SmartEquilibriumKnowledgeBase object from file `", filename, "`.");
+        data = reinterpret_cast<char const*>(buffer.data());
+    }
+
+    BinaryReader(BinaryReader const&) = delete;
+
+    auto operator=(BinaryReader const&) -> BinaryReader& = delete;
+
+    auto bytes(std::size_t count) -> char const*
+    {
+        errorif(offset + count > size, "The file `", filename, "` with learned calculations of a SmartEquilibriumKnowledgeBase object is truncated or corrupted.");
+        auto const* begin = data + offset;
+        offset += count;
+        return begin;
+    }
+
+    auto integer() -> std::int64_t
+    {
+        std::int64_t value;
+        std::memcpy(&value, bytes(sizeof(value)), sizeof(value));
+        return value;
+    }
+
+    auto number() -> double
+    {
+        double value;
+        std::memcpy(&value, bytes(sizeof(value)), sizeof(value));
+        return value;
+    }
+
+    auto length() -> Index
+    {
+        const auto value = integer();
+        errorif(value < 0 || value * sizeof(std::int64_t) > size - offset, "The file `", filename, "` with learned calculations of a SmartEquilibriumKnowledgeBase object is truncated or corrupted.");
+        return value;
+    }
+
+    auto indices() -> Deque<Index>
+    {
+        Deque<Index> values(length());
+        for(auto& value : values)
+            value = integer();
+        return values;
+    }
+
+    auto integers() -> Eigen::Map<Eigen::Array<std::int64_t, -1, 1> const>
+    {
+        const auto count = length();
+        return { reinterpret_cast<std::int64_t const*>(bytes(count * sizeof(std::int64_t))), Eigen::Index(count) };
+    }
+
+    auto numbers() -> Eigen::Map<ArrayXd const>
+    {
+        const auto count = length();
+        return { reinterpret_cast<double const*>(bytes(count * sizeof(double))), Eigen::Index(count) };
+    }
+
+    auto matrix() -> Eigen::Map<MatrixXd const>
+    {
+        const auto rows = integer();
+        const auto cols = integer();
+        errorif(rows < 0 || cols < 0 || rows * cols * sizeof(double) > size - offset, "The file `", filename, "` with learned calculations of a SmartEquilibriumKnowledgeBase object is truncated or corrupted.");
+        return { reinterpret_cast<double const*>(bytes(rows * cols * sizeof(double))), Eigen::Index(rows), Eigen::Index(cols) };
+    }
+
+    auto queue() -> PriorityQueue
+    {
+        const auto priorities = indices();
+        const auto order = indices();
+        errorif(priorities.size() != order.size(), "The file `", filename, "` with learned calculations of a SmartEquilibriumKnowledgeBase object is corrupted.");
+        return PriorityQueue::withInitialPrioritiesAndOrder(priorities, order);
+    }
+
+private:
+    /// The path to the file.
+    String filename;
+
+    /// The beginning of the file contents in memory.
+    char const* data = nullptr;
+
+    /// The size of the file contents in bytes.
+    std::size_t size = 0;
+
+    /// The position of the next value to be read.
+    std::size_t offset = 0;
+
+    /// The buffer with the file contents (aligned for double numbers).
+    Vec<double> buffer;
+};
+
+/// Write a learned calculation in a binary file.
+auto writeRecord(BinaryWriter& writer, Record const& record) -> void
+{
+    auto const& predictor = record.predictor;
+    const auto state = predictor.referenceState();
+    auto const& optstate = state.equilibrium().optimaState();
+
+    writer.number(state.temperature().val());
+    writer.number(state.pressure().val());
+    writer.numbers(ArrayXd(state.speciesAmounts().cast<double>()));
+    writer.numbers(VectorXd(state.props()).array());
+    writer.numbers(state.equilibrium().w());
+    writer.numbers(state.equilibrium().c());
+    writer.numbers(optstate.x.array());
+    writer.numbers(optstate.p.array());
+    writer.numbers(optstate.ye.array());
+    writer.numbers(optstate.s.array());
+    writer.integers(optstate.jb);
+    writer.integers(optstate.jn);
+    writer.integers(predictor.propertyIndices());
+    writer.integer(predictor.singlePrecision());
+    writer.matrix(predictor.derivatives());
+    writer.numbers(predictor.curvatureDirection().array());
+    writer.numbers(predictor.curvature().array());
+    writer.integers(record.ibounded);
+    writer.numbers(record.nbounded);
+    writer.integer(record.lastused);
+}
+
+/// Read a learned calculation from a binary file and reconstruct its reference chemical state and predictor.
+/// @param Nu The number of entries in the serialized chemical properties of the chemical system.
+auto readRecord(BinaryReader& reader, EquilibriumSpecs const& specs, EquilibriumDims const& dims, Index Nu) -> Record
+{
+    ChemicalState state(specs.system());
+
+    const auto T = reader.number();
+    const auto P = reader.number();
+    const auto n = reader.numbers();
+    const auto u = reader.numbers();
+    const auto w = reader.numbers();
+    const auto c = reader.numbers();
+
+    const auto incompatible = "The learned calculations being loaded into a SmartEquilibriumKnowledgeBase object are not compatible with the given chemical equilibrium specifications.";
+
+    errorif(n.size() != dims.Nn || u.size() != Nu || w.size() != dims.Nw || c.size() != dims.Nc, incompatible);
+
+    Optima::Dims optdims;
+    optdims.x  = dims.Nx;
+    optdims.p  = dims.Np;
+    optdims.be = dims.Nc;
+    optdims.c  = dims.Nw + dims.Nc;
+
+    Optima::State optstate(optdims);
+    optstate.x  = reader.numbers().matrix();
+    optstate.p  = reader.numbers().matrix();
+    optstate.ye = reader.numbers().matrix();
+    optstate.s  = reader.numbers().matrix();
+    optstate.jb = reader.integers().cast<Eigen::Index>();
+    optstate.jn = reader.integers().cast<Eigen::Index>();
+
+    const auto iu = reader.integers();
+    const auto singleprecision = reader.integer() != 0;
+    const auto derivatives = reader.matrix();
+    const auto dxn = reader.numbers();
+    const auto ddyn = reader.numbers();
+    const auto ibounded = reader.integers();
+    const auto nbounded = reader.numbers();
+    const Index lastused = reader.integer();
+
+    const auto Nx = dims.Nx;
+    const auto Ny = dims.Nn + dims.Np + dims.Nq + iu.size();
+    const auto Nwc = dims.Nw + dims.Nc;
+
+    errorif(optstate.x.size() != Nx || optstate.p.size() != dims.Np || optstate.ye.size() != dims.Nc || optstate.s.size() != Nx, incompatible);
+    errorif(optstate.jb.size() + optstate.jn.size() != Nx, incompatible);
+    errorif((optstate.jb.array() < 0).any() || (optstate.jb.array() >= Eigen::Index(Nx)).any(), incompatible);
+    errorif((optstate.jn.array() < 0).any() || (optstate.jn.array() >= Eigen::Index(Nx)).any(), incompatible);
+    errorif((iu < 0).any() || (iu >= std::int64_t(Nu)).any(), incompatible);
+    errorif(derivatives.rows() != Ny || derivatives.cols() != Nwc, incompatible);
+    errorif(dxn.size() && (dxn.size() != Nwc || ddyn.size() != Ny), incompatible);
+    errorif(ibounded.size() != nbounded.size() || (ibounded < 0).any() || (ibounded >= std::int64_t(dims.Nn)).any(), incompatible);
+
+    state.setTemperature(T);
+    state.setPressure(P);
+    state.setSpeciesAmounts(n);
+    state.props().update(u);
+    state.equilibrium().setNamesInputVariables(specs.namesInputs());
+    state.equilibrium().setNamesControlVariablesP(specs.namesControlVariablesP());
+    state.equilibrium().setNamesControlVariablesQ(specs.namesControlVariablesQ());
+    state.equilibrium().setInputVariables(w);
+    state.equilibrium().setInitialComponentAmounts(c);
+    state.equilibrium().setOptimaState(optstate);
+
+    EquilibriumPredictor predictor(state, Indices(iu.data(), iu.data() + iu.size()), derivatives, singleprecision);
+
+    if(dxn.size())
+        predictor.setCurvature(dxn.matrix(), ddyn.matrix());
+
+    return { predictor, lastused, ibounded.cast<Eigen::Index>(), nbounded };
+}
+
+/// Apply increments of usage counts to the learned calculations in a grid.
+auto applyPriorityUpdates(SmartEquilibriumSolver::Grid& grid, Vec<SmartEquilibriumKnowledgeBase::PriorityUpdate> const& updates) -> void
+{
+    for(auto const& [key, icluster, jcluster, irecord, epoch, home, radius] : updates)
+    {
+        // Widen the neighborhood searched from the cell of the predicted state if the learned calculation came from a neighbor cell
+        if(radius > 0)
+        {
+            const auto it = grid.cells.find(home);
+            if(it != grid.cells.end())
+            {
+                it->second.radius = std::max(it->second.radius, radius);
+                it->second.misses = 0;
+            }
+        }
+
+        // Skip the update if records were evicted after it was registered (its indices may no longer be valid)
+        if(epoch != grid.epoch)
+            continue;
+
+        auto& cell = grid.cells.at(key);
+
+        // Increment priority of the record (irecord) in its cluster (jcluster)
+        cell.clusters[jcluster].priority.increment(irecord);
+
+        // Increment priority of the cluster (jcluster) with respect to starting cluster (icluster)
+        cell.connectivity.increment(icluster, jcluster);
+
+        // Increment priority of the cluster (jcluster)
+        cell.priority.increment(jcluster);
+
+        // Register when the record was last used
+        cell.clusters[jcluster].records[irecord].lastused = ++grid.time;
+    }
+}
+
+/// Evict the least used records in a grid if their number or memory exceeds a given budget, except a given one (if any).
+auto evictRecords(SmartEquilibriumSolver::Grid& grid, Index maxrecords, Index maxbytes, double fraction, SmartEquilibriumKnowledgeBase::RecordIndex const* keep) -> Index
+{
+    const auto overrecords = maxrecords && grid.numrecords > maxrecords;
+    const auto overbytes = maxbytes && grid.numbytes > maxbytes;
+
+    if(!overrecords && !overbytes)
+        return 0;
+
+    // Skip if records were evicted (by another solver sharing this knowledge base) after the learned calculation to keep was identified
+    if(keep && keep->epoch != grid.epoch)
+        return 0;
+
+    // The cell containing the learned calculation to keep (if any)
+    Cell const* keepcell = keep ? &grid.cells.at(keep->cell) : nullptr;
+
+    /// Used to describe a learned calculation that can be evicted.
+    struct Candidate
+    {
+        Cell* cell;
+        Index icluster;
+        Index irecord;
+        Index usage;
+        Index lastused;
+    };
+
+    Vec<Candidate> candidates;
+    candidates.reserve(grid.numrecords);
+
+    for(auto& [key, cell] : grid.cells)
+    {
+        for(auto icluster = 0; icluster < cell.clusters.size(); ++icluster)
+        {
+            auto const& cluster = cell.clusters[icluster];
+            for(auto irecord = 0; irecord < cluster.records.size(); ++irecord)
+            {
+                if(&cell == keepcell && icluster == keep->icluster && irecord == keep->irecord) // never evict the learned calculation to keep
+                    continue;
+                candidates.push_back({ &cell, Index(icluster), Index(irecord), cluster.priority.priorities()[irecord], cluster.records[irecord].lastused });
+            }
+        }
+    }
+
+    auto& numrecords = grid.numrecords;
+    auto& numbytes = grid.numbytes;
+
+    const Index targetrecords = maxrecords ? fraction * maxrecords : numrecords;
+    const Index targetbytes = maxbytes ? fraction * maxbytes : numbytes;
+
+    // Sort the learned calculations so that the least used ones (and among these, the least recently used ones) come first
+    std::sort(candidates.begin(), candidates.end(), [](Candidate const& l, Candidate const& r)
+        { return l.usage < r.usage || (l.usage == r.usage && l.lastused < r.lastused); });
+
+    // Collect the learned calculations to be evicted in each cluster of each cell
+    Map<Cell*, Map<Index, Indices>> evicted;
+    Index numevicted = 0;
+
+    for(auto const& candidate : candidates)
+    {
+        if(numrecords <= targetrecords && numbytes <= targetbytes)
+            break;
+        auto const& record = candidate.cell->clusters[candidate.icluster].records[candidate.irecord];
+        numrecords -= 1;
+        numbytes -= record.memoryUsage();
+        evicted[candidate.cell][candidate.icluster].push_back(candidate.irecord);
+        numevicted += 1;
+    }
+
+    // The value used to mark an evicted record in the lists of new record indices below
+    const auto removed = Index(-1);
+
+    for(auto& [cell, clusters] : evicted)
+    {
+        // The new index of each record in each cluster with evicted records (or `removed` if evicted)
+        Map<Index, Indices> newindices;
+
+        for(auto& [icluster, irecords] : clusters)
+        {
+            auto& cluster = cell->clusters[icluster];
+
+            auto& newindex = newindices[icluster];
+            newindex.assign(cluster.records.size(), 0);
+            for(auto irecord : irecords)
+                newindex[irecord] = removed;
+            Index count = 0;
+            for(auto& i : newindex)
+                if(i != removed)
+                    i = count++;
+
+            // Remove the records in reverse order so that the indices of those yet to be removed remain valid
+            std::sort(irecords.rbegin(), irecords.rend());
+            for(auto irecord : irecords)
+            {
+                cluster.records.erase(cluster.records.begin() + irecord);
+                cluster.priority.remove(irecord);
+            }
+        }
+
+        // Rebuild the k-d tree of the cell with the inputs of the remaining records (note KdTree does not support removal)
+        KdTree tree(cell->tree.dimension());
+        Deque<Pair<Index, Index>> treeentries;
+
+        for(auto i = 0; i < cell->treeentries.size(); ++i)
+        {
+            auto [icluster, irecord] = cell->treeentries[i];
+            const auto it = newindices.find(icluster);
+            if(it != newindices.end())
+                irecord = it->second[irecord];
+            if(irecord == removed)
+                continue;
+            treeentries.push_back({ icluster, irecord });
+            tree.insert(cell->tree.point(i));
+        }
+
+        cell->tree = std::move(tree);
+        cell->treeentries = std::move(treeentries);
+    }
+
+    // Invalidate the pending updates of usage counts, which may refer to evicted or shifted records
+    grid.epoch += 1;
+
+    return numevicted;
+}
+
+} // namespace
+
+struct SmartEquilibriumKnowledgeBase::Impl
+{
+    /// The temperature-pressure grid cells containing the learned calculations.
+    Grid grid;
+
+    /// The mutex that allows concurrent reads and exclusive writes of the learned calculations.
+    mutable std::shared_mutex mutex;
+
+    /// Construct a default SmartEquilibriumKnowledgeBase::Impl object.
+    Impl()
+    {}
+
+    /// Construct a copy of a SmartEquilibriumKnowledgeBase::Impl object.
+    Impl(Impl const& other)
+    {
+        std::shared_lock lock(other.mutex);
+        grid = other.grid;
+    }
+};
+
+SmartEquilibriumKnowledgeBase::SmartEquilibriumKnowledgeBase()
+: pimpl(new Impl())
+{}
+
+SmartEquilibriumKnowledgeBase::SmartEquilibriumKnowledgeBase(SmartEquilibriumKnowledgeBase const& other)
+: pimpl(new Impl(*other.pimpl))
+{}
+
+SmartEquilibriumKnowledgeBase::~SmartEquilibriumKnowledgeBase()
+{}
+
+auto SmartEquilibriumKnowledgeBase::operator=(SmartEquilibriumKnowledgeBase other) -> SmartEquilibriumKnowledgeBase&
+{
+    pimpl = std::move(other.pimpl);
+    return *this;
+}
+
+auto SmartEquilibriumKnowledgeBase::size() const -> Index
+{
+    std::shared_lock lock(pimpl->mutex);
+    return pimpl->grid.numrecords;
+}
+
+auto SmartEquilibriumKnowledgeBase::memoryUsage() const -> Index
+{
+    std::shared_lock lock(pimpl->mutex);
+    return pimpl->grid.numbytes;
+}
+
+auto SmartEquilibriumKnowledgeBase::read(Fn<void(Grid const&)> const& fn) const -> void
+{
+    std::shared_lock lock(pimpl->mutex);
+    fn(pimpl->grid);
+}
+
+auto SmartEquilibriumKnowledgeBase::write(Fn<void(Grid&)> const& fn) -> void
+{
+    std::unique_lock lock(pimpl->mutex);
+    fn(pimpl->grid);
+}
+
+auto SmartEquilibriumKnowledgeBase::updatePriorities(Vec<PriorityUpdate> const& updates) -> void
+{
+    std::unique_lock lock(pimpl->mutex);
+    applyPriorityUpdates(pimpl->grid, updates);
+}
+
+auto SmartEquilibriumKnowledgeBase::evict(Index maxrecords, Index maxbytes, double fraction) -> Index
+{
+    std::unique_lock lock(pimpl->mutex);
+    return evictRecords(pimpl->grid, maxrecords, maxbytes, fraction, nullptr);
+}
+
+auto SmartEquilibriumKnowledgeBase::evict(Index maxrecords, Index maxbytes, double fraction, RecordIndex const& keep) -> Index
+{
+    std::unique_lock lock(pimpl->mutex);
+    return evictRecords(pimpl->grid, maxrecords, maxbytes, fraction, &keep);
+}
+
+auto SmartEquilibriumKnowledgeBase::save(String const& filename) const -> void
+{
+    std::shared_lock lock(pimpl->mutex);
+
+    BinaryWriter writer(filename);
+
+    writer.bytes(filemagic, sizeof(filemagic));
+    writer.integer(fileversion);
+    writer.integer(pimpl->grid.time);
+    writer.integer(pimpl->grid.cells.size());
+
+    for(auto const& [key, cell] : pimpl->grid.cells)
+    {
+        writer.integer(key.first);
+        writer.integer(key.second);
+
+        writer.integer(cell.clusters.size());
+        for(auto const& cluster : cell.clusters)
+        {
+            writer.integers(cluster.iprimary);
+            writer.integer(cluster.label);
+            writer.integer(cluster.restrictions);
+            writer.queue(cluster.priority);
+            writer.integer(cluster.records.size());
+            for(auto const& record : cluster.records)
+                writeRecord(writer, record);
+        }
+
+        for(auto i = 0; i < cell.clusters.size(); ++i)
+        {
+            writer.integers(cell.connectivity.clusters(i));
+            writer.queue(cell.connectivity.queue(i));
+        }
+        writer.queue(cell.connectivity.queue(cell.clusters.size())); // the queue based on usage count of the clusters
+        writer.queue(cell.priority);
+
+        writer.integer(cell.radius);
+        writer.integer(cell.misses);
+
+        writer.numbers(cell.scaling.array());
+        writer.integer(cell.tree.dimension());
+        writer.integer(cell.treeentries.size());
+        for(auto i = 0; i < cell.treeentries.size(); ++i)
+        {
+            writer.integer(cell.treeentries[i].first);
+            writer.integer(cell.treeentries[i].second);
+            writer.numbers(cell.tree.point(i).array());
+        }
+    }
+
+    errorif(!writer.out, "Could not write the learned calculations of a SmartEquilibriumKnowledgeBase object to file `", filename, "`.");
+}
+
+auto SmartEquilibriumKnowledgeBase::load(String const& filename, EquilibriumSpecs const& specs) -> void
+{
+    BinaryReader reader(filename);
+
+    errorif(std::memcmp(reader.bytes(sizeof(filemagic)), filemagic, sizeof(filemagic)) != 0,
+        "The file `", filename, "` does not contain learned calculations of a SmartEquilibriumKnowledgeBase object.");
+
+    const auto version = reader.integer();
+
+    errorif(version != fileversion, "The file `", filename, "` contains learned calculations of a SmartEquilibriumKnowledgeBase object "
+        "in format version ", version, ", but only version ", fileversion, " is supported.");
+
+    const EquilibriumDims dims(specs);
+    const auto Nu = VectorXd(ChemicalState(specs.system()).props()).size();
+
+    Grid grid;
+
+    grid.time = reader.integer();
+
+    const auto numcells = reader.length();
+    for(auto icell = 0; icell < numcells; ++icell)
+    {
+        const auto iT = reader.integer();
+        const auto iP = reader.integer();
+
+        auto& cell = grid.cells[{iT, iP}];
+
+        const auto numclusters = reader.length();
+        for(auto icluster = 0; icluster < numclusters; ++icluster)
+        {
+            Cluster cluster;
+            cluster.iprimary = reader.integers().cast<Eigen::Index>();
+            cluster.label = reader.integer();
+            cluster.restrictions = reader.integer();
+            cluster.priority = reader.queue();
+            const auto numrecords = reader.length();
+            for(auto irecord = 0; irecord < numrecords; ++irecord)
+            {
+                cluster.records.push_back(readRecord(reader, specs, dims, Nu));
+                auto& record = cluster.records.back();
+                if(!grid.names)
+                    grid.names = record.predictor.names();
+                record.predictor.shareNames(grid.names);
+                grid.numrecords += 1;
+                grid.numbytes += record.memoryUsage();
+            }
+            errorif(cluster.priority.size() != cluster.records.size(), "The file `", filename, "` with learned calculations of a SmartEquilibriumKnowledgeBase object is corrupted.");
+            cell.clusters.push_back(std::move(cluster));
+        }
+
+        Deque<Indices> visited;
+        Deque<PriorityQueue> queues;
+        for(auto i = 0; i < numclusters; ++i)
+        {
+            const auto clusters = reader.indices();
+            for(auto j : clusters)
+                errorif(j >= numclusters, "The file `", filename, "` with learned calculations of a SmartEquilibriumKnowledgeBase object is corrupted.");
+            visited.push_back(Indices(clusters.begin(), clusters.end()));
+            queues.push_back(reader.queue());
+            errorif(queues.back().size() != visited.back().size(), "The file `", filename, "` with learned calculations of a SmartEquilibriumKnowledgeBase object is corrupted.");
+        }
+        cell.connectivity = ClusterConnectivity::withInitialQueues(visited, queues, reader.queue());
+        cell.priority = reader.queue();
+
+        cell.radius = reader.integer();
+        cell.misses = reader.integer();
+
+        cell.scaling = reader.numbers().matrix();
+        const Index dimension = reader.integer();
+        errorif(dimension != Index(cell.scaling.size()), "The file `", filename, "` with learned calculations of a SmartEquilibriumKnowledgeBase object is corrupted.");
+        cell.tree = KdTree(dimension); // also for a cell whose records were all evicted, so that its tree accepts new points and searches
+        const auto numpoints = reader.length();
+        for(auto i = 0; i < numpoints; ++i)
+        {
+            const Index icluster = reader.integer();
+            const Index irecord = reader.integer();
+            errorif(icluster >= cell.clusters.size() || irecord >= cell.clusters[icluster].records.size(),
+                "The file `", filename, "` with learned calculations of a SmartEquilibriumKnowledgeBase object is corrupted.");
+            cell.treeentries.push_back({ icluster, irecord });
+            const VectorXd point = reader.numbers().matrix();
+            errorif(Index(point.size()) != dimension, "The file `", filename, "` with learned calculations of a SmartEquilibriumKnowledgeBase object is corrupted.");
+            cell.tree.insert(point);
+        }
+    }
+
+    std::unique_lock lock(pimpl->mutex);
+
+    // Continue counting from the replaced learned calculations so that updates of usage counts registered before loading are discarded
+    grid.epoch = pimpl->grid.epoch + 1;
+
+    pimpl->grid = std::move(grid);
+}
+
+auto SmartEquilibriumKnowledgeBase::tryUpdatePriorities(Vec<PriorityUpdate> const& updates) -> bool
+{
+    std::unique_lock lock(pimpl->mutex, std::try_to_lock);
+    if(!lock.owns_lock())
+        return false;
+    applyPriorityUpdates(pimpl->grid, updates);
+    return true;
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,179 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+#include <Reaktoro/Equilibrium/SmartEquilibriumSolver.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class EquilibriumSpecs;
+
+/// Used to store the calculations learned by SmartEquilibriumSolver objects.
+/// A knowledge base can be shared among several SmartEquilibriumSolver
+/// objects, including those used in different threads, so that a calculation
+/// learned by one solver speeds up the predictions of all others (see
+/// SmartEquilibriumSolver::setKnowledgeBase). Many threads can search the
+/// learned calculations concurrently. Storing a new learned calculation
+/// requires exclusive access, which waits for ongoing searches. The usage
+/// counts of the learned calculations are not updated during searches.
+/// Instead, each solver collects these updates and applies them only when
+/// exclusive access is available without waiting, so readers are never
+/// serialized by them. The learned calculations can be saved to a file (see
+/// @ref save) and loaded in a later run (see @ref load), so that the training
+/// of a knowledge base can be reused.
+class SmartEquilibriumKnowledgeBase
+{
+public:
+    /// The temperature-pressure grid cells containing the learned calculations.
+    using Grid = SmartEquilibriumSolver::Grid;
+
+    /// Used to describe the increment of usage counts after a successful prediction with a learned calculation.
+    struct PriorityUpdate
+    {
+        /// The rounded temperature and pressure identifying the grid cell of the learned calculation.
+        Pair<long, long> cell;
+
+        /// The index of the cluster in which the search started.
+        Index icluster;
+
+        /// The index of the cluster containing the learned calculation.
+        Index jcluster;
+
+        /// The index of the learned calculation in its cluster.
+        Index irecord;
+
+        /// The value of Grid::epoch when the learned calculation was used (the update is discarded if records were evicted since then).
+        Index epoch;
+
+        /// The rounded temperature and pressure identifying the grid cell of the predicted state.
+        Pair<long, long> home;
+
+        /// The minimum search radius of the grid cell of the predicted state after this prediction (zero if the learned calculation is in that cell).
+        Index radius;
+    };
+
+    /// Used to identify a learned calculation in the knowledge base.
+    struct RecordIndex
+    {
+        /// The rounded temperature and pressure identifying the grid cell of the learned calculation.
+        Pair<long, long> cell;
+
+        /// The index of the cluster containing the learned calculation.
+        Index icluster;
+
+        /// The index of the learned calculation in its cluster.
+        Index irecord;
+
+        /// The value of Grid::epoch when the learned calculation was identified (the index is no longer valid if records were evicted since then).
+        Index epoch;
+    };
+
+    /// Construct a default SmartEquilibriumKnowledgeBase object.
+    SmartEquilibriumKnowledgeBase();
+
+    /// Construct a copy of a SmartEquilibriumKnowledgeBase object.
+    SmartEquilibriumKnowledgeBase(SmartEquilibriumKnowledgeBase const& other);
+
+    /// Destroy this SmartEquilibriumKnowledgeBase object.
+    ~SmartEquilibriumKnowledgeBase();
+
+    /// Assign a copy of a SmartEquilibriumKnowledgeBase object to this.
+    auto operator=(SmartEquilibriumKnowledgeBase other) -> SmartEquilibriumKnowledgeBase&;
+
+    /// Return the number of learned calculations in the knowledge base.
+    auto size() const -> Index;
+
+    /// Return the number of bytes used to store the learned calculations, excluding the search data structures.
+    /// Divide by @ref size to obtain the number of bytes per learned calculation.
+    /// This number is kept up to date as learned calculations are stored and
+    /// evicted, so this method does not iterate over them.
+    auto memoryUsage() const -> Index;
+
+    /// Execute a function with shared access to the learned calculations.
+    /// Other threads can execute this method concurrently.
+    auto read(Fn<void(Grid const&)> const& fn) const -> void;
+
+    /// Execute a function with exclusive access to the learned calculations.
+    /// This waits until no other thread is accessing the learned calculations.
+    auto write(Fn<void(Grid&)> const& fn) -> void;
+
+    /// Apply given increments of usage counts, waiting for exclusive access if needed.
+    auto updatePriorities(Vec<PriorityUpdate> const& updates) -> void;
+
+    /// Apply given increments of usage counts only if exclusive access is available without waiting.
+    /// @return True if the increments have been applied, false otherwise (in which case they should be tried again later).
+    auto tryUpdatePriorities(Vec<PriorityUpdate> const& updates) -> bool;
+
+    /// Evict the least used learned calculations if the number of learned calculations or the memory they use exceeds a given budget.
+    /// The learned calculations with the lowest usage counts are evicted
+    /// first, and among those with equal usage counts, those used least
+    /// recently. Evictions continue until the number of learned calculations
+    /// and the memory they use are below the given fraction of the budget, so
+    /// that evictions are not needed after every new learned calculation.
+    /// @param maxrecords The maximum number of learned calculations (zero for no limit).
+    /// @param maxbytes The maximum number of bytes used by the learned calculations (zero for no limit, see @ref memoryUsage).
+    /// @param fraction The fraction of the budget that remains in use after evictions (between zero and one).
+    /// @return The number of evicted learned calculations.
+    auto evict(Index maxrecords, Index maxbytes, double fraction) -> Index;
+
+    /// Evict the least used learned calculations, except a given one, if the number of learned calculations or the memory they use exceeds a given budget.
+    /// The given learned calculation, usually the one just stored, is never
+    /// evicted. If records were evicted since it was identified, no records
+    /// are evicted, since the budget has just been enforced.
+    /// @param maxrecords The maximum number of learned calculations (zero for no limit).
+    /// @param maxbytes The maximum number of bytes used by the learned calculations (zero for no limit, see @ref memoryUsage).
+    /// @param fraction The fraction of the budget that remains in use after evictions (between zero and one).
+    /// @param keep The learned calculation that must not be evicted.
+    /// @return The number of evicted learned calculations.
+    auto evict(Index maxrecords, Index maxbytes, double fraction, RecordIndex const& keep) -> Index;
+
+    /// Save the learned calculations in a binary file.
+    /// The file stores, for each learned calculation, its reference species
+    /// amounts *n*, control variables *p* and *q*, input variables *w*,
+    /// component amounts *c*, serialized chemical properties *u*, and
+    /// sensitivity derivatives (see EquilibriumPredictor::derivatives) and
+    /// directional second-order derivatives (see EquilibriumPredictor::curvature),
+    /// together with the primary species and usage counts of the clusters and
+    /// learned calculations, when the learned calculations were last used
+    /// (see Grid::time), and the search radii of the temperature-pressure
+    /// grid cells. Numbers are stored as 8-byte values in the native
+    /// byte order of the machine.
+    /// @param filename The path to the file.
+    auto save(String const& filename) const -> void;
+
+    /// Load the learned calculations from a binary file created with @ref save, replacing the current ones.
+    /// The whole file is read into memory and the learned calculations are
+    /// then reconstructed from it, so the knowledge base does not refer to
+    /// the file after loading. The chemical equilibrium specifications must
+    /// be the same as those used by the solvers that learned the saved
+    /// calculations. Pending increments of usage counts of solvers sharing
+    /// this knowledge base, registered before loading, are discarded.
+    /// @param filename The path to the file.
+    /// @param specs The chemical equilibrium specifications of the solvers using this knowledge base.
+    auto load(String const& filename, EquilibriumSpecs const& specs) -> void;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
@@ -22,6 +22,16 @@
 
 namespace Reaktoro {
 
+/// The strategies for searching the learned calculations used to predict new chemical equilibrium states.
+enum class SmartEquilibriumSearch
+{
+    /// The learned calculations are visited in the order of the usage counts of their clusters and of their own usage counts.
+    Priority,
+
+    /// The learned calculations nearest to the new calculation in the space of normalized inputs *(w, c)* are visited first.
+    NearestNeighbors,
+};
+
 /// The options for the smart equilibrium calculations.
 /// @see SmartEquilibriumSolver
 struct SmartEquilibriumOptions
@@ -53,6 +63,60 @@ struct SmartEquilibriumOptions
 
     /// The step length used to discretize pressure in the temperature-pressure space when storing learned calculations (in Pa).
     double pressure_step = 25.0e+5;
+
+    /// The initial number of neighbor temperature-pressure grid cells, in each direction, searched when no learned calculation in the cell of a new state is acceptable.
+    /// The default value of zero restricts predictions to the learned
+    /// calculations in the cell of the new state. Otherwise, the radius of each
+    /// cell adapts to the acceptance of its predictions (see SmartEquilibriumSolver::Cell::radius).
+    Index neighbor_cells_radius = 0;
+
+    /// The maximum number of neighbor temperature-pressure grid cells, in each direction, searched when no learned calculation in the cell of a new state is acceptable.
+    Index neighbor_cells_max_radius = 3;
+
+    /// The number of consecutive calculations learned in a cell after searching its neighbor cells without success that shrinks its search radius by one.
+    Index neighbor_cells_max_misses = 5;
+
+    /// The flag indicating if all chemical properties of the system are predicted with first-order Taylor approximation.
+    /// If false, only the sensitivity derivatives of the chemical potentials
+    /// of the species, which are needed in the acceptance test of predicted
+    /// states, are computed and stored in learning operations. This reduces
+    /// learning time and the memory used by each learned calculation. The
+    /// chemical properties in a predicted state, other than the chemical
+    /// potentials of the species, are then those of the learned state used
+    /// for the prediction.
+    bool predict_chemical_properties = true;
+
+    /// The flag indicating if the sensitivity derivatives of learned calculations are stored in single precision.
+    /// This halves the memory used by the sensitivity derivatives, which
+    /// dominate the memory used by each learned calculation, at the expense
+    /// of less accurate predictions (see SmartEquilibriumKnowledgeBase::memoryUsage).
+    bool single_precision_derivatives = false;
+
+    /// The flag indicating if predictions use second-order derivatives estimated with the nearest learned calculation with the same primary species.
+    /// When a calculation is learned, the change in the sensitivity
+    /// derivatives from the nearest learned calculation in the same cluster
+    /// gives the second-order derivatives along the direction between both
+    /// (see EquilibriumPredictor::setCurvature). Predictions along this
+    /// direction are then more accurate and the acceptance test uses their
+    /// estimated errors, so that fewer calculations need to be learned.
+    bool second_order_predictions = false;
+
+    /// The maximum number of learned calculations kept in the knowledge base (zero for no limit).
+    /// When exceeded, the least used learned calculations are evicted (see SmartEquilibriumKnowledgeBase::evict).
+    Index max_num_records = 0;
+
+    /// The maximum memory used by the learned calculations in the knowledge base, in bytes (zero for no limit).
+    /// When exceeded, the least used learned calculations are evicted (see SmartEquilibriumKnowledgeBase::evict).
+    Index max_memory_usage = 0;
+
+    /// The fraction of the maximum number of learned calculations or of their maximum memory that remains in use after evictions.
+    double eviction_fraction = 0.9;
+
+    /// The strategy for searching the learned calculations used to predict new chemical equilibrium states.
+    SmartEquilibriumSearch search = SmartEquilibriumSearch::Priority;
+
+    /// The maximum number of nearest learned calculations tested in a prediction when using SmartEquilibriumSearch::NearestNeighbors.
+    Index search_num_nearest = 8;
 };
 
 } // namespace Reaktoro
@@ -24,12 +24,28 @@ using namespace Reaktoro;
 
 void exportSmartEquilibriumOptions(py::module& m)
 {
+    py::enum_<SmartEquilibriumSearch>(m, "SmartEquilibriumSearch")
+        .value("Priority"         , SmartEquilibriumSearch::Priority         , "The learned calculations are visited in the order of the usage counts of their clusters and of their own usage counts.")
+        .value("NearestNeighbors" , SmartEquilibriumSearch::NearestNeighbors , "The learned calculations nearest to the new calculation in the space of normalized inputs (w, c) are visited first.")
+        ;
+
     py::class_<SmartEquilibriumOptions>(m, "SmartEquilibriumOptions")
         .def(py::init<>())
         .def_readwrite("learning", &SmartEquilibriumOptions::learning, "The options for the chemical equilibrium calculations during learning operations.")
         .def_readwrite("reltol_negative_amounts", &SmartEquilibriumOptions::reltol_negative_amounts, "The relative tolerance for negative species amounts when predicting with first-order Taylor approximation.")
         .def_readwrite("reltol", &SmartEquilibriumOptions::reltol, "The relative tolerance used in the acceptance test for the predicted chemical equilibrium state.")
         .def_readwrite("abstol", &SmartEquilibriumOptions::abstol, "The absolute tolerance used in the acceptance test for the predicted chemical equilibrium state.")
+        .def_readwrite("neighbor_cells_radius", &SmartEquilibriumOptions::neighbor_cells_radius, "The initial number of neighbor temperature-pressure grid cells, in each direction, searched when no learned calculation in the cell of a new state is acceptable.")
+        .def_readwrite("neighbor_cells_max_radius", &SmartEquilibriumOptions::neighbor_cells_max_radius, "The maximum number of neighbor temperature-pressure grid cells, in each direction, searched when no learned calculation in the cell of a new state is acceptable.")
+        .def_readwrite("neighbor_cells_max_misses", &SmartEquilibriumOptions::neighbor_cells_max_misses, "The number of consecutive calculations learned in a cell after searching its neighbor cells without success that shrinks its search radius by one.")
+        .def_readwrite("predict_chemical_properties", &SmartEquilibriumOptions::predict_chemical_properties, "The flag indicating if all chemical properties of the system are predicted with first-order Taylor approximation.")
+        .def_readwrite("single_precision_derivatives", &SmartEquilibriumOptions::single_precision_derivatives, "The flag indicating if the sensitivity derivatives of learned calculations are stored in single precision.")
+        .def_readwrite("second_order_predictions", &SmartEquilibriumOptions::second_order_predictions, "The flag indicating if predictions use second-order derivatives estimated with the nearest learned calculation with the same primary species.")
+        .def_readwrite("max_num_records", &SmartEquilibriumOptions::max_num_records, "The maximum number of learned calculations kept in the knowledge base (zero for no limit).")
+        .def_readwrite("max_memory_usage", &SmartEquilibriumOptions::max_memory_usage, "The maximum memory used by the learned calculations in the knowledge base, in bytes (zero for no limit).")
+        .def_readwrite("eviction_fraction", &SmartEquilibriumOptions::eviction_fraction, "The fraction of the maximum number of learned calculations or of their maximum memory that remains in use after evictions.")
+        .def_readwrite("search", &SmartEquilibriumOptions::search, "The strategy for searching the learned calculations used to predict new chemical equilibrium states.")
+        .def_readwrite("search_num_nearest", &SmartEquilibriumOptions::search_num_nearest, "The maximum number of nearest learned calculations tested in a prediction when using SmartEquilibriumSearch.NearestNeighbors.")
         ;
 }
 
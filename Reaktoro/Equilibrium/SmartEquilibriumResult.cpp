@@ -43,6 +43,7 @@ auto SmartEquilibriumResultDuringPrediction::operator+=(const SmartEquilibriumRe
     failed_with_species = other.failed_with_species;
     failed_with_amount = other.failed_with_amount;
     failed_with_chemical_potential = other.failed_with_chemical_potential;
+    estimated_error = other.estimated_error;
 
     return *this;
 }
@@ -50,6 +51,8 @@ auto SmartEquilibriumResultDuringPrediction::operator+=(const SmartEquilibriumRe
 auto SmartEquilibriumResultDuringLearning::operator+=(const SmartEquilibriumResultDuringLearning& other) -> SmartEquilibriumResultDuringLearning&
 {
     solve +=other.solve;
+    num_evicted += other.num_evicted;
+    num_records = other.num_records;
 
     return *this;
 }
@@ -82,6 +82,10 @@ struct SmartEquilibriumResultDuringPrediction
     /// The amount of the species that caused the smart approximation to fail.
     double failed_with_chemical_potential;
 
+    /// The largest estimated error in the chemical potentials of the primary species of an accepted prediction (in J/mol).
+    /// @see EquilibriumPredictor::primarySpeciesChemicalPotentialsErrorEstimate
+    double estimated_error = 0.0;
+
     // Self addition assignment to accumulate results.
     auto operator+=(const SmartEquilibriumResultDuringPrediction& other) -> SmartEquilibriumResultDuringPrediction&;
 };
@@ -93,6 +97,12 @@ struct SmartEquilibriumResultDuringLearning
     /// The result of the conventional iterative chemical equilibrium calculation in the learning operation.
     EquilibriumResult solve;
 
+    /// The number of learned calculations evicted from the knowledge base after storing the new one.
+    Index num_evicted = 0;
+
+    /// The number of learned calculations in the knowledge base after the learning operation.
+    Index num_records = 0;
+
     /// Self addition assignment to accumulate results.
     auto operator+=(const SmartEquilibriumResultDuringLearning& other) -> SmartEquilibriumResultDuringLearning&;
 };
@@ -47,12 +47,15 @@ void exportSmartEquilibriumResult(py::module& m)
         .def_readwrite("failed_with_species", &SmartEquilibriumResultDuringPrediction::failed_with_species)
         .def_readwrite("failed_with_amount", &SmartEquilibriumResultDuringPrediction::failed_with_amount)
         .def_readwrite("failed_with_chemical_potential", &SmartEquilibriumResultDuringPrediction::failed_with_chemical_potential)
+        .def_readwrite("estimated_error", &SmartEquilibriumResultDuringPrediction::estimated_error)
         .def(py::self += py::self)
         ;
 
     py::class_<SmartEquilibriumResultDuringLearning>(m, "SmartEquilibriumResultDuringLearning")
         .def(py::init<>())
         .def_readwrite("solve", &SmartEquilibriumResultDuringLearning::solve)
+        .def_readwrite("num_evicted", &SmartEquilibriumResultDuringLearning::num_evicted)
+        .def_readwrite("num_records", &SmartEquilibriumResultDuringLearning::num_records)
         .def(py::self += py::self)
         ;
 
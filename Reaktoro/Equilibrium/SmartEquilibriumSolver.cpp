@@ -17,7 +17,13 @@
 
 #include "SmartEquilibriumSolver.hpp"
 
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
 // Reaktoro includes
+#include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/Profiling.hpp>
 #include <Reaktoro/Core/ChemicalProps.hpp>
@@ -29,8 +35,10 @@
 #include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
+#include <Reaktoro/Equilibrium/SmartEquilibriumKnowledgeBase.hpp>
 #include <Reaktoro/Equilibrium/SmartEquilibriumOptions.hpp>
 #include <Reaktoro/Equilibrium/SmartEquilibriumResult.hpp>
+#include <Reaktoro/Equilibrium/SmartEquilibriumStatistics.hpp>
 
 namespace Reaktoro {
 namespace detail {
@@ -45,6 +53,77 @@ auto sround(double num, double step) -> long
     return round(num / step) * step;
 }
 
+/// Return the hash number of the species with reactivity restrictions, used to separate learned calculations with different restrictions.
+/// The bounds on the amounts of these species are not part of the hash
+/// number, since these change from one calculation to another. Zero is
+/// returned if there are no restrictions.
+auto hashRestrictions(EquilibriumRestrictions const& restrictions) -> Index
+{
+    auto const& cannotincrease = restrictions.speciesCannotIncrease();
+    auto const& cannotdecrease = restrictions.speciesCannotDecrease();
+    auto const& cannotincreaseabove = restrictions.speciesCannotIncreaseAbove();
+    auto const& cannotdecreasebelow = restrictions.speciesCannotDecreaseBelow();
+
+    if(cannotincrease.empty() && cannotdecrease.empty() && cannotincreaseabove.empty() && cannotdecreasebelow.empty())
+        return 0;
+
+    // The sorted indices of the restricted species of each kind (the hash number must not depend on the order of the unordered containers)
+    auto sorted = [](auto const& container)
+    {
+        Indices indices;
+        for(auto const& entry : container)
+        {
+            if constexpr(std::is_same_v<std::decay_t<decltype(entry)>, Index>)
+                indices.push_back(entry);
+            else indices.push_back(entry.first);
+        }
+        std::sort(indices.begin(), indices.end());
+        return indices;
+    };
+
+    return hashCombine(hashVector(sorted(cannotincrease)), hashVector(sorted(cannotdecrease)), hashVector(sorted(cannotincreaseabove)), hashVector(sorted(cannotdecreasebelow)));
+}
+
+/// Return the temperature-pressure grid cells around the one containing a given temperature and pressure.
+/// Each cell is returned with its distance to the central cell, in number of
+/// cells. The cells are ordered by increasing distance and, at equal distance,
+/// by the proximity of their centers to the given temperature and pressure.
+/// @param T The temperature (in K)
+/// @param P The pressure (in Pa)
+/// @param Tstep The step length used to discretize temperature
+/// @param Pstep The step length used to discretize pressure
+/// @param radius The number of neighbor cells in each direction
+auto neighborCells(double T, double P, double Tstep, double Pstep, Index radius) -> Vec<Pair<Pair<long, long>, Index>>
+{
+    // The offsets of the temperature and pressure from the center of their cell (in number of cells)
+    const auto dT = T / Tstep - round(T / Tstep);
+    const auto dP = P / Pstep - round(P / Pstep);
+
+    const auto r = static_cast<long>(radius);
+
+    Vec<Tuple<long, double, Pair<long, long>>> cells;
+    for(auto i = -r; i <= r; ++i)
+    {
+        for(auto j = -r; j <= r; ++j)
+        {
+            const auto distance = std::max(std::abs(i), std::abs(j));
+            if(distance == 0)
+                continue;
+            const auto proximity = (i - dT)*(i - dT) + (j - dP)*(j - dP);
+            cells.push_back({ distance, proximity, { sround(T + i*Tstep, Tstep), sround(P + j*Pstep, Pstep) } });
+        }
+    }
+
+    std::sort(cells.begin(), cells.end());
+
+    Vec<Pair<Pair<long, long>, Index>> neighbors;
+    neighbors.reserve(cells.size());
+    for(auto const& [distance, proximity, key] : cells)
+        neighbors.push_back({ key, distance });
+
+    return neighbors;
+}
+
 } // namespace detail
 
 struct SmartEquilibriumSolver::Impl
@@ -59,12 +138,27 @@ struct SmartEquilibriumSolver::Impl
 
     SmartEquilibriumResult result;
 
-    /// The temperature-pressure grid containing learned calculations for speficic temperature-pressure intervals.
-    SmartEquilibriumSolver::Grid grid;
+    /// The statistics of the smart equilibrium calculations of this solver since its construction or the last reset.
+    SmartEquilibriumStatistics stats;
+
+    /// The knowledge base containing learned calculations for specific temperature-pressure intervals (possibly shared with other solvers).
+    SharedPtr<SmartEquilibriumKnowledgeBase> knowledge = std::make_shared<SmartEquilibriumKnowledgeBase>();
+
+    /// The increments of usage counts of learned calculations after successful predictions not yet applied to the knowledge base.
+    Vec<SmartEquilibriumKnowledgeBase::PriorityUpdate> priorityupdates;
+
+    /// The flag indicating if the last prediction searched learned calculations in neighbor temperature-pressure grid cells without success.
+    bool missedneighbors = false;
+
+    /// The auxiliary equilibrium restrictions used whenever none are given in the solve methods.
+    const EquilibriumRestrictions xrestrictions;
+
+    /// The number of entries in the serialized chemical properties of the system.
+    const Index Nu;
 
     /// Construct a SmartEquilibriumSolver::Impl object with given equilibrium problem specifications.
     Impl(EquilibriumSpecs const& specs)
-    : solver(specs), sensitivity(specs), conditions(specs)
+    : solver(specs), sensitivity(specs), conditions(specs), xrestrictions(specs.system()), Nu(VectorXd(ChemicalProps(specs.system())).size())
     {
         // Initialize the equilibrium solver with the default options
         setOptions(options);
@@ -85,38 +179,19 @@ struct SmartEquilibriumSolver::Impl
 
     auto solve(ChemicalState& state, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
     {
-        errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumRestrictions is currently not supported.");
-        return {};
+        conditions.temperature(state.temperature());
+        conditions.pressure(state.pressure());
+        return solve(state, nullptr, conditions, restrictions);
     }
 
     auto solve(ChemicalState& state, EquilibriumConditions const& conditions) -> SmartEquilibriumResult
     {
-        tic(SOLVE_STEP)
-
-        // Save a backup state in case the smart prediction fails.
-        const auto statebkp = state;
-
-        // Reset the result of the last smart equilibrium calculation
-        result = {};
-
-        // Perform a smart prediction of the chemical state
-        timeit( predict(state, conditions), result.timing.prediction= )
-
-        // Perform a learning step if the smart prediction is not satisfactory
-        if (!result.prediction.accepted) {
-            state = statebkp;
-            timeit(learn(state, conditions), result.timing.learning = )
-        }
-
-        result.timing.solve = toc(SOLVE_STEP);
-
-        return result;
+        return solve(state, nullptr, conditions, xrestrictions);
     }
 
     auto solve(ChemicalState& state, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
     {
-        errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumRestrictions is currently not supported.");
-        return {};
+        return solve(state, nullptr, conditions, restrictions);
     }
 
     //=================================================================================================================
@@ -127,26 +202,69 @@ struct SmartEquilibriumSolver::Impl
 
     auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity) -> SmartEquilibriumResult
     {
-        errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-        return {};
+        conditions.temperature(state.temperature());
+        conditions.pressure(state.pressure());
+        return solve(state, &sensitivity, conditions, xrestrictions);
     }
 
     auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
     {
-        errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-        return {};
+        conditions.temperature(state.temperature());
+        conditions.pressure(state.pressure());
+        return solve(state, &sensitivity, conditions, restrictions);
     }
 
     auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumConditions const& conditions) -> SmartEquilibriumResult
     {
-        errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-        return {};
+        return solve(state, &sensitivity, conditions, xrestrictions);
     }
 
     auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
     {
-        errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-        return {};
+        return solve(state, &sensitivity, conditions, restrictions);
+    }
+
+    /// Equilibrate a chemical state respecting given constraint conditions and reactivity restrictions, and compute its sensitivity derivatives if requested.
+    auto solve(ChemicalState& state, EquilibriumSensitivity* sensitivity, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
+    {
+        tic(SOLVE_STEP)
+
+        // Save a backup state in case the smart prediction fails.
+        const auto statebkp = state;
+
+        // Reset the result of the last smart equilibrium calculation
+        result = {};
+
+        // Perform a smart prediction of the chemical state
+        timeit( predict(state, sensitivity, conditions, restrictions), result.timing.prediction= )
+
+        // Perform a learning step if the smart prediction is not satisfactory
+        if (!result.prediction.accepted) {
+            state = statebkp;
+            timeit(learn(state, sensitivity, conditions, restrictions), result.timing.learning = )
+        }
+
+        // Update the counts of predicted and learned calculations, in total and in the temperature-pressure grid cell of the state
+        const auto iT = detail::sround(statebkp.temperature().val(), options.temperature_step);
+        const auto iP = detail::sround(statebkp.pressure().val(), options.pressure_step);
+
+        auto& cellstats = stats.cells[{iT, iP}];
+
+        stats.num_solves += 1;
+        if(result.prediction.accepted)
+        {
+            stats.num_predictions += 1;
+            cellstats.hits += 1;
+        }
+        else
+        {
+            stats.num_learnings += 1;
+            cellstats.misses += 1;
+        }
+
+        result.timing.solve = toc(SOLVE_STEP);
+
+        return result;
     }
 
     //=================================================================================================================
@@ -156,15 +274,20 @@ struct SmartEquilibriumSolver::Impl
     //=================================================================================================================
 
     /// Perform a learning operation in which a full chemical equilibrium calculation is performed.
-    auto learn(ChemicalState& state, EquilibriumConditions const& conditions) -> void
+    auto learn(ChemicalState& state, EquilibriumSensitivity* outsensitivity, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> void
     {
         //---------------------------------------------------------------------
         // GIBBS ENERGY MINIMIZATION CALCULATION DURING THE LEARNING PROCESS
         //---------------------------------------------------------------------
         tic(EQUILIBRIUM_STEP)
 
+        // The bounds on the species amounts imposed by the reactivity restrictions, given the initial species amounts (unused if there are no restrictions)
+        ArrayXd nlower, nupper;
+        if(detail::hashRestrictions(restrictions))
+            speciesAmountsBounds(restrictions, state.speciesAmounts().cast<double>(), nlower, nupper);
+
         // Perform a full chemical equilibrium solve with sensitivity derivatives calculation
-        result.learning.solve = solver.solve(state, sensitivity, conditions);
+        result.learning.solve = solver.solve(state, sensitivity, conditions, restrictions);
 
         result.timing.learning_solve = toc(EQUILIBRIUM_STEP);
 
@@ -173,76 +296,194 @@ struct SmartEquilibriumSolver::Impl
             return;
         }
 
+        // Return the computed sensitivity derivatives if requested
+        if(outsensitivity)
+            learnedSensitivity(*outsensitivity);
+
         //---------------------------------------------------------------------
         // STORAGE STEP DURING THE LEARNING PROCESS
         //---------------------------------------------------------------------
         tic(STORAGE_STEP)
 
         // Create an equilibrium predictor object with computed equilibrium state and its sensitivities
-        EquilibriumPredictor predictor(state, sensitivity);
+        EquilibriumPredictor predictor(state, sensitivity, options.single_precision_derivatives);
 
         // Round temperature and pressure according to their respective step lengths for discretization
         const auto iT = detail::sround(state.temperature().val(), options.temperature_step);
         const auto iP = detail::sround(state.pressure().val(), options.pressure_step);
 
-        // Get a mutable reference to an existing temperature-pressure cell or create a new one
-        auto& cell = grid.cells[{iT, iP}];
-
         // Generate the hash number for indices of primary species in the state
         const auto iprimary = state.equilibrium().indicesPrimarySpecies();
         const auto label = hashVector(iprimary);
 
-        // Find the index of the cluster within the temperature-pressure grid cell that has the same primary species
-        auto icluster = indexfn(cell.clusters, RKT_LAMBDA(cluster, cluster.label == label));
+        // Generate the hash number for the species with reactivity restrictions
+        const auto rlabel = detail::hashRestrictions(restrictions);
+
+        // The species whose amounts sat on the bounds imposed by the reactivity restrictions and the values of these bounds
+        ArrayXl ibounded;
+        ArrayXd nbounded;
+        if(rlabel)
+            speciesAmountsOnBounds(state.speciesAmounts().cast<double>(), nlower, nupper, ibounded, nbounded);
 
-        // If cluster is found, store the new record in it, otherwise, create a new cluster
-        if (icluster < cell.clusters.size())
+        // The inputs of the new record, used to find its nearest records and to insert it in the k-d tree of its cell
+        const auto w = state.equilibrium().w().matrix();
+        const auto c = state.equilibrium().c().matrix();
+
+        // Complete the new predictor with shared access to the knowledge base, so that predictions in other threads are not blocked
+        knowledge->read([&](Grid const& grid)
         {
-            auto& cluster = cell.clusters[icluster];
-            cluster.records.push_back({ state, conditions, sensitivity, predictor });
-            cluster.priority.extend();
-        }
-        else
+            // Share the names of the input and control variables of the new predictor with those of the other records
+            if(grid.names)
+                predictor.shareNames(grid.names);
+
+            if(!options.second_order_predictions)
+                return;
+
+            const auto it = grid.cells.find({iT, iP});
+            if(it == grid.cells.end() || it->second.tree.empty())
+                return;
+
+            auto const& cell = it->second;
+
+            const auto icluster = indexfn(cell.clusters, RKT_LAMBDA(cluster, cluster.label == label && cluster.restrictions == rlabel));
+            if(icluster >= cell.clusters.size())
+                return;
+
+            // Estimate the second-order derivatives of the new predictor with the nearest record in the same cluster
+            const auto x = normalizedInputs(cell, w, c);
+
+            for(auto ientry : cell.tree.nearest(x, options.search_num_nearest))
+            {
+                const auto [jcluster, irecord] = cell.treeentries[ientry];
+                if(jcluster != icluster || cell.tree.point(ientry) == x) // skip records in other clusters or with the same inputs
+                    continue;
+                predictor.setCurvature(cell.clusters[jcluster].records[irecord].predictor);
+                break;
+            }
+        });
+
+        // The new record, which only needs to be published in the knowledge base from now on
+        Record record{ std::move(predictor), 0, std::move(ibounded), std::move(nbounded) };
+
+        const auto recordbytes = record.memoryUsage();
+
+        // The identity of the new record in the knowledge base, which must not be evicted right after being stored
+        SmartEquilibriumKnowledgeBase::RecordIndex newrecord;
+
+        // Publish the new record with exclusive access to the knowledge base, held only for its insertion
+        knowledge->write([&](Grid& grid)
         {
-            // Create a new cluster within the current temperature-pressure grid cell
-            Cluster cluster;
-            cluster.iprimary = iprimary;
-            cluster.label = label;
-            cluster.records.push_back({ state, conditions, sensitivity, predictor });
+            // The names are stored for the first record, or shared again if another thread stored them after the read above
+            if(!grid.names)
+                grid.names = record.predictor.names();
+            else if(record.predictor.names() != grid.names)
+                record.predictor.shareNames(grid.names);
+
+            // Get a mutable reference to an existing temperature-pressure cell or create a new one
+            auto& cell = grid.cells[{iT, iP}];
+
+            // Initialize the search radius of a new cell, or shrink it if searching its neighbor cells repeatedly failed (splitting it from them)
+            if(cell.clusters.empty())
+                cell.radius = options.neighbor_cells_radius;
+            else if(missedneighbors && ++cell.misses >= options.neighbor_cells_max_misses && cell.radius > 0)
+            {
+                cell.radius -= 1;
+                cell.misses = 0;
+            }
+
+            // Find the index of the cluster within the temperature-pressure grid cell that has the same primary species and restricted species
+            auto icluster = indexfn(cell.clusters, RKT_LAMBDA(cluster, cluster.label == label && cluster.restrictions == rlabel));
+
+            // Create a new cluster within the current temperature-pressure grid cell if none is found
+            if(icluster == cell.clusters.size())
+            {
+                Cluster cluster;
+                cluster.iprimary = iprimary;
+                cluster.label = label;
+                cluster.restrictions = rlabel;
+
+                // Append the new cluster and initialize its connectivity and priority
+                cell.clusters.push_back(std::move(cluster));
+                cell.connectivity.extend();
+                cell.priority.extend();
+            }
+
+            // Store the new record in its cluster
+            auto& cluster = cell.clusters[icluster];
+            record.lastused = ++grid.time;
+            cluster.records.push_back(std::move(record));
             cluster.priority.extend();
 
-            // Append the new cluster and initialize its connectivity and priority
-            cell.clusters.push_back(cluster);
-            cell.connectivity.extend();
-            cell.priority.extend();
+            // Insert the inputs of the new record in the k-d tree of the cell for nearest neighbor searches
+            if(cell.tree.empty())
+            {
+                cell.scaling = inputScaling(w, c);
+                cell.tree = KdTree(cell.scaling.size());
+            }
+            cell.tree.insert(normalizedInputs(cell, w, c));
+            cell.treeentries.push_back({ icluster, cluster.records.size() - 1 });
+
+            grid.numrecords += 1;
+            grid.numbytes += recordbytes;
+
+            newrecord = { {iT, iP}, icluster, cluster.records.size() - 1, grid.epoch };
+        });
+
+        // Apply the pending increments of usage counts from previous predictions
+        if(!priorityupdates.empty())
+        {
+            knowledge->updatePriorities(priorityupdates);
+            priorityupdates.clear();
         }
 
+        // Evict the least used learned calculations if the knowledge base exceeds its budget
+        if(options.max_num_records || options.max_memory_usage)
+            result.learning.num_evicted = knowledge->evict(options.max_num_records, options.max_memory_usage, options.eviction_fraction, newrecord);
+
+        result.learning.num_records = knowledge->size();
+
         result.timing.learning_storage = toc(STORAGE_STEP);
     }
 
     /// Perform a prediction operation in which a chemical equilibrium state is predicted using a first-order Taylor approximation.
-    auto predict(ChemicalState& state, EquilibriumConditions const& conditions) -> void
+    auto predict(ChemicalState& state, EquilibriumSensitivity* outsensitivity, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> void
     {
         // Set the prediction status to false at the beginning
         result.prediction.accepted = false;
+        missedneighbors = false;
+
+        // Search the learned calculations with shared access to the knowledge base (other threads may search it concurrently)
+        knowledge->read([&](Grid const& grid) { predict(grid, state, outsensitivity, conditions, restrictions); });
+
+        // Apply the pending increments of usage counts only if this does not require waiting for other threads
+        if(!priorityupdates.empty() && knowledge->tryUpdatePriorities(priorityupdates))
+            priorityupdates.clear();
+    }
 
+    /// Perform a prediction operation using the learned calculations in a given temperature-pressure grid.
+    auto predict(Grid const& grid, ChemicalState& state, EquilibriumSensitivity* outsensitivity, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> void
+    {
         // Skip prediction operation if no learning data exists yet
         if(grid.cells.empty())
             return;
 
+        const auto T = state.temperature().val();
+        const auto P = state.pressure().val();
+
         // Round temperature and pressure according to their respective step lengths for discretization
-        const auto iT = detail::sround(state.temperature().val(), options.temperature_step);
-        const auto iP = detail::sround(state.pressure().val(), options.pressure_step);
+        const auto iT = detail::sround(T, options.temperature_step);
+        const auto iP = detail::sround(P, options.pressure_step);
 
-        // Find an existing temperature-pressure grid cell within which the state temperature/pressure are located
-        auto it = grid.cells.find({iT, iP});
+        // The temperature-pressure grid cell within which the state temperature/pressure are located (if it exists)
+        const auto home = Pair<long, long>{ iT, iP };
+        const auto it = grid.cells.find(home);
 
-        // Skip prediction operation if no temperature-pressure grid cell with learning data exists yet
-        if(it == grid.cells.end())
-            return;
+        // The number of neighbor cells in each direction searched if no record in the cell of the state is acceptable
+        const auto radius = it != grid.cells.end() ? it->second.radius : options.neighbor_cells_radius;
 
-        // Get a mutable reference to the found temperature-pressure cell
-        auto& cell = it->second;
+        // Skip prediction operation if no temperature-pressure grid cell with learning data exists yet in the searched region
+        if(it == grid.cells.end() && radius == 0)
+            return;
 
         const auto wvals = conditions.inputValuesGetOrCompute(state);
         const auto cvals = conditions.initialComponentAmountsGetOrCompute(state);
@@ -250,80 +491,88 @@ struct SmartEquilibriumSolver::Impl
         const auto w = wvals.cast<double>();
         const auto c = cvals.cast<double>();
 
-        // Auxiliary vectors used in the lambda function below to avoid repeated memory allocation
-        VectorXd dw;
-        VectorXd dc;
+        // The input variables *w* followed by the amounts of the conservative components *c*, as used in the acceptance test below
+        VectorXd x(w.size() + c.size());
+        x << w.matrix(), c.matrix();
 
         // The function that checks if a record in the grid pass the error test.
-        auto pass_error_test = [&](Record const& record) mutable -> bool
+        auto pass_error_test = [&](Record const& record) -> bool
         {
-            // The primary species at the reference chemical state
-            auto const& iprimary0 = record.state.equilibrium().indicesPrimarySpecies();
+            return record.predictor.primarySpeciesChemicalPotentialsWithinTolerance(x, options.reltol, options.abstol);
+        };
 
-            // The equilibrium predictor calculator at the reference state
-            auto const& predictor0 = record.predictor;
+        // Generate the hash number for indices of primary species in the state
+        const auto iprimary = state.equilibrium().indicesPrimarySpecies();
+        const auto label = hashVector(iprimary);
 
-            const auto w0 = record.state.equilibrium().w();
-            const auto c0 = record.state.equilibrium().c();
+        // Generate the hash number for the species with reactivity restrictions (only records learned with the same restricted species are used)
+        const auto rlabel = detail::hashRestrictions(restrictions);
 
-            dw = w - w0;
-            dc = c - c0;
+        // The bounds on the species amounts imposed by the reactivity restrictions, given the initial species amounts (unused if there are no restrictions)
+        ArrayXd nlower, nupper;
+        if(rlabel)
+            speciesAmountsBounds(restrictions, state.speciesAmounts().cast<double>(), nlower, nupper);
 
-            using std::abs;
+        // The tolerance used to compare the values of the bounds with those in the learned calculations
+        const double boundtol = std::abs(options.reltol_negative_amounts) * state.speciesAmounts().sum() + options.learning.epsilon;
 
-            for(auto ispecies : iprimary0)
+        // The function that checks if the bounds on which species amounts sat in a learned calculation have the same values now
+        auto same_active_bounds = [&](Record const& record) -> bool
+        {
+            for(auto k = 0; k < record.ibounded.size(); ++k)
             {
-                const auto mu0 = predictor0.speciesChemicalPotentialReference(ispecies);
-                const auto mu1 = predictor0.speciesChemicalPotentialPredicted(ispecies, dw, dc);
-                if(abs(mu1 - mu0) >= options.reltol * abs(mu0) + options.abstol || isnan(mu0) || isnan(mu1))
+                const auto i = record.ibounded[k];
+                const auto bound = record.nbounded[k];
+                if(std::abs(nlower[i] - bound) > boundtol && std::abs(nupper[i] - bound) > boundtol)
                     return false;
             }
-
             return true;
         };
 
-        // Generate the hash number for indices of primary species in the state
-        const auto iprimary = state.equilibrium().indicesPrimarySpecies();
-        const auto label = hashVector(iprimary);
+        // The number of learned calculations tested in this prediction
+        Index numtested = 0;
 
-        // The function that identifies the starting cluster index
-        auto index_starting_cluster = [&]() -> Index
+        // The function that predicts the chemical state using the records in a temperature-pressure grid cell at a given distance (in number of cells) from the cell of the state
+        auto predict_with_cell = [&](Pair<long, long> const& key, Cell const& cell, Index distance) -> bool
         {
-            // If no primary species, then return number of clusters to trigger use of total usage counts of clusters
-            if(iprimary.size() == 0)
-                return cell.clusters.size();
+            // The function that identifies the starting cluster index
+            auto index_starting_cluster = [&]() -> Index
+            {
+                // If no primary species, then return number of clusters to trigger use of total usage counts of clusters
+                if(iprimary.size() == 0)
+                    return cell.clusters.size();
 
-            // Find the index of the cluster with the same set of primary species (search those with highest count first)
-            for(auto icluster : cell.priority.order())
-                if(cell.clusters[icluster].label == label)
-                    return icluster;
+                // Find the index of the cluster with the same set of primary species and restricted species (search those with highest count first)
+                for(auto icluster : cell.priority.order())
+                    if(cell.clusters[icluster].label == label && cell.clusters[icluster].restrictions == rlabel)
+                        return icluster;
 
-            // In no cluster with the same set of primary species if found, then return number of clusters
-            return cell.clusters.size();
-        };
+                // In no cluster with the same set of primary species if found, then return number of clusters
+                return cell.clusters.size();
+            };
 
-        // The index of the starting cluster
-        const auto icluster = index_starting_cluster();
+            // The index of the starting cluster
+            const auto icluster = index_starting_cluster();
 
-        // The ordering of the clusters to look for (starting with icluster)
-        auto const& clusters_ordering = cell.connectivity.order(icluster);
+            //---------------------------------------------------------------------
+            // SEARCH STEP DURING THE PREDICTION PROCESS
+            //---------------------------------------------------------------------
+            tic(SEARCH_STEP)
 
-        //---------------------------------------------------------------------
-        // SEARCH STEP DURING THE PREDICTION PROCESS
-        //---------------------------------------------------------------------
-        tic(SEARCH_STEP)
+            // The function that predicts the chemical state using a record in a cluster and returns true if the prediction is accepted
+            auto predict_with_record = [&](Index jcluster, Index irecord) -> bool
+            {
+                auto const& record = cell.clusters[jcluster].records[irecord];
 
-        // Iterate over all clusters (starting with icluster)
-        for(auto jcluster : clusters_ordering)
-        {
-            // Fetch records from the cluster and the order they have to be processed in
-            auto const& records = cell.clusters[jcluster].records;
-            auto const& records_ordering = cell.clusters[jcluster].priority.order();
+                numtested += 1;
+                stats.num_records_tested += 1;
 
-            // Iterate over all records in current cluster (using the order based on the priorities)
-            for(auto irecord : records_ordering)
-            {
-                auto const& record = records[irecord];
+                // Skip the record if a species sat on a bound imposed by the reactivity restrictions whose value has since changed (the prediction would keep the species on the old bound)
+                if(rlabel && !same_active_bounds(record))
+                {
+                    stats.num_rejected_restrictions += 1;
+                    return false;
+                }
 
                 //---------------------------------------------------------------------
                 // ERROR CONTROL STEP DURING THE PREDICTION PROCESS
@@ -335,67 +584,159 @@ struct SmartEquilibriumSolver::Impl
 
                 result.timing.prediction_error_control += toc(ERROR_CONTROL_STEP);
 
-                if(success)
+                if(!success)
                 {
-                    //---------------------------------------------------------------------
-                    // TAYLOR PREDICTION STEP DURING THE PREDICTION PROCESS
-                    //---------------------------------------------------------------------
-                    tic(TAYLOR_STEP)
+                    stats.num_rejected_error_test += 1;
+                    return false;
+                }
 
-                    auto const& predictor0 = record.predictor;
+                //---------------------------------------------------------------------
+                // TAYLOR PREDICTION STEP DURING THE PREDICTION PROCESS
+                //---------------------------------------------------------------------
+                tic(TAYLOR_STEP)
 
-                    predictor0.predict(state, conditions);
+                auto const& predictor0 = record.predictor;
 
-                    result.timing.prediction_taylor = toc(TAYLOR_STEP);
+                predictor0.predict(state, conditions);
 
-                    // Check if all projected species amounts are positive or at least very small negative values
-                    auto const& n = state.speciesAmounts();
+                result.timing.prediction_taylor = toc(TAYLOR_STEP);
 
-                    const double nmin = n.minCoeff();
-                    const double nsum = n.sum();
+                // Check if all projected species amounts are positive or at least very small negative values
+                auto const& n = state.speciesAmounts();
 
-                    if(nmin <= options.reltol_negative_amounts * nsum)
-                        continue; // continue searching for a another record that produces positive amounts only or tolerable negative values
+                const double nmin = n.minCoeff();
+                const double nsum = n.sum();
 
-                    // Check if projected species amounts conserve mass of chemical elements and charge within tolerance limits
-                    const auto bnew = state.componentAmounts();
-                    const auto bold = c.head(bnew.size());
-                    const double bsum = bold.sum();
-                    const double bdiffmax = (bnew - bold).cwiseAbs().maxCoeff();
+                if(nmin <= options.reltol_negative_amounts * nsum)
+                {
+                    stats.num_rejected_negative_amounts += 1;
+                    return false; // continue searching for a another record that produces positive amounts only or tolerable negative values
+                }
 
-                    if(bdiffmax > options.reltol_component_amount_conservation * bsum)
-                        continue; // continue searching for a another record that produces mass conservation within tolerance limits
+                // Check if projected species amounts conserve mass of chemical elements and charge within tolerance limits
+                const auto bnew = state.componentAmounts();
+                const auto bold = c.head(bnew.size());
+                const double bsum = bold.sum();
+                const double bdiffmax = (bnew - bold).cwiseAbs().maxCoeff();
 
-                    result.timing.prediction_search = toc(SEARCH_STEP);
+                if(bdiffmax > options.reltol_component_amount_conservation * bsum)
+                {
+                    stats.num_rejected_mass_conservation += 1;
+                    return false; // continue searching for a another record that produces mass conservation within tolerance limits
+                }
 
-                    //---------------------------------------------------------------------
-                    // After the search is finished successfully
-                    //---------------------------------------------------------------------
+                // Check if projected species amounts respect the bounds imposed by the reactivity restrictions, with the same tolerance used for negative amounts
+                if(rlabel)
+                {
+                    const ArrayXd nd = n.cast<double>();
+                    const auto tol = options.reltol_negative_amounts * nsum;
+                    if((nd - nlower).minCoeff() <= tol || (nupper - nd).minCoeff() <= tol)
+                    {
+                        stats.num_rejected_restrictions += 1;
+                        return false; // continue searching for a another record that produces species amounts within the bounds of the reactivity restrictions
+                    }
+                }
 
-                    // Assign small positive values to all negative amounts
+                result.timing.prediction_search = toc(SEARCH_STEP);
+
+                //---------------------------------------------------------------------
+                // After the search is finished successfully
+                //---------------------------------------------------------------------
+
+                // Assign small positive values to all negative amounts
+                for(auto i = 0; i < n.size(); ++i)
+                    if(n[i] < 0.0)
+                        state.setSpeciesAmount(i, options.learning.epsilon);
+
+                // Move the species amounts slightly outside the bounds imposed by the reactivity restrictions onto these bounds
+                if(rlabel)
                     for(auto i = 0; i < n.size(); ++i)
-                        if(n[i] < 0.0)
-                            state.setSpeciesAmount(i, options.learning.epsilon);
+                        if(n[i] < nlower[i] || n[i] > nupper[i])
+                            state.setSpeciesAmount(i, std::clamp(double(n[i]), nlower[i], nupper[i]));
+
+                // Return the sensitivity derivatives of the predicted state, which are those stored in the record used for the prediction
+                if(outsensitivity)
+                    predictedSensitivity(record.predictor, *outsensitivity);
+
+                //---------------------------------------------------------------------
+                // DATABASE PRIORITY UPDATE STEP DURING THE PREDICTION PROCESS
+                //---------------------------------------------------------------------
+                tic(PRIORITY_UPDATE_STEP)
+
+                // The search radius of the cell of the state after this prediction, which is widened if the record is in one of the farthest searched cells (merging it with them)
+                const auto neighborhood = (distance == radius && radius < options.neighbor_cells_max_radius) ? distance + 1 : distance;
+
+                // Register the increments of the priorities of the current record (irecord) and cluster (jcluster) with respect to starting cluster (icluster)
+                priorityupdates.push_back({ key, icluster, jcluster, irecord, grid.epoch, home, neighborhood });
+
+                // Mark the predicted state as accepted
+                result.prediction.accepted = true;
+
+                stats.num_records_tested_before_acceptance += numtested;
+
+                // Report the largest estimated error in the chemical potentials of the primary species
+                const auto errors = record.predictor.primarySpeciesChemicalPotentialsErrorEstimate(x);
+                result.prediction.estimated_error = errors.size() ? errors.maxCoeff() : 0.0;
+
+                result.timing.prediction_priority_update = toc(PRIORITY_UPDATE_STEP);
+
+                return true;
+            };
+
+            if(options.search == SmartEquilibriumSearch::NearestNeighbors)
+            {
+                // Iterate over the records nearest to the new calculation in the space of normalized inputs (w, c)
+                const auto xnorm = normalizedInputs(cell, w.matrix(), c.matrix());
 
-                    //---------------------------------------------------------------------
-                    // DATABASE PRIORITY UPDATE STEP DURING THE PREDICTION PROCESS
-                    //---------------------------------------------------------------------
-                    tic(PRIORITY_UPDATE_STEP)
+                for(auto ientry : cell.tree.nearest(xnorm, options.search_num_nearest))
+                {
+                    const auto [jcluster, irecord] = cell.treeentries[ientry];
+                    if(cell.clusters[jcluster].restrictions != rlabel) // skip records learned with different restricted species
+                        continue;
+                    if(predict_with_record(jcluster, irecord))
+                        return true;
+                }
+            }
+            else
+            {
+                // The ordering of the clusters to look for (starting with icluster)
+                const auto clusters_ordering = cell.connectivity.order(icluster);
 
-                    // Increment priority of the current record (irecord) in the current cluster (jcluster)
-                    cell.clusters[jcluster].priority.increment(irecord);
+                // Iterate over all clusters (starting with icluster)
+                for(auto jcluster : clusters_ordering)
+                {
+                    // Skip clusters with records learned with different restricted species
+                    if(cell.clusters[jcluster].restrictions != rlabel)
+                        continue;
+
+                    // Iterate over all records in current cluster (using the order based on the priorities)
+                    for(auto irecord : cell.clusters[jcluster].priority.order())
+                        if(predict_with_record(jcluster, irecord))
+                            return true;
+                }
+            }
 
-                    // Increment priority of the current cluster (jcluster) with respect to starting cluster (icluster)
-                    cell.connectivity.increment(icluster, jcluster);
+            return false;
+        };
 
-                    // Increment priority of the current cluster (jcluster)
-                    cell.priority.increment(jcluster);
+        // Search first the records in the cell of the state
+        if(it != grid.cells.end() && predict_with_cell(home, it->second, 0))
+            return;
 
-                    // Mark the predicted state as accepted
-                    result.prediction.accepted = true;
+        // Search then the records in the neighbor cells, from the nearest to the farthest ones
+        if(radius > 0)
+        {
+            for(auto const& [key, distance] : detail::neighborCells(T, P, options.temperature_step, options.pressure_step, radius))
+            {
+                const auto jt = grid.cells.find(key);
+                if(jt == grid.cells.end())
+                    continue;
 
-                    result.timing.prediction_priority_update = toc(PRIORITY_UPDATE_STEP);
+                missedneighbors = true;
 
+                if(predict_with_cell(key, jt->second, distance))
+                {
+                    missedneighbors = false;
                     return;
                 }
             }
@@ -404,6 +745,109 @@ struct SmartEquilibriumSolver::Impl
         result.prediction.accepted = false;
     }
 
+    /// Assemble the bounds on the species amounts imposed by given reactivity restrictions on a chemical state with given initial species amounts.
+    static auto speciesAmountsBounds(EquilibriumRestrictions const& restrictions, ArrayXdConstRef n0, ArrayXd& nlower, ArrayXd& nupper) -> void
+    {
+        nlower.setConstant(n0.size(), -inf);
+        nupper.setConstant(n0.size(), inf);
+        for(auto const& [i, val] : restrictions.speciesCannotDecreaseBelow()) nlower[i] = val;
+        for(auto i : restrictions.speciesCannotDecrease()) nlower[i] = n0[i]; // this comes after, in case a species cannot strictly decrease
+        for(auto const& [i, val] : restrictions.speciesCannotIncreaseAbove()) nupper[i] = val;
+        for(auto i : restrictions.speciesCannotIncrease()) nupper[i] = n0[i]; // this comes after, in case a species cannot strictly increase
+    }
+
+    /// Determine the species whose amounts sit on the bounds imposed by reactivity restrictions, and the values of these bounds.
+    auto speciesAmountsOnBounds(ArrayXdConstRef n, ArrayXdConstRef nlower, ArrayXdConstRef nupper, ArrayXl& ibounded, ArrayXd& nbounded) const -> void
+    {
+        const auto tol = std::abs(options.reltol_negative_amounts) * n.sum() + options.learning.epsilon;
+        Vec<Eigen::Index> indices;
+        Vec<double> bounds;
+        for(auto i = 0; i < n.size(); ++i)
+        {
+            if(n[i] - nlower[i] <= tol) { indices.push_back(i); bounds.push_back(nlower[i]); }
+            else if(nupper[i] - n[i] <= tol) { indices.push_back(i); bounds.push_back(nupper[i]); }
+        }
+        ibounded = Eigen::Map<ArrayXl const>(indices.data(), indices.size());
+        nbounded = Eigen::Map<ArrayXd const>(bounds.data(), bounds.size());
+    }
+
+    /// Set the sensitivity derivatives of a predicted chemical state to those stored in the predictor used for the prediction.
+    auto predictedSensitivity(EquilibriumPredictor const& predictor, EquilibriumSensitivity& sens) const -> void
+    {
+        copySensitivity(predictor.derivatives(), predictor.propertyIndices(), sens);
+    }
+
+    /// Set the sensitivity derivatives of a learned chemical state to those computed in the learning operation.
+    auto learnedSensitivity(EquilibriumSensitivity& sens) const -> void
+    {
+        auto const& iu = sensitivity.propertyIndices();
+
+        MatrixXd dydx(sensitivity.dndw().rows() + sensitivity.dpdw().rows() + sensitivity.dqdw().rows() + iu.size(), sensitivity.dndw().cols() + sensitivity.dndc().cols());
+        dydx << sensitivity.dndw(), sensitivity.dndc(),
+                sensitivity.dpdw(), sensitivity.dpdc(),
+                sensitivity.dqdw(), sensitivity.dqdc(),
+                sensitivity.dudw(), sensitivity.dudc();
+
+        copySensitivity(dydx, iu, sens);
+    }
+
+    /// Copy given derivatives of *y = (n, p, q, u[iu])* with respect to *x = (w, c)* into a sensitivity object, keeping its selection of chemical properties.
+    /// The rows of the selected chemical properties whose derivatives are not
+    /// among the given ones (see SmartEquilibriumOptions::predict_chemical_properties) are NaN.
+    auto copySensitivity(MatrixXdConstRef dydx, Indices const& iu, EquilibriumSensitivity& sens) const -> void
+    {
+        const auto Nn = sens.dndw().rows();
+        const auto Np = sens.dpdw().rows();
+        const auto Nq = sens.dqdw().rows();
+        const auto Nw = sens.dndw().cols();
+        const auto Nc = sens.dndc().cols();
+
+        sens.dndw(dydx.topRows(Nn).leftCols(Nw));
+        sens.dndc(dydx.topRows(Nn).rightCols(Nc));
+        sens.dpdw(dydx.middleRows(Nn, Np).leftCols(Nw));
+        sens.dpdc(dydx.middleRows(Nn, Np).rightCols(Nc));
+        sens.dqdw(dydx.middleRows(Nn + Np, Nq).leftCols(Nw));
+        sens.dqdc(dydx.middleRows(Nn + Np, Nq).rightCols(Nc));
+
+        // The row in the given derivatives of each entry in u (or Nu if not given)
+        Indices rows(Nu, Nu);
+        for(Index k = 0; k < iu.size(); ++k)
+            rows[iu[k]] = Nn + Np + Nq + k;
+
+        // The total derivatives of the chemical properties selected in the sensitivity object
+        sens.updatePropertyIndices(Nu);
+        auto const& ju = sens.propertyIndices();
+
+        MatrixXd dudx = MatrixXd::Constant(ju.size(), Nw + Nc, NaN);
+        for(Index k = 0; k < ju.size(); ++k)
+            if(rows[ju[k]] != Nu)
+                dudx.row(k) = dydx.row(rows[ju[k]]);
+
+        sens.dudw(dudx.leftCols(Nw));
+        sens.dudc(dudx.rightCols(Nc));
+    }
+
+    /// Return the scaling factors used to normalize the inputs *(w, c)* of the calculations in a temperature-pressure grid cell.
+    /// These are determined with the inputs of the first calculation stored in
+    /// the cell. The input variables in *w* are divided by their absolute
+    /// values (or one if smaller) and the amounts of components in *c* by
+    /// their total absolute amount.
+    static auto inputScaling(VectorXdConstRef w, VectorXdConstRef c) -> VectorXd
+    {
+        VectorXd scaling(w.size() + c.size());
+        scaling.head(w.size()) = w.cwiseAbs().cwiseMax(1.0).cwiseInverse();
+        scaling.tail(c.size()).fill(1.0 / std::max(c.cwiseAbs().sum(), 1.0e-16));
+        return scaling;
+    }
+
+    /// Return the inputs *(w, c)* of a calculation normalized with the scaling factors of a temperature-pressure grid cell.
+    static auto normalizedInputs(Cell const& cell, VectorXdConstRef w, VectorXdConstRef c) -> VectorXd
+    {
+        VectorXd x(w.size() + c.size());
+        x << w, c;
+        return x.cwiseProduct(cell.scaling);
+    }
+
     //=================================================================================================================
     //
     // MISCELLANEOUS METHODS
@@ -415,6 +859,26 @@ struct SmartEquilibriumSolver::Impl
     {
         options = opts;
         solver.setOptions(opts.learning);
+
+        // The acceptance test needs only the sensitivity derivatives of the chemical potentials of the species
+        if(opts.predict_chemical_properties)
+            sensitivity.selectAllProperties();
+        else sensitivity.selectSpeciesChemicalPotentials();
+    }
+
+    /// Return the statistics of the smart equilibrium calculations of this solver, with the current sizes of its knowledge base.
+    auto statistics() const -> SmartEquilibriumStatistics
+    {
+        auto res = stats;
+        knowledge->read([&](Grid const& grid)
+        {
+            res.num_cells = grid.cells.size();
+            res.num_records = grid.numrecords;
+            res.memory_usage = grid.numbytes;
+            for(auto const& [key, cell] : grid.cells)
+                res.num_clusters += cell.clusters.size();
+        });
+        return res;
     }
 };
 
@@ -428,7 +892,10 @@ SmartEquilibriumSolver::SmartEquilibriumSolver(EquilibriumSpecs const& specs)
 
 SmartEquilibriumSolver::SmartEquilibriumSolver(SmartEquilibriumSolver const& other)
 : pimpl(new Impl(*other.pimpl))
-{}
+{
+    // The copied solver starts with a copy of the learned calculations, not sharing them with the original solver
+    pimpl->knowledge = std::make_shared<SmartEquilibriumKnowledgeBase>(*other.pimpl->knowledge);
+}
 
 SmartEquilibriumSolver::~SmartEquilibriumSolver()
 {}
@@ -446,8 +913,7 @@ auto SmartEquilibriumSolver::solve(ChemicalState& state) -> SmartEquilibriumResu
 
 auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
 {
-    errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumRestrictions is currently not supported.");
-    return {};
+    return pimpl->solve(state, restrictions);
 }
 
 auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumConditions const& conditions) -> SmartEquilibriumResult
@@ -457,32 +923,27 @@ auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumConditions c
 
 auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
 {
-    errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumRestrictions is currently not supported.");
-    return {};
+    return pimpl->solve(state, conditions, restrictions);
 }
 
 auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumSensitivity& sensitivity) -> SmartEquilibriumResult
 {
-    errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-    return {};
+    return pimpl->solve(state, sensitivity);
 }
 
 auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
 {
-    errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-    return {};
+    return pimpl->solve(state, sensitivity, restrictions);
 }
 
 auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumConditions const& conditions) -> SmartEquilibriumResult
 {
-    errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-    return {};
+    return pimpl->solve(state, sensitivity, conditions);
 }
 
 auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
 {
-    errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-    return {};
+    return pimpl->solve(state, sensitivity, conditions, restrictions);
 }
 
 auto SmartEquilibriumSolver::setOptions(SmartEquilibriumOptions const& options) -> void
@@ -490,4 +951,26 @@ auto SmartEquilibriumSolver::setOptions(SmartEquilibriumOptions const& options)
     pimpl->setOptions(options);
 }
 
+auto SmartEquilibriumSolver::setKnowledgeBase(SharedPtr<SmartEquilibriumKnowledgeBase> const& knowledge) -> void
+{
+    errorif(!knowledge, "Expecting a non-null SmartEquilibriumKnowledgeBase object in SmartEquilibriumSolver::setKnowledgeBase.");
+    pimpl->knowledge = knowledge;
+    pimpl->priorityupdates.clear();
+}
+
+auto SmartEquilibriumSolver::knowledgeBase() const -> SharedPtr<SmartEquilibriumKnowledgeBase> const&
+{
+    return pimpl->knowledge;
+}
+
+auto SmartEquilibriumSolver::statistics() const -> SmartEquilibriumStatistics
+{
+    return pimpl->statistics();
+}
+
+auto SmartEquilibriumSolver::resetStatistics() -> void
+{
+    pimpl->stats = {};
+}
+
 } // namespace Reaktoro
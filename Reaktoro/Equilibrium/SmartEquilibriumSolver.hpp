@@ -26,6 +26,7 @@
 #include <Reaktoro/Equilibrium/EquilibriumPredictor.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
 #include <Reaktoro/ODML/ClusterConnectivity.hpp>
+#include <Reaktoro/ODML/KdTree.hpp>
 #include <Reaktoro/ODML/PriorityQueue.hpp>
 
 namespace Reaktoro {
@@ -36,8 +37,10 @@ class ChemicalState;
 class ChemicalSystem;
 class EquilibriumRestrictions;
 class EquilibriumSpecs;
+class SmartEquilibriumKnowledgeBase;
 struct SmartEquilibriumOptions;
 struct SmartEquilibriumResult;
+struct SmartEquilibriumStatistics;
 
 /// Used for calculating chemical equilibrium states using an on-demand machine learning (ODML) strategy.
 class SmartEquilibriumSolver
@@ -50,6 +53,7 @@ public:
     explicit SmartEquilibriumSolver(EquilibriumSpecs const& specs);
 
     /// Construct a copy of an SmartEquilibriumSolver object.
+    /// The copy has its own copy of the learned calculations of the other solver (see @ref setKnowledgeBase to share them instead).
     SmartEquilibriumSolver(SmartEquilibriumSolver const& other);
 
     /// Destroy this SmartEquilibriumSolver object.
@@ -69,6 +73,9 @@ public:
     auto solve(ChemicalState& state) -> SmartEquilibriumResult;
 
     /// Equilibrate a chemical state respecting given reactivity restrictions.
+    /// Predictions are made only with learned calculations that had
+    /// restrictions on the same species, and only if the predicted species
+    /// amounts respect the bounds of these restrictions.
     /// @param[in,out] state The initial guess for the calculation (in) and the computed equilibrium state (out)
     /// @param restrictions The reactivity restrictions on the amounts of selected species
     auto solve(ChemicalState& state, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult;
@@ -91,6 +98,11 @@ public:
     //=================================================================================================================
 
     /// Equilibrate a chemical state and compute sensitivity derivatives.
+    /// When the equilibrium state is predicted, the sensitivity derivatives
+    /// are those of the learned calculation used in the prediction. The
+    /// selection of chemical properties in the sensitivity object is kept,
+    /// and the total derivatives of those not stored in learned calculations
+    /// are NaN (see SmartEquilibriumOptions::predict_chemical_properties).
     /// @param[in,out] state The initial guess for the calculation (in) and the computed equilibrium state (out)
     /// @param[out] sensitivity The sensitivity derivatives of the equilibrium state with respect to given input conditions
     auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity) -> SmartEquilibriumResult;
@@ -123,20 +135,48 @@ public:
     /// Set the options of the equilibrium solver.
     auto setOptions(SmartEquilibriumOptions const& options) -> void;
 
+    /// Set the knowledge base in which the learned calculations of this solver are stored and searched.
+    /// Use this method to share the same knowledge base among several
+    /// solvers, for example, one per thread, so that the calculations learned
+    /// by any of them can be used by all the others. The solvers must have been
+    /// constructed with the same chemical equilibrium specifications.
+    auto setKnowledgeBase(SharedPtr<SmartEquilibriumKnowledgeBase> const& knowledge) -> void;
+
+    /// Return the knowledge base in which the learned calculations of this solver are stored and searched.
+    auto knowledgeBase() const -> SharedPtr<SmartEquilibriumKnowledgeBase> const&;
+
+    /// Return the statistics of the smart equilibrium calculations of this solver and the current sizes of its knowledge base.
+    /// The counters of the statistics are updated with a few integer
+    /// increments per calculation, so they are always collected. The sizes of
+    /// the knowledge base are computed when this method is called.
+    auto statistics() const -> SmartEquilibriumStatistics;
+
+    /// Reset the counters of the statistics of the smart equilibrium calculations of this solver (e.g., at the beginning of a time step).
+    auto resetStatistics() -> void;
+
     /// The record of the knowledge database containing input, output, and derivatives data.
+    /// The reference chemical equilibrium state and its sensitivity
+    /// derivatives are stored only once, in compact form, in the predictor
+    /// (see EquilibriumPredictor::referenceState and EquilibriumPredictor::derivatives).
     struct Record
     {
-        /// The fully calculated chemical equilibrium state.
-        ChemicalState state;
+        /// The predictor of chemical equilibrium states at given new conditions.
+        EquilibriumPredictor predictor;
 
-        /// The conditions at which the chemical equilibrium state was calculated.
-        EquilibriumConditions conditions;
+        /// The value of Grid::time when this record was last stored or used in an accepted prediction.
+        Index lastused = 0;
 
-        /// The sensitivity derivatives at the calculated chemical equilibrium state.
-        EquilibriumSensitivity sensitivity;
+        /// The indices of the species whose amounts sat on bounds imposed by reactivity restrictions in the learned calculation.
+        ArrayXl ibounded;
 
-        /// The predictor of chemical equilibrium states at given new conditions.
-        EquilibriumPredictor predictor;
+        /// The values of these bounds, which are not inputs of the predictor and thus must be the same in the predictions using this record.
+        ArrayXd nbounded;
+
+        /// Return the number of bytes used by this record (see EquilibriumPredictor::memoryUsage).
+        auto memoryUsage() const -> Index
+        {
+            return sizeof(Record) + predictor.memoryUsage() + ibounded.size() * sizeof(ArrayXl::Scalar) + nbounded.size() * sizeof(double);
+        }
     };
 
     /// The cluster storing learned input-output data with same classification.
@@ -148,6 +188,9 @@ public:
         /// The hash of the indices of the primary species for this cluster.
         Index label = 0;
 
+        /// The hash of the indices of the species with reactivity restrictions in the calculations of this cluster (zero if none).
+        Index restrictions = 0;
+
         /// The records stored in this cluster with learning data.
         Deque<Record> records;
 
@@ -166,6 +209,26 @@ public:
 
         /// The priority queue for the clusters based on their usage counts.
         PriorityQueue priority;
+
+        /// The k-d tree of the normalized inputs *(w, c)* of the records in all clusters, used for nearest neighbor searches.
+        KdTree tree;
+
+        /// The indices of the cluster and of the record within the cluster of each point in the k-d tree.
+        Deque<Pair<Index, Index>> treeentries;
+
+        /// The scaling factors used to normalize the inputs *(w, c)* of the records in the k-d tree.
+        VectorXd scaling;
+
+        /// The number of neighbor cells, in each direction of temperature and pressure, searched when no record in this cell is acceptable.
+        /// This radius grows when predictions are accepted with records in
+        /// the farthest searched cells (merging this cell with its neighbors
+        /// in flat regions) and shrinks when new calculations are learned in
+        /// this cell after searching its neighbors without success (splitting
+        /// it from them where the equilibrium states change rapidly).
+        Index radius = 0;
+
+        /// The number of consecutive calculations learned in this cell after searching its neighbor cells without success.
+        Index misses = 0;
     };
 
     /// The temperature-pressure grid cells containing learned input-output data.
@@ -176,6 +239,21 @@ public:
         /// pressures are rounded to nearest checkpoints based on provided temperature/pressure step
         /// lengths for discretization.
         Map<Pair<long, long>, Cell> cells;
+
+        /// The counter of storage and usage events of the records, used to determine which ones were used least recently.
+        Index time = 0;
+
+        /// The number of times records were evicted or replaced by loaded ones, used to discard updates of usage counts that refer to records no longer stored.
+        Index epoch = 0;
+
+        /// The number of records in all cells, kept up to date whenever records are stored or evicted.
+        Index numrecords = 0;
+
+        /// The number of bytes used by the records in all cells (see Record::memoryUsage), kept up to date whenever records are stored or evicted.
+        Index numbytes = 0;
+
+        /// The names of the input and control variables shared by the predictors of all records, so that these are stored once (see EquilibriumPredictor::shareNames).
+        SharedPtr<EquilibriumPredictor::Names const> names;
     };
 
 private:
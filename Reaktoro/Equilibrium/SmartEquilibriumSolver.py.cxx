@@ -26,13 +26,24 @@
 #include <Reaktoro/Equilibrium/EquilibriumRestrictions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
+#include <Reaktoro/Equilibrium/SmartEquilibriumKnowledgeBase.hpp>
 #include <Reaktoro/Equilibrium/SmartEquilibriumOptions.hpp>
 #include <Reaktoro/Equilibrium/SmartEquilibriumResult.hpp>
 #include <Reaktoro/Equilibrium/SmartEquilibriumSolver.hpp>
+#include <Reaktoro/Equilibrium/SmartEquilibriumStatistics.hpp>
 using namespace Reaktoro;
 
 void exportSmartEquilibriumSolver(py::module& m)
 {
+    py::class_<SmartEquilibriumKnowledgeBase, SharedPtr<SmartEquilibriumKnowledgeBase>>(m, "SmartEquilibriumKnowledgeBase")
+        .def(py::init<>())
+        .def("size", &SmartEquilibriumKnowledgeBase::size, "Return the number of learned calculations in the knowledge base.")
+        .def("memoryUsage", &SmartEquilibriumKnowledgeBase::memoryUsage, "Return the number of bytes used to store the learned calculations, excluding the search data structures.")
+        .def("evict", py::overload_cast<Index, Index, double>(&SmartEquilibriumKnowledgeBase::evict), "Evict the least used learned calculations if the number of learned calculations or the memory they use exceeds a given budget.")
+        .def("save", &SmartEquilibriumKnowledgeBase::save, "Save the learned calculations in a binary file.")
+        .def("load", &SmartEquilibriumKnowledgeBase::load, "Load the learned calculations from a binary file created with save, replacing the current ones.")
+        ;
+
     py::class_<SmartEquilibriumSolver>(m, "SmartEquilibriumSolver")
         .def(py::init<ChemicalSystem const&>())
         .def(py::init<EquilibriumSpecs const&>())
@@ -48,5 +59,9 @@ void exportSmartEquilibriumSolver(py::module& m)
         .def("solve", py::overload_cast<ChemicalState&, EquilibriumSensitivity&, EquilibriumConditions const&, EquilibriumRestrictions const&>(&SmartEquilibriumSolver::solve), "Equilibrate a chemical state respecting given constraint conditions and reactivity restrictions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("conditions"), py::arg("restrictions"))
 
         .def("setOptions", &SmartEquilibriumSolver::setOptions)
+        .def("setKnowledgeBase", &SmartEquilibriumSolver::setKnowledgeBase, "Set the knowledge base in which the learned calculations of this solver are stored and searched.")
+        .def("knowledgeBase", &SmartEquilibriumSolver::knowledgeBase, "Return the knowledge base in which the learned calculations of this solver are stored and searched.")
+        .def("statistics", &SmartEquilibriumSolver::statistics, "Return the statistics of the smart equilibrium calculations of this solver and the current sizes of its knowledge base.")
+        .def("resetStatistics", &SmartEquilibriumSolver::resetStatistics, "Reset the counters of the statistics of the smart equilibrium calculations of this solver.")
         ;
 }
@@ -16,7 +16,10 @@
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
 // C++ includes
+#include <cstdio>
+#include <fstream>
 #include <iostream>
+#include <thread>
 
 // Catch includes
 #include <catch2/catch.hpp>
@@ -26,11 +29,14 @@
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumRestrictions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
+#include <Reaktoro/Equilibrium/SmartEquilibriumKnowledgeBase.hpp>
 #include <Reaktoro/Equilibrium/SmartEquilibriumOptions.hpp>
 #include <Reaktoro/Equilibrium/SmartEquilibriumResult.hpp>
 #include <Reaktoro/Equilibrium/SmartEquilibriumSolver.hpp>
+#include <Reaktoro/Equilibrium/SmartEquilibriumStatistics.hpp>
 #include <Reaktoro/Extensions/Supcrt/SupcrtDatabase.hpp>
 #include <Reaktoro/Math/MathUtils.hpp>
 #include <Reaktoro/Models/ActivityModels/ActivityModelDavies.hpp>
@@ -115,4 +121,612 @@ TEST_CASE("Testing SmartEquilibriumSolver", "[SmartEquilibriumSolver]")
         CHECK( result.learned() );
         CHECK( result.iterations() == 17 );
     }
+
+    SupcrtDatabase db("supcrtbl");
+
+    AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+    solution.setActivityModel(ActivityModelPitzer());
+
+    MineralPhase calcite("Calcite");
+
+    ChemicalSystem system(db, solution, calcite);
+
+    // Create a chemical state at given temperature (in °C) and pressure (in bar) with given amounts of water (in kg) and calcite (in mol)
+    auto createState = [&](double T, double P, double amount)
+    {
+        ChemicalState state(system);
+        state.temperature(T, "celsius");
+        state.pressure(P, "bar");
+        state.set("H2O(aq)", amount, "kg");
+        state.set("Calcite", amount, "mol");
+        return state;
+    };
+
+    // Equilibrate with a smart solver a chemical state at given temperature (in °C) and 1 bar with given amounts of water (in kg) and calcite (in mol)
+    auto solveAt = [&](SmartEquilibriumSolver& solver, double T, double amount, auto&&... args)
+    {
+        ChemicalState state = createState(T, 1.0, amount);
+        return solver.solve(state, args...);
+    };
+
+    WHEN("temperature and pressure are given and learned calculations are searched by nearest neighbors - calcite and water")
+    {
+        ChemicalState state(system);
+        ChemicalState exactstate(system);
+
+        SmartEquilibriumOptions options;
+        options.search = SmartEquilibriumSearch::NearestNeighbors;
+
+        SmartEquilibriumSolver solver(system);
+        solver.setOptions(options);
+
+        EquilibriumSolver exactsolver(system);
+
+        SmartEquilibriumResult result;
+
+        // Learn calculations at the same temperature-pressure grid cell, the second one far from the state predicted below
+        for(auto amount : { 1.0, 5.0 })
+        {
+            state = createState(25.0, 1.0, amount);
+
+            result = solver.solve(state);
+
+            CHECK( result.succeeded() );
+        }
+
+        // The nearest learned calculation is the one with amount 1.0, whose inputs are closest to those of this state
+        state = createState(30.0, 2.0, 1.1);
+
+        exactstate = state;
+        exactsolver.solve(exactstate);
+
+        result = solver.solve(state);
+
+        CHECK( result.succeeded() );
+        CHECK( result.predicted() );
+        CHECK( result.iterations() == 0 );
+
+        CHECK( largestRelativeDifference(state.speciesAmounts(), exactstate.speciesAmounts()) == Approx(0.0577497634) );
+    }
+
+    WHEN("temperature and pressure are given and learned calculations are searched by priority and by nearest neighbors - calcite and water")
+    {
+        // Learn two calculations in the same temperature-pressure grid cell, with zero tolerances so that the second one is not predicted from the first
+        SmartEquilibriumOptions options;
+        options.reltol = 0.0;
+        options.abstol = 0.0;
+
+        SmartEquilibriumSolver prioritysolver(system);
+        prioritysolver.setOptions(options);
+
+        ChemicalState state = createState(25.0, 1.0, 1.0);
+        CHECK( prioritysolver.solve(state).learned() );
+
+        state = createState(28.0, 1.0, 1.0);
+        CHECK( prioritysolver.solve(state).learned() );
+
+        // A copy of the solver starts with a copy of the same learned calculations
+        SmartEquilibriumSolver nearestsolver(prioritysolver);
+
+        options = {};
+        prioritysolver.setOptions(options);
+
+        options.search = SmartEquilibriumSearch::NearestNeighbors;
+        nearestsolver.setOptions(options);
+
+        // Predict at the inputs of the second learned calculation, which the priority search tests after the first one (both were never used), and the nearest neighbors search tests first
+        ChemicalState prioritystate = createState(28.0, 1.0, 1.0);
+        ChemicalState neareststate = createState(28.0, 1.0, 1.0);
+        ChemicalState exactstate = createState(28.0, 1.0, 1.0);
+
+        EquilibriumSolver exactsolver(system);
+        exactsolver.solve(exactstate);
+
+        CHECK( prioritysolver.solve(prioritystate).predicted() );
+        CHECK( nearestsolver.solve(neareststate).predicted() );
+
+        // The usage counts show that each search used a different learned calculation
+        auto usageCounts = [](SmartEquilibriumSolver const& solver)
+        {
+            Deque<Index> counts;
+            solver.knowledgeBase()->read([&](SmartEquilibriumSolver::Grid const& grid)
+            {
+                REQUIRE( grid.cells.size() == 1 );
+                auto const& clusters = grid.cells.begin()->second.clusters;
+                REQUIRE( clusters.size() == 1 );
+                counts = clusters[0].priority.priorities();
+            });
+            return counts;
+        };
+
+        CHECK( usageCounts(prioritysolver) == Deque<Index>{ 1, 0 } );
+        CHECK( usageCounts(nearestsolver) == Deque<Index>{ 0, 1 } );
+
+        // The learned calculation with the same inputs gives a more accurate prediction
+        CHECK( largestRelativeDifference(neareststate.speciesAmounts(), exactstate.speciesAmounts()) < largestRelativeDifference(prioritystate.speciesAmounts(), exactstate.speciesAmounts()) );
+    }
+
+    WHEN("temperature and pressure are given and learned calculations are shared among solvers - calcite and water")
+    {
+        SmartEquilibriumSolver solver1(system);
+        SmartEquilibriumSolver solver2(system);
+
+        solver2.setKnowledgeBase(solver1.knowledgeBase());
+
+        CHECK( solver1.knowledgeBase() == solver2.knowledgeBase() );
+        CHECK( solver1.knowledgeBase()->size() == 0 );
+
+        ChemicalState state = createState(25.0, 1.0, 1.0);
+
+        SmartEquilibriumResult result = solver1.solve(state);
+
+        CHECK( result.succeeded() );
+        CHECK( result.learned() );
+        CHECK( solver2.knowledgeBase()->size() == 1 );
+
+        // The calculation learned by the first solver is used by the second one
+        state = createState(30.0, 2.0, 1.1);
+
+        result = solver2.solve(state);
+
+        CHECK( result.succeeded() );
+        CHECK( result.predicted() );
+
+        // A copied solver does not share the learned calculations with the original one
+        SmartEquilibriumSolver solver3 = solver1;
+
+        CHECK( solver3.knowledgeBase() != solver1.knowledgeBase() );
+        CHECK( solver3.knowledgeBase()->size() == 1 );
+
+        // Solvers in different threads sharing the same knowledge base (each with a cloned chemical system so that memoized models are not shared among threads)
+        const auto numthreads = 4;
+
+        Vec<SmartEquilibriumResult> results(numthreads);
+
+        auto knowledge = std::make_shared<SmartEquilibriumKnowledgeBase>();
+
+        Vec<std::thread> threads;
+        for(auto i = 0; i < numthreads; ++i)
+            threads.emplace_back([&, i]()
+            {
+                const auto clonedsystem = system.clone();
+
+                SmartEquilibriumSolver solver(clonedsystem);
+                solver.setKnowledgeBase(knowledge);
+
+                for(auto amount : { 1.0, 1.05, 1.1 })
+                {
+                    ChemicalState clonedstate(clonedsystem);
+                    clonedstate.temperature(25.0 + i, "celsius");
+                    clonedstate.pressure(1.0, "bar");
+                    clonedstate.set("H2O(aq)", amount, "kg");
+                    clonedstate.set("Calcite", amount, "mol");
+
+                    results[i] = solver.solve(clonedstate);
+                }
+            });
+
+        for(auto& thread : threads)
+            thread.join();
+
+        for(auto const& res : results)
+            CHECK( res.succeeded() );
+
+        CHECK( knowledge->size() >= 1 );
+        CHECK( knowledge->size() <= 3 * numthreads );
+    }
+
+    WHEN("temperature and pressure are given and the number of learned calculations is bounded - calcite and water")
+    {
+        SmartEquilibriumOptions options;
+        options.max_num_records = 3;
+        options.eviction_fraction = 0.5;
+
+        SmartEquilibriumSolver solver(system);
+        solver.setOptions(options);
+
+        ChemicalState state(system);
+
+        Index numevicted = 0;
+
+        // Each temperature is in a different temperature-pressure grid cell, so that every calculation is learned
+        for(auto T : { 25.0, 45.0, 65.0, 85.0, 105.0 })
+        {
+            state = createState(T, 1.0, 1.0);
+
+            SmartEquilibriumResult result = solver.solve(state);
+
+            CHECK( result.succeeded() );
+            CHECK( result.learned() );
+            CHECK( result.learning.num_records <= 3 );
+            CHECK( result.learning.num_records == solver.knowledgeBase()->size() );
+
+            numevicted += result.learning.num_evicted;
+        }
+
+        CHECK( numevicted == 3 ); // after the 4th learned calculation, all but the newest one are evicted (half the budget of 3 records is 1 record)
+        CHECK( solver.knowledgeBase()->size() == 2 );
+
+        // The most recently learned calculation was not evicted and can still be used for predictions
+        state = createState(106.0, 1.0, 1.05);
+
+        SmartEquilibriumResult result = solver.solve(state);
+
+        CHECK( result.succeeded() );
+        CHECK( result.predicted() );
+    }
+
+    WHEN("temperature and pressure are given and second-order predictions are used - calcite and water")
+    {
+        SmartEquilibriumOptions options;
+        options.second_order_predictions = true;
+        options.temperature_step = 1000.0; // all calculations are in the same temperature-pressure grid cell
+        options.reltol = 0.0; // all predictions fail, so that every calculation is learned
+        options.abstol = 0.0;
+
+        SmartEquilibriumSolver solver(system);
+        solver.setOptions(options);
+
+        CHECK( solveAt(solver, 25.0, 1.0).learned() );
+        CHECK( solveAt(solver, 60.0, 1.0).learned() );
+
+        // The second learned calculation has second-order derivatives estimated with the first one
+        solver.knowledgeBase()->read([&](SmartEquilibriumSolver::Grid const& grid)
+        {
+            REQUIRE( grid.cells.size() == 1 );
+            auto const& records = grid.cells.begin()->second.clusters.front().records;
+            REQUIRE( records.size() == 2 );
+            CHECK( records[0].predictor.curvatureDirection().size() == 0 );
+            CHECK( records[1].predictor.curvatureDirection().size() > 0 );
+
+            // The names of the input and control variables are stored once for all learned calculations
+            CHECK( records[0].predictor.names() == grid.names );
+            CHECK( records[1].predictor.names() == grid.names );
+        });
+
+        // A prediction with tolerances between both learned calculations is accepted and reports its estimated error (which is zero only at a learned calculation)
+        options.reltol = 0.005;
+        options.abstol = 0.01;
+        solver.setOptions(options);
+
+        SmartEquilibriumResult result = solveAt(solver, 55.0, 1.0);
+
+        CHECK( result.succeeded() );
+        CHECK( result.predicted() );
+        CHECK( result.prediction.estimated_error > 0.0 );
+    }
+
+    WHEN("temperature and pressure are given and neighbor temperature-pressure grid cells are searched - calcite and water")
+    {
+        // The state at 32.5 °C is in the grid cell centered at 310 K and the one at 31.0 °C in the grid cell centered at 300 K
+        SmartEquilibriumOptions options;
+
+        SmartEquilibriumSolver solverA(system);
+        solverA.setOptions(options);
+
+        CHECK( solveAt(solverA, 32.5, 1.0).learned() );
+        CHECK( solveAt(solverA, 31.0, 1.0).learned() ); // by default, predictions do not use learned calculations in other grid cells
+
+        options.neighbor_cells_radius = 1;
+
+        SmartEquilibriumSolver solverB(system);
+        solverB.setOptions(options);
+
+        CHECK( solveAt(solverB, 32.5, 1.0).learned() );
+
+        SmartEquilibriumResult result = solveAt(solverB, 31.0, 1.0);
+
+        CHECK( result.succeeded() );
+        CHECK( result.predicted() );
+
+        solverB.knowledgeBase()->read([&](SmartEquilibriumSolver::Grid const& grid)
+        {
+            CHECK( grid.cells.size() == 1 );
+            CHECK( grid.cells.begin()->second.radius == 1 );
+        });
+    }
+
+    WHEN("temperature and pressure are given with reactivity restrictions and sensitivity derivatives - calcite and water")
+    {
+        EquilibriumSpecs specs(system);
+        specs.temperature();
+        specs.pressure();
+
+        SmartEquilibriumSolver solver(specs);
+
+        EquilibriumRestrictions restrictions(system);
+        restrictions.cannotIncreaseAbove("Calcite", 10.0, "mol");
+
+        EquilibriumSensitivity learnedsensitivity(specs);
+        EquilibriumSensitivity predictedsensitivity(specs);
+
+        // Learn and then predict with the same restricted species
+        CHECK( solveAt(solver, 25.0, 1.0, learnedsensitivity, restrictions).learned() );
+        CHECK( solveAt(solver, 30.0, 1.1, predictedsensitivity, restrictions).predicted() );
+
+        // The sensitivity derivatives of the predicted state are those of the learned calculation used in the prediction
+        CHECK( learnedsensitivity.dndc().norm() > 0.0 );
+        CHECK( predictedsensitivity.dndw() == learnedsensitivity.dndw() );
+        CHECK( predictedsensitivity.dndc() == learnedsensitivity.dndc() );
+        CHECK( predictedsensitivity.dudc() == learnedsensitivity.dudc() );
+
+        // The selection of chemical properties in the sensitivity objects of the caller is kept
+        EquilibriumSensitivity musensitivity(specs);
+        musensitivity.selectSpeciesChemicalPotentials();
+
+        CHECK( solveAt(solver, 30.0, 1.1, musensitivity, restrictions).predicted() );
+        CHECK( musensitivity.dudc().rows() == system.species().size() );
+        CHECK( musensitivity.dndc() == learnedsensitivity.dndc() );
+
+        SmartEquilibriumSolver musolver(specs);
+        CHECK( solveAt(musolver, 25.0, 1.0, musensitivity, restrictions).learned() );
+        CHECK( musensitivity.dudc().rows() == system.species().size() );
+        CHECK( musensitivity.dndc() == learnedsensitivity.dndc() );
+
+        // Calculations without restrictions do not use learned calculations with restrictions
+        CHECK( solveAt(solver, 30.0, 1.1).learned() );
+        CHECK( solveAt(solver, 30.0, 1.1).predicted() );
+
+        // The calculations with and without restrictions are stored in different clusters
+        solver.knowledgeBase()->read([&](SmartEquilibriumSolver::Grid const& grid)
+        {
+            REQUIRE( grid.cells.size() == 1 );
+            auto const& clusters = grid.cells.begin()->second.clusters;
+            REQUIRE( clusters.size() == 2 );
+            CHECK( clusters[0].restrictions != 0 );
+            CHECK( clusters[1].restrictions == 0 );
+            CHECK( clusters[0].label == clusters[1].label );
+        });
+
+        // A prediction that violates the upper bound on the amount of calcite is not accepted
+        EquilibriumRestrictions tighter(system);
+        tighter.cannotIncreaseAbove("Calcite", 1.05, "mol");
+
+        CHECK( !solveAt(solver, 30.0, 1.1, tighter).predicted() );
+
+        // A learned calculation in which calcite sat on the lower bound of its amount is not used once the value of this bound changes
+        SmartEquilibriumSolver boundsolver(specs);
+
+        EquilibriumRestrictions bounded(system);
+        bounded.cannotDecreaseBelow("Calcite", 0.99999, "mol"); // calcite would dissolve more than 1e-5 mol in 1 kg of water
+
+        EquilibriumRestrictions moved(system);
+        moved.cannotDecreaseBelow("Calcite", 0.99998, "mol");
+
+        CHECK( solveAt(boundsolver, 25.0, 1.0, bounded).learned() );
+        CHECK( solveAt(boundsolver, 25.0, 1.0, bounded).predicted() );
+        CHECK( solveAt(boundsolver, 25.0, 1.0, moved).learned() );
+        CHECK( boundsolver.statistics().num_rejected_restrictions == 1 );
+
+        boundsolver.knowledgeBase()->read([&](SmartEquilibriumSolver::Grid const& grid)
+        {
+            auto const& records = grid.cells.begin()->second.clusters[0].records;
+            REQUIRE( records.size() == 2 );
+            CHECK( records[0].ibounded.size() == 1 );
+            CHECK( records[0].nbounded[0] == Approx(0.99999) );
+            CHECK( records[1].nbounded[0] == Approx(0.99998) );
+        });
+    }
+
+    WHEN("temperature and pressure are given and statistics are collected - calcite and water")
+    {
+        SmartEquilibriumSolver solver(system);
+
+        CHECK( solveAt(solver, 25.0, 1.0).learned() );
+        CHECK( solveAt(solver, 30.0, 1.1).predicted() ); // same temperature-pressure grid cell as the previous calculation
+        CHECK( solveAt(solver, 50.0, 2.0).learned() ); // new temperature-pressure grid cell
+
+        SmartEquilibriumStatistics stats = solver.statistics();
+
+        CHECK( stats.num_solves == 3 );
+        CHECK( stats.num_predictions == 1 );
+        CHECK( stats.num_learnings == 2 );
+        CHECK( stats.num_records_tested == 1 );
+        CHECK( stats.num_records_tested_before_acceptance == 1 );
+        CHECK( stats.num_rejected_error_test == 0 );
+        CHECK( stats.num_rejected_negative_amounts == 0 );
+        CHECK( stats.num_rejected_mass_conservation == 0 );
+        CHECK( stats.num_rejected_restrictions == 0 );
+        CHECK( stats.hitRate() == Approx(1.0/3.0) );
+        CHECK( stats.averageRecordsTestedBeforeAcceptance() == 1.0 );
+
+        CHECK( stats.cells.size() == 2 );
+        CHECK( stats.num_cells == 2 );
+        CHECK( stats.num_clusters == 2 );
+        CHECK( stats.num_records == 2 );
+        CHECK( stats.memory_usage == solver.knowledgeBase()->memoryUsage() );
+
+        Index hits = 0, misses = 0;
+        for(auto const& [key, cellstats] : stats.cells)
+        {
+            hits += cellstats.hits;
+            misses += cellstats.misses;
+        }
+
+        CHECK( hits == 1 );
+        CHECK( misses == 2 );
+
+        // Resetting the statistics does not change the knowledge base
+        solver.resetStatistics();
+
+        stats = solver.statistics();
+
+        CHECK( stats.num_solves == 0 );
+        CHECK( stats.cells.empty() );
+        CHECK( stats.num_records == 2 );
+
+        // A prediction rejected by the error test is counted
+        SmartEquilibriumOptions options;
+        options.reltol = 0.0;
+        options.abstol = 0.0;
+        solver.setOptions(options);
+
+        CHECK( solveAt(solver, 30.0, 1.1).learned() );
+
+        stats = solver.statistics();
+
+        CHECK( stats.num_learnings == 1 );
+        CHECK( stats.num_rejected_error_test >= 1 );
+        CHECK( stats.num_records_tested == stats.num_rejected_error_test );
+    }
+
+    WHEN("temperature and pressure are given and learned calculations are saved and loaded - calcite and water")
+    {
+        SmartEquilibriumSolver solver1(system);
+
+        ChemicalState state = createState(25.0, 1.0, 1.0);
+
+        SmartEquilibriumResult result = solver1.solve(state);
+
+        CHECK( result.succeeded() );
+        CHECK( result.learned() );
+
+        state = createState(60.0, 1.0, 1.0);
+
+        result = solver1.solve(state);
+
+        CHECK( result.succeeded() );
+        CHECK( result.learned() );
+
+        solver1.knowledgeBase()->save("temporary.smartkb");
+
+        SmartEquilibriumSolver solver2(system);
+
+        solver2.knowledgeBase()->load("temporary.smartkb", EquilibriumSpecs::TP(system));
+
+        std::remove("temporary.smartkb");
+
+        CHECK( solver2.knowledgeBase()->size() == 2 );
+
+        // When the learned calculations were last used is restored, so that evictions after loading keep the most recently used ones
+        solver1.knowledgeBase()->read([&](SmartEquilibriumSolver::Grid const& grid1)
+        {
+            solver2.knowledgeBase()->read([&](SmartEquilibriumSolver::Grid const& grid2)
+            {
+                CHECK( grid2.time == grid1.time );
+                CHECK( grid2.time > 0 );
+                for(auto const& [key, cell] : grid1.cells)
+                    for(auto icluster = 0; icluster < cell.clusters.size(); ++icluster)
+                        for(auto irecord = 0; irecord < cell.clusters[icluster].records.size(); ++irecord)
+                            CHECK( grid2.cells.at(key).clusters[icluster].records[irecord].lastused == cell.clusters[icluster].records[irecord].lastused );
+            });
+        });
+
+        // The calculation learned and saved by the first solver is used by the second one
+        ChemicalState predictedstate1 = createState(30.0, 2.0, 1.1);
+        ChemicalState predictedstate2 = createState(30.0, 2.0, 1.1);
+
+        SmartEquilibriumResult result1 = solver1.solve(predictedstate1);
+        SmartEquilibriumResult result2 = solver2.solve(predictedstate2);
+
+        CHECK( result1.predicted() );
+        CHECK( result2.predicted() );
+
+        CHECK( largestRelativeDifference(predictedstate1.speciesAmounts(), predictedstate2.speciesAmounts()) == Approx(0.0) );
+
+        // Storing the sensitivity derivatives in single precision reduces the memory used by each learned calculation
+        SmartEquilibriumOptions options;
+        options.single_precision_derivatives = true;
+
+        SmartEquilibriumSolver solver3(system);
+        solver3.setOptions(options);
+
+        state = createState(25.0, 1.0, 1.0);
+
+        result = solver3.solve(state);
+
+        CHECK( result.learned() );
+
+        const auto bytesPerRecordDouble = solver1.knowledgeBase()->memoryUsage() / solver1.knowledgeBase()->size();
+        const auto bytesPerRecordSingle = solver3.knowledgeBase()->memoryUsage() / solver3.knowledgeBase()->size();
+
+        CHECK( bytesPerRecordSingle < bytesPerRecordDouble );
+
+        // Loading a file that does not exist fails
+        CHECK_THROWS( solver2.knowledgeBase()->load("temporary.smartkb", EquilibriumSpecs::TP(system)) );
+
+        // Loading a file that does not contain valid learned calculations fails
+        solver1.knowledgeBase()->save("temporary.smartkb");
+
+        std::ifstream in("temporary.smartkb", std::ios::binary);
+        const std::string contents((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        in.close();
+
+        auto loadCorrupted = [&](std::string const& corrupted)
+        {
+            std::ofstream("temporary.smartkb", std::ios::binary) << corrupted;
+            solver2.knowledgeBase()->load("temporary.smartkb", EquilibriumSpecs::TP(system));
+        };
+
+        std::string wrongmagic = contents;
+        wrongmagic[0] = 'X';
+
+        std::string wrongversion = contents;
+        wrongversion[8] += 1; // the version follows the 8 bytes of the identifier
+
+        const std::string truncated = contents.substr(0, contents.size() / 2);
+
+        CHECK_THROWS( loadCorrupted(wrongmagic) );
+        CHECK_THROWS( loadCorrupted(wrongversion) );
+        CHECK_THROWS( loadCorrupted(truncated) );
+        CHECK_NOTHROW( loadCorrupted(contents) );
+
+        // Loading learned calculations for a different chemical system fails
+        ChemicalSystem othersystem(db, AqueousPhase("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq) Na+ Cl-"), calcite);
+
+        CHECK_THROWS( SmartEquilibriumKnowledgeBase().load("temporary.smartkb", EquilibriumSpecs::TP(othersystem)) );
+
+        // Increments of usage counts registered before loading (e.g., by another solver sharing the knowledge base) are discarded
+        SmartEquilibriumSolver solver4(system);
+
+        CHECK( solveAt(solver4, 25.0, 1.0).learned() );
+        CHECK( solveAt(solver4, 90.0, 1.0).learned() ); // a learned calculation in a grid cell that does not exist in the file
+
+        Vec<SmartEquilibriumKnowledgeBase::PriorityUpdate> updates;
+        SmartEquilibriumKnowledgeBase::RecordIndex keep = {};
+
+        solver4.knowledgeBase()->read([&](SmartEquilibriumSolver::Grid const& grid)
+        {
+            for(auto const& [key, cell] : grid.cells)
+                for(auto icluster = 0; icluster < cell.clusters.size(); ++icluster)
+                    for(auto irecord = 0; irecord < cell.clusters[icluster].records.size(); ++irecord)
+                    {
+                        updates.push_back({ key, Index(icluster), Index(icluster), Index(irecord), grid.epoch, key, 0 });
+                        keep = { key, Index(icluster), Index(irecord), grid.epoch };
+                    }
+        });
+
+        solver4.knowledgeBase()->load("temporary.smartkb", EquilibriumSpecs::TP(system));
+
+        std::remove("temporary.smartkb");
+
+        CHECK_NOTHROW( solver4.knowledgeBase()->updatePriorities(updates) );
+        CHECK_NOTHROW( solver4.knowledgeBase()->evict(1, 0, 0.5, keep) );
+        CHECK( solver4.knowledgeBase()->size() == 2 );
+
+        // A grid cell whose learned calculations were all evicted is saved and loaded with a k-d tree that can still be searched
+        SmartEquilibriumOptions nnoptions;
+        nnoptions.search = SmartEquilibriumSearch::NearestNeighbors;
+
+        SmartEquilibriumSolver solver5(system);
+        solver5.setOptions(nnoptions);
+
+        CHECK( solveAt(solver5, 25.0, 1.0).learned() );
+        CHECK( solveAt(solver5, 90.0, 1.0).learned() );
+        CHECK( solver5.knowledgeBase()->evict(1, 0, 1.0) == 1 ); // the calculation learned at 25 °C is the least recently used one
+
+        solver5.knowledgeBase()->save("temporary.smartkb");
+
+        SmartEquilibriumSolver solver6(system);
+        solver6.setOptions(nnoptions);
+        solver6.knowledgeBase()->load("temporary.smartkb", EquilibriumSpecs::TP(system));
+
+        std::remove("temporary.smartkb");
+
+        CHECK( solver6.knowledgeBase()->size() == 1 );
+
+        SmartEquilibriumResult result6;
+        CHECK_NOTHROW( result6 = solveAt(solver6, 25.0, 1.0) );
+        CHECK( result6.succeeded() );
+    }
 }
@@ -0,0 +1,49 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "SmartEquilibriumStatistics.hpp"
+
+namespace Reaktoro {
+
+auto SmartEquilibriumCellStatistics::hitRate() const -> double
+{
+    const auto total = hits + misses;
+    return total ? double(hits) / total : 0.0;
+}
+
+auto SmartEquilibriumCellStatistics::missRate() const -> double
+{
+    const auto total = hits + misses;
+    return total ? double(misses) / total : 0.0;
+}
+
+auto SmartEquilibriumStatistics::hitRate() const -> double
+{
+    return num_solves ? double(num_predictions) / num_solves : 0.0;
+}
+
+auto SmartEquilibriumStatistics::missRate() const -> double
+{
+    return num_solves ? double(num_learnings) / num_solves : 0.0;
+}
+
+auto SmartEquilibriumStatistics::averageRecordsTestedBeforeAcceptance() const -> double
+{
+    return num_predictions ? double(num_records_tested_before_acceptance) / num_predictions : 0.0;
+}
+
+} // namespace Reaktoro
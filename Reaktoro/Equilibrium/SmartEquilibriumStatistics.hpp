@@ -0,0 +1,103 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/HashUtils.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// Used to provide the counts of predicted and learned calculations in a temperature-pressure grid cell.
+/// @see SmartEquilibriumStatistics
+struct SmartEquilibriumCellStatistics
+{
+    /// The number of calculations in this cell whose chemical equilibrium states were predicted.
+    Index hits = 0;
+
+    /// The number of calculations in this cell whose chemical equilibrium states were learned.
+    Index misses = 0;
+
+    /// Return the fraction of calculations in this cell whose chemical equilibrium states were predicted.
+    auto hitRate() const -> double;
+
+    /// Return the fraction of calculations in this cell whose chemical equilibrium states were learned.
+    auto missRate() const -> double;
+};
+
+/// Used to provide statistics of the smart chemical equilibrium calculations of a solver and of its learned calculations.
+/// The counters are accumulated over all calculations since the solver was
+/// constructed or since its statistics were last reset (see
+/// SmartEquilibriumSolver::resetStatistics). The sizes of the knowledge base
+/// are instead those at the moment the statistics are requested.
+/// @see SmartEquilibriumSolver::statistics
+struct SmartEquilibriumStatistics
+{
+    /// The number of smart chemical equilibrium calculations.
+    Index num_solves = 0;
+
+    /// The number of calculations whose chemical equilibrium states were predicted.
+    Index num_predictions = 0;
+
+    /// The number of calculations whose chemical equilibrium states were learned.
+    Index num_learnings = 0;
+
+    /// The number of learned calculations tested in all predictions, accepted or not.
+    Index num_records_tested = 0;
+
+    /// The number of learned calculations tested in the accepted predictions, including the one used in each of them.
+    Index num_records_tested_before_acceptance = 0;
+
+    /// The number of learned calculations rejected because the estimated errors in the chemical potentials of the primary species were too large.
+    Index num_rejected_error_test = 0;
+
+    /// The number of learned calculations rejected because they produced negative species amounts beyond tolerance.
+    Index num_rejected_negative_amounts = 0;
+
+    /// The number of learned calculations rejected because they did not conserve the amounts of the components within tolerance.
+    Index num_rejected_mass_conservation = 0;
+
+    /// The number of learned calculations rejected because they violated the bounds of the reactivity restrictions.
+    Index num_rejected_restrictions = 0;
+
+    /// The counts of predicted and learned calculations in each temperature-pressure grid cell (with the same keys as in SmartEquilibriumSolver::Grid).
+    Map<Pair<long, long>, SmartEquilibriumCellStatistics> cells;
+
+    /// The number of temperature-pressure grid cells in the knowledge base.
+    Index num_cells = 0;
+
+    /// The number of clusters in all temperature-pressure grid cells of the knowledge base.
+    Index num_clusters = 0;
+
+    /// The number of learned calculations in the knowledge base.
+    Index num_records = 0;
+
+    /// The number of bytes used to store the learned calculations in the knowledge base (see SmartEquilibriumKnowledgeBase::memoryUsage).
+    Index memory_usage = 0;
+
+    /// Return the fraction of calculations whose chemical equilibrium states were predicted.
+    auto hitRate() const -> double;
+
+    /// Return the fraction of calculations whose chemical equilibrium states were learned.
+    auto missRate() const -> double;
+
+    /// Return the average number of learned calculations tested in an accepted prediction.
+    auto averageRecordsTestedBeforeAcceptance() const -> double;
+};
+
+} // namespace Reaktoro
@@ -0,0 +1,55 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Equilibrium/SmartEquilibriumStatistics.hpp>
+using namespace Reaktoro;
+
+void exportSmartEquilibriumStatistics(py::module& m)
+{
+    py::class_<SmartEquilibriumCellStatistics>(m, "SmartEquilibriumCellStatistics")
+        .def(py::init<>())
+        .def_readwrite("hits", &SmartEquilibriumCellStatistics::hits, "The number of calculations in this cell whose chemical equilibrium states were predicted.")
+        .def_readwrite("misses", &SmartEquilibriumCellStatistics::misses, "The number of calculations in this cell whose chemical equilibrium states were learned.")
+        .def("hitRate", &SmartEquilibriumCellStatistics::hitRate, "Return the fraction of calculations in this cell whose chemical equilibrium states were predicted.")
+        .def("missRate", &SmartEquilibriumCellStatistics::missRate, "Return the fraction of calculations in this cell whose chemical equilibrium states were learned.")
+        ;
+
+    py::class_<SmartEquilibriumStatistics>(m, "SmartEquilibriumStatistics")
+        .def(py::init<>())
+        .def_readwrite("num_solves", &SmartEquilibriumStatistics::num_solves, "The number of smart chemical equilibrium calculations.")
+        .def_readwrite("num_predictions", &SmartEquilibriumStatistics::num_predictions, "The number of calculations whose chemical equilibrium states were predicted.")
+        .def_readwrite("num_learnings", &SmartEquilibriumStatistics::num_learnings, "The number of calculations whose chemical equilibrium states were learned.")
+        .def_readwrite("num_records_tested", &SmartEquilibriumStatistics::num_records_tested, "The number of learned calculations tested in all predictions, accepted or not.")
+        .def_readwrite("num_records_tested_before_acceptance", &SmartEquilibriumStatistics::num_records_tested_before_acceptance, "The number of learned calculations tested in the accepted predictions, including the one used in each of them.")
+        .def_readwrite("num_rejected_error_test", &SmartEquilibriumStatistics::num_rejected_error_test, "The number of learned calculations rejected because the estimated errors in the chemical potentials of the primary species were too large.")
+        .def_readwrite("num_rejected_negative_amounts", &SmartEquilibriumStatistics::num_rejected_negative_amounts, "The number of learned calculations rejected because they produced negative species amounts beyond tolerance.")
+        .def_readwrite("num_rejected_mass_conservation", &SmartEquilibriumStatistics::num_rejected_mass_conservation, "The number of learned calculations rejected because they did not conserve the amounts of the components within tolerance.")
+        .def_readwrite("num_rejected_restrictions", &SmartEquilibriumStatistics::num_rejected_restrictions, "The number of learned calculations rejected because they violated the bounds of the reactivity restrictions.")
+        .def_readwrite("cells", &SmartEquilibriumStatistics::cells, "The counts of predicted and learned calculations in each temperature-pressure grid cell.")
+        .def_readwrite("num_cells", &SmartEquilibriumStatistics::num_cells, "The number of temperature-pressure grid cells in the knowledge base.")
+        .def_readwrite("num_clusters", &SmartEquilibriumStatistics::num_clusters, "The number of clusters in all temperature-pressure grid cells of the knowledge base.")
+        .def_readwrite("num_records", &SmartEquilibriumStatistics::num_records, "The number of learned calculations in the knowledge base.")
+        .def_readwrite("memory_usage", &SmartEquilibriumStatistics::memory_usage, "The number of bytes used to store the learned calculations in the knowledge base.")
+        .def("hitRate", &SmartEquilibriumStatistics::hitRate, "Return the fraction of calculations whose chemical equilibrium states were predicted.")
+        .def("missRate", &SmartEquilibriumStatistics::missRate, "Return the fraction of calculations whose chemical equilibrium states were learned.")
+        .def("averageRecordsTestedBeforeAcceptance", &SmartEquilibriumStatistics::averageRecordsTestedBeforeAcceptance, "Return the average number of learned calculations tested in an accepted prediction.")
+        ;
+}
@@ -22,7 +22,63 @@
 
 namespace Reaktoro {
 
+/// The implicit methods for the kinetics steps, all of which are solved as chemical equilibrium problems with kinetic constraints.
+enum class KineticsMethod
+{
+    /// The first-order backward Euler method.
+    BackwardEuler,
+
+    /// The second-order, variable-step backward differentiation formula.
+    /// This multistep method uses the previous sub-step in
+    /// KineticsSolver::integrate, and thus backward Euler in its first
+    /// sub-step and in KineticsSolver::solve.
+    BDF2,
+
+    /// The second-order, L-stable, two-stage singly diagonally implicit Runge-Kutta method with *γ = 1 - 1/√2*.
+    /// Each step requires two chemical equilibrium calculations, one per stage.
+    SDIRK2,
+};
+
+/// The options for integrating chemical kinetics over a time interval with adaptive sub-steps.
+/// @see KineticsSolver::integrate
+struct KineticsIntegrationOptions
+{
+    /// The relative tolerance for the estimated local errors in the changes of *tr(K)n* in each sub-step, relative to the changes accumulated since the beginning of the time interval (see KineticsSolver::integrate).
+    double reltol = 1e-3;
+
+    /// The absolute tolerance for the estimated local errors in the changes of *tr(K)n* in each sub-step (in mol).
+    double abstol = 1e-10;
+
+    /// The first sub-step (in s), used when no sub-step from a previous integration is available (zero to use @ref KineticsOptions::dt0).
+    double dt_initial = 0.0;
+
+    /// The smallest sub-step allowed (in s), below which the integration fails.
+    double dt_min = 1e-14;
+
+    /// The largest sub-step allowed (in s).
+    double dt_max = 1e+300;
+
+    /// The safety factor applied to the sub-step estimated from the local error.
+    double safety = 0.9;
+
+    /// The largest factor by which a sub-step can grow after an accepted sub-step.
+    double growth_max = 5.0;
+
+    /// The smallest factor by which a sub-step can shrink after a rejected or failed sub-step.
+    double shrink_min = 0.1;
+
+    /// The maximum number of accepted and rejected sub-steps in a time interval.
+    Index max_steps = 10000;
+};
+
 /// The options for chemical kinetics calculation.
+/// The inherited equilibrium options have the same defaults as in
+/// EquilibriumOptions, whichever constructor is used. In particular, the
+/// Hessian matrix is not reused by default. Since consecutive kinetics steps
+/// are closely related calculations, enable both
+/// EquilibriumOptions::hessian_reuse and
+/// EquilibriumOptions::hessian_reuse_across_calculations to reuse it within
+/// and across kinetics steps.
 struct KineticsOptions : EquilibriumOptions
 {
     /// Construct a default KineticsOptions object.
@@ -35,6 +91,19 @@ struct KineticsOptions : EquilibriumOptions
 
     /// The time step used for preconditioning the chemical state when performing the very first chemical kinetics step.
     double dt0 = 1e-6;
+
+    /// The implicit method used for the kinetics steps.
+    KineticsMethod method = KineticsMethod::BackwardEuler;
+
+    /// The flag indicating if the initial guess of a kinetics step is extrapolated from the last two steps.
+    /// When a kinetics step continues from the state computed in the previous
+    /// one, the changes in the species amounts and in the extents of the
+    /// reactions are extrapolated from those of the last two steps, using the
+    /// rates of change in each, rather than starting from no change at all.
+    bool extrapolate_initial_guess = true;
+
+    /// The options for integrating chemical kinetics over a time interval with adaptive sub-steps (see KineticsSolver::integrate).
+    KineticsIntegrationOptions integration;
 };
 
 } // namespace Reaktoro
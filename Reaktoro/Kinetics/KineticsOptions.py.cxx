@@ -25,9 +25,31 @@ using namespace Reaktoro;
 
 void exportKineticsOptions(py::module& m)
 {
+    py::enum_<KineticsMethod>(m, "KineticsMethod")
+        .value("BackwardEuler" , KineticsMethod::BackwardEuler , "The first-order backward Euler method.")
+        .value("BDF2"          , KineticsMethod::BDF2          , "The second-order, variable-step backward differentiation formula.")
+        .value("SDIRK2"        , KineticsMethod::SDIRK2        , "The second-order, L-stable, two-stage singly diagonally implicit Runge-Kutta method.")
+        ;
+
+    py::class_<KineticsIntegrationOptions>(m, "KineticsIntegrationOptions")
+        .def(py::init<>())
+        .def_readwrite("reltol", &KineticsIntegrationOptions::reltol, "The relative tolerance for the estimated local errors in the changes of the extents of the reactions in each sub-step.")
+        .def_readwrite("abstol", &KineticsIntegrationOptions::abstol, "The absolute tolerance for the estimated local errors in the changes of the extents of the reactions in each sub-step (in mol).")
+        .def_readwrite("dt_initial", &KineticsIntegrationOptions::dt_initial, "The first sub-step (in s), used when no sub-step from a previous integration is available (zero to use dt0).")
+        .def_readwrite("dt_min", &KineticsIntegrationOptions::dt_min, "The smallest sub-step allowed (in s), below which the integration fails.")
+        .def_readwrite("dt_max", &KineticsIntegrationOptions::dt_max, "The largest sub-step allowed (in s).")
+        .def_readwrite("safety", &KineticsIntegrationOptions::safety, "The safety factor applied to the sub-step estimated from the local error.")
+        .def_readwrite("growth_max", &KineticsIntegrationOptions::growth_max, "The largest factor by which a sub-step can grow after an accepted sub-step.")
+        .def_readwrite("shrink_min", &KineticsIntegrationOptions::shrink_min, "The smallest factor by which a sub-step can shrink after a rejected or failed sub-step.")
+        .def_readwrite("max_steps", &KineticsIntegrationOptions::max_steps, "The maximum number of accepted and rejected sub-steps in a time interval.")
+        ;
+
     py::class_<KineticsOptions, EquilibriumOptions>(m, "KineticsOptions")
         .def(py::init<>())
         .def(py::init<EquilibriumOptions const&>())
         .def_readwrite("dt0", &KineticsOptions::dt0, "The time step used for preconditioning the chemical state when performing the very first chemical kinetics step.")
+        .def_readwrite("method", &KineticsOptions::method, "The implicit method used for the kinetics steps.")
+        .def_readwrite("extrapolate_initial_guess", &KineticsOptions::extrapolate_initial_guess, "The flag indicating if the initial guess of a kinetics step is extrapolated from the last two steps.")
+        .def_readwrite("integration", &KineticsOptions::integration, "The options for integrating chemical kinetics over a time interval with adaptive sub-steps.")
         ;
 }
@@ -22,6 +22,35 @@
 
 namespace Reaktoro {
 
+/// Used to describe the sub-steps taken when integrating chemical kinetics over a time interval.
+/// @see KineticsSolver::integrate
+struct KineticsResultDuringIntegration
+{
+    /// The number of accepted sub-steps.
+    Index accepted = 0;
+
+    /// The number of sub-steps rejected because their estimated local errors were too large.
+    Index rejected = 0;
+
+    /// The number of sub-steps whose calculations failed to converge (retried with shorter sub-steps).
+    Index failed = 0;
+
+    /// The time reached in the integration (in s), which is less than the time interval only if the integration failed.
+    double time = 0.0;
+
+    /// The smallest accepted sub-step (in s).
+    double dt_min = 0.0;
+
+    /// The largest accepted sub-step (in s).
+    double dt_max = 0.0;
+
+    /// The sub-step estimated for the next integration (in s), used as its first sub-step.
+    double dt_next = 0.0;
+
+    /// The largest normalized local error estimate among the accepted sub-steps (at most one).
+    double error = 0.0;
+};
+
 /// Used to describe the result of a chemical kinetics calculation.
 struct KineticsResult : EquilibriumResult
 {
@@ -31,6 +60,9 @@ struct KineticsResult : EquilibriumResult
     /// Construct a  KineticsResult object from a EquilibriumResult one.
     KineticsResult(EquilibriumResult const& other)
     : EquilibriumResult(other) {}
+
+    /// The sub-steps taken when integrating chemical kinetics over a time interval (only in KineticsSolver::integrate).
+    KineticsResultDuringIntegration integration;
 };
 
 } // namespace Reaktoro
@@ -25,7 +25,20 @@ using namespace Reaktoro;
 
 void exportKineticsResult(py::module& m)
 {
+    py::class_<KineticsResultDuringIntegration>(m, "KineticsResultDuringIntegration")
+        .def(py::init<>())
+        .def_readwrite("accepted", &KineticsResultDuringIntegration::accepted, "The number of accepted sub-steps.")
+        .def_readwrite("rejected", &KineticsResultDuringIntegration::rejected, "The number of sub-steps rejected because their estimated local errors were too large.")
+        .def_readwrite("failed", &KineticsResultDuringIntegration::failed, "The number of sub-steps whose calculations failed to converge (retried with shorter sub-steps).")
+        .def_readwrite("time", &KineticsResultDuringIntegration::time, "The time reached in the integration (in s), which is less than the time interval only if the integration failed.")
+        .def_readwrite("dt_min", &KineticsResultDuringIntegration::dt_min, "The smallest accepted sub-step (in s).")
+        .def_readwrite("dt_max", &KineticsResultDuringIntegration::dt_max, "The largest accepted sub-step (in s).")
+        .def_readwrite("dt_next", &KineticsResultDuringIntegration::dt_next, "The sub-step estimated for the next integration (in s), used as its first sub-step.")
+        .def_readwrite("error", &KineticsResultDuringIntegration::error, "The largest normalized local error estimate among the accepted sub-steps (at most one).")
+        ;
+
     py::class_<KineticsResult, EquilibriumResult>(m, "KineticsResult")
         .def(py::init<>())
+        .def_readwrite("integration", &KineticsResult::integration, "The sub-steps taken when integrating chemical kinetics over a time interval (only in KineticsSolver::integrate).")
         ;
 }
@@ -17,9 +17,14 @@
 
 #include "KineticsSolver.hpp"
 
+// C++ includes
+#include <algorithm>
+#include <cmath>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Core/ChemicalProps.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
@@ -50,6 +55,17 @@ struct KineticsSolver::Impl
     VectorXd c0;                       ///< The auxiliary vector used to set the initial amounts c0 of the conservative components of the equilibrium conditions used for the kinetics calculations.
     VectorXd plower;                   ///< The auxiliary vector used to set the lower bounds of p variables of the equilibrium conditions used for the kinetics calculations.
     VectorXd pupper;                   ///< The auxiliary vector used to set the upper bounds of p variables of the equilibrium conditions used for the kinetics calculations.
+    const MatrixXd M;                  ///< The matrix *M = tr(K)K* relating the changes of the extents of the reactions to their rates in each kinetics stage (*Δξ = Δξ0 + ΔtMr*).
+    const VectorXd zero;               ///< The zero explicit changes of the extents of the reactions Δξ0 in a backward Euler step.
+    double dtnext = 0.0;               ///< The sub-step estimated in the last integration over a time interval, used as the first sub-step in the next one (zero if none).
+    Index order = 1;                   ///< The order of accuracy of the method used in the last kinetics step.
+    VectorXd dxiprev;                  ///< The changes of the extents of the reactions in the previous accepted sub-step of the current integration (used by BDF2).
+    double dtprev = 0.0;               ///< The previous accepted sub-step of the current integration (zero if none, in which case BDF2 uses backward Euler).
+    VectorXd nlast;                    ///< The species amounts at the end of the last kinetics stage, used to detect if the next one continues from it.
+    VectorXd dnlast, dnbefore;         ///< The changes in the species amounts in the last two kinetics stages (used to extrapolate the initial guess of the next one).
+    VectorXd dxilast, dxibefore;       ///< The changes in the extents of the reactions in the last two kinetics stages (used to extrapolate the initial guess of the next one).
+    double dtlast = 0.0;               ///< The time step of the last kinetics stage (zero if none).
+    double dtbefore = 0.0;             ///< The time step of the kinetics stage before the last one (zero if none).
 
     /// Construct a KineticsSolver::Impl object with given equilibrium specifications to be attained during chemical kinetics.
     Impl(EquilibriumSpecs const& especs)
@@ -64,7 +80,9 @@ struct KineticsSolver::Impl
       w(kdims.Nw),
       c0(kdims.Nc),
       plower(kdims.Np),
-      pupper(kdims.Np)
+      pupper(kdims.Np),
+      M(system.stoichiometricMatrix().transpose() * system.stoichiometricMatrix()),
+      zero(zeros(system.reactions().size()))
     {
         // Initialize the equilibrium solver with the default options
         setOptions(koptions);
@@ -80,12 +98,21 @@ struct KineticsSolver::Impl
         ksolver.setOptions(koptions);
     }
 
-    /// Update the equilibrium conditions for kinetics with given state and time step.
-    auto updateEquilibriumConditionsForKinetics(ChemicalState& state, real const& dt) -> void
+    /// Update the equilibrium conditions for kinetics with given state, time step, and explicit changes of the extents of the reactions.
+    /// The explicit changes Δξ0 are added to the initial extents of the
+    /// reactions *ξ0 = tr(K)n0* among the initial amounts of the conservative
+    /// components, so that the Δξ control variables hold *Δξ - Δξ0* and the
+    /// kinetic constraints *Δξ - ΔtMr = 0* of the equilibrium problem
+    /// impose *Δξ = Δξ0 + ΔtMr*, without further input variables.
+    auto updateEquilibriumConditionsForKinetics(ChemicalState& state, real const& dt, VectorXdConstRef dxi0) -> void
     {
         kconditions.temperature(state.temperature());
         kconditions.pressure(state.pressure());
         kconditions.setInputVariable(idt, dt);
+        kconditions.setInitialComponentAmountsFromState(state);
+        c0 = kconditions.initialComponentAmounts().matrix();
+        c0.tail(dxi0.size()) += dxi0; // the reactivity constraints of the kinetic reactions are the last ones (see createEquilibriumSpecsForKinetics)
+        kconditions.setInitialComponentAmounts(c0);
     }
 
     /// Perform a kinetics step with a short time step if `state` has not reacted previously.
@@ -93,20 +120,21 @@ struct KineticsSolver::Impl
     {
         if(state.equilibrium().empty())
         {
-            updateEquilibriumConditionsForKinetics(state, koptions.dt0);
+            updateEquilibriumConditionsForKinetics(state, koptions.dt0, zero);
             return ksolver.solve(state, kconditions);
         }
         return {};
     }
 
-    /// Update the equilibrium conditions for kinetics with given state, time step, and equilibrium conditions to be attained during chemical kinetics.
-    auto updateEquilibriumConditionsForKinetics(ChemicalState& state, real const& dt, EquilibriumConditions const& econditions) -> void
+    /// Update the equilibrium conditions for kinetics with given state, time step, explicit changes of the extents of the reactions, and equilibrium conditions to be attained during chemical kinetics.
+    auto updateEquilibriumConditionsForKinetics(ChemicalState& state, real const& dt, VectorXdConstRef dxi0, EquilibriumConditions const& econditions) -> void
     {
         auto const& K = system.stoichiometricMatrix();
         auto const& n0 = state.speciesAmounts();
 
         w << econditions.inputValues(), dt;
         c0 << econditions.initialComponentAmountsGetOrCompute(state), K.transpose() * n0.matrix();
+        c0.tail(dxi0.size()) += dxi0; // the initial extents of the reactions shifted by their explicit changes Δξ0 (see above)
 
         plower.head(edims.Np) = econditions.lowerBoundsControlVariablesP();
         plower.tail(kdims.Nr).fill(-inf); // no lower bounds for Δξ
@@ -125,7 +153,7 @@ struct KineticsSolver::Impl
     {
         if(state.equilibrium().empty())
         {
-            updateEquilibriumConditionsForKinetics(state, koptions.dt0, econditions);
+            updateEquilibriumConditionsForKinetics(state, koptions.dt0, zero, econditions);
             return ksolver.solve(state, kconditions);
         }
         return {};
@@ -161,30 +189,42 @@ struct KineticsSolver::Impl
 
     auto solve(ChemicalState& state, real const& dt) -> KineticsResult
     {
-        auto result = preconditionOnFirstStep(state, dt);
-        updateEquilibriumConditionsForKinetics(state, dt);
-        return result += ksolver.solve(state, kconditions);
+        return step(state, dt, [&](real const& dts, VectorXdConstRef dxi0) -> KineticsResult
+        {
+            auto result = preconditionOnFirstStep(state, dts);
+            updateEquilibriumConditionsForKinetics(state, dts, dxi0);
+            return result += solveStage(state, dts, dxi0, [&] { return ksolver.solve(state, kconditions); });
+        });
     }
 
     auto solve(ChemicalState& state, real const& dt, EquilibriumRestrictions const& restrictions) -> KineticsResult
     {
-        auto result = preconditionOnFirstStep(state, dt);
-        updateEquilibriumConditionsForKinetics(state, dt);
-        return result += ksolver.solve(state, kconditions, restrictions);
+        return step(state, dt, [&](real const& dts, VectorXdConstRef dxi0) -> KineticsResult
+        {
+            auto result = preconditionOnFirstStep(state, dts);
+            updateEquilibriumConditionsForKinetics(state, dts, dxi0);
+            return result += solveStage(state, dts, dxi0, [&] { return ksolver.solve(state, kconditions, restrictions); });
+        });
     }
 
     auto solve(ChemicalState& state, real const& dt, EquilibriumConditions const& conditions) -> KineticsResult
     {
-        auto result = preconditionOnFirstStep(state, dt, conditions);
-        updateEquilibriumConditionsForKinetics(state, dt, conditions);
-        return result += ksolver.solve(state, kconditions);
+        return step(state, dt, [&](real const& dts, VectorXdConstRef dxi0) -> KineticsResult
+        {
+            auto result = preconditionOnFirstStep(state, dts, conditions);
+            updateEquilibriumConditionsForKinetics(state, dts, dxi0, conditions);
+            return result += solveStage(state, dts, dxi0, [&] { return ksolver.solve(state, kconditions); });
+        });
     }
 
     auto solve(ChemicalState& state, real const& dt, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> KineticsResult
     {
-        auto result = preconditionOnFirstStep(state, dt, conditions);
-        updateEquilibriumConditionsForKinetics(state, dt, conditions);
-        return result += ksolver.solve(state, kconditions, restrictions);
+        return step(state, dt, [&](real const& dts, VectorXdConstRef dxi0) -> KineticsResult
+        {
+            auto result = preconditionOnFirstStep(state, dts, conditions);
+            updateEquilibriumConditionsForKinetics(state, dts, dxi0, conditions);
+            return result += solveStage(state, dts, dxi0, [&] { return ksolver.solve(state, kconditions, restrictions); });
+        });
     }
 
     //=================================================================================================================
@@ -195,30 +235,304 @@ struct KineticsSolver::Impl
 
     auto solve(ChemicalState& state, KineticsSensitivity& sensitivity, real const& dt) -> KineticsResult
     {
-        auto result = preconditionOnFirstStep(state, dt);
-        updateEquilibriumConditionsForKinetics(state, dt);
-        return result += ksolver.solve(state, sensitivity, kconditions);
+        return step(state, dt, [&](real const& dts, VectorXdConstRef dxi0) -> KineticsResult
+        {
+            auto result = preconditionOnFirstStep(state, dts);
+            updateEquilibriumConditionsForKinetics(state, dts, dxi0);
+            return result += solveStage(state, dts, dxi0, [&] { return ksolver.solve(state, sensitivity, kconditions); });
+        });
     }
 
     auto solve(ChemicalState& state, KineticsSensitivity& sensitivity, real const& dt, EquilibriumRestrictions const& restrictions) -> KineticsResult
     {
-        auto result = preconditionOnFirstStep(state, dt);
-        updateEquilibriumConditionsForKinetics(state, dt);
-        return result += ksolver.solve(state, sensitivity, kconditions, restrictions);
+        return step(state, dt, [&](real const& dts, VectorXdConstRef dxi0) -> KineticsResult
+        {
+            auto result = preconditionOnFirstStep(state, dts);
+            updateEquilibriumConditionsForKinetics(state, dts, dxi0);
+            return result += solveStage(state, dts, dxi0, [&] { return ksolver.solve(state, sensitivity, kconditions, restrictions); });
+        });
     }
 
     auto solve(ChemicalState& state, KineticsSensitivity& sensitivity, real const& dt, EquilibriumConditions const& conditions) -> KineticsResult
     {
-        auto result = preconditionOnFirstStep(state, dt, conditions);
-        updateEquilibriumConditionsForKinetics(state, dt, conditions);
-        return result += ksolver.solve(state, sensitivity, kconditions);
+        return step(state, dt, [&](real const& dts, VectorXdConstRef dxi0) -> KineticsResult
+        {
+            auto result = preconditionOnFirstStep(state, dts, conditions);
+            updateEquilibriumConditionsForKinetics(state, dts, dxi0, conditions);
+            return result += solveStage(state, dts, dxi0, [&] { return ksolver.solve(state, sensitivity, kconditions); });
+        });
     }
 
     auto solve(ChemicalState& state, KineticsSensitivity& sensitivity, real const& dt, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> KineticsResult
     {
-        auto result = preconditionOnFirstStep(state, dt, conditions);
-        updateEquilibriumConditionsForKinetics(state, dt, conditions);
-        return result += ksolver.solve(state, sensitivity, kconditions, restrictions);
+        return step(state, dt, [&](real const& dts, VectorXdConstRef dxi0) -> KineticsResult
+        {
+            auto result = preconditionOnFirstStep(state, dts, conditions);
+            updateEquilibriumConditionsForKinetics(state, dts, dxi0, conditions);
+            return result += solveStage(state, dts, dxi0, [&] { return ksolver.solve(state, sensitivity, kconditions, restrictions); });
+        });
+    }
+
+    //=================================================================================================================
+    //
+    // CHEMICAL KINETICS STEP METHODS
+    //
+    //=================================================================================================================
+
+    /// Return the changes in a quantity over a kinetics stage with time step `dt`, extrapolated from its changes in the last two stages.
+    /// The rates of change in the last two stages are assumed to vary linearly between their midpoints.
+    auto extrapolate(VectorXd const& dlast, VectorXd const& dbefore, double dt) const -> VectorXd
+    {
+        const VectorXd qlast = dlast / dtlast;
+        if(dtbefore <= 0.0)
+            return dt * qlast;
+        const VectorXd qbefore = dbefore / dtbefore;
+        return dt * (qlast + (qlast - qbefore) * (dtlast + dt)/(dtbefore + dtlast));
+    }
+
+    /// Perform a kinetics stage with given explicit changes of the extents of the reactions Δξ0 and equilibrium calculation, starting from an initial guess extrapolated from the last two stages if the state continues from them.
+    auto solveStage(ChemicalState& state, real const& dt, VectorXdConstRef dxi0, Fn<EquilibriumResult()> const& solvefn) -> EquilibriumResult
+    {
+        auto const& K = system.stoichiometricMatrix();
+
+        const auto h = double(dt);
+        const VectorXd n0 = state.speciesAmounts().matrix().cast<double>();
+
+        // The history of the previous stages is discarded if the state does not continue from the last one (e.g., after a rejected sub-step)
+        if(dtlast > 0.0 && n0 != nlast)
+            dtlast = dtbefore = 0.0;
+
+        if(koptions.extrapolate_initial_guess && h > 0.0 && dtlast > 0.0)
+        {
+            // The species amounts are not extrapolated below half their initial values (nor below zero)
+            const ArrayXd n = (n0 + extrapolate(dnlast, dnbefore, h)).array().max(0.5 * n0.array()).max(0.0);
+
+            // Only the p control variables corresponding to Δξ - Δξ0 have an initial guess other than their default one
+            ArrayXd p = constants(kdims.Np, NaN).array();
+            p.tail(dxilast.size()) = (extrapolate(dxilast, dxibefore, h) - dxi0).array();
+
+            ksolver.setInitialGuess(n, p);
+        }
+
+        const auto res = solvefn();
+
+        if(!res.succeeded() || h <= 0.0)
+        {
+            dtlast = dtbefore = 0.0;
+            return res;
+        }
+
+        nlast = state.speciesAmounts().matrix().cast<double>();
+
+        std::swap(dnbefore, dnlast);
+        std::swap(dxibefore, dxilast);
+        dnlast = nlast - n0;
+        dxilast = K.transpose() * dnlast;
+        dtbefore = dtlast;
+        dtlast = h;
+
+        return res;
+    }
+
+    /// Return the rates of the reactions in a chemical state whose chemical properties are up-to-date.
+    static auto reactionRates(ChemicalState const& state) -> VectorXd
+    {
+        return state.props().reactionRates().matrix().cast<double>();
+    }
+
+    /// Perform a kinetics step with the method in the options, given a function that performs a kinetics stage *Δξ = Δξ0 + ΔtMr* with given Δt and Δξ0.
+    /// The state is updated by each stage, which starts from the state at the end of the previous one.
+    auto step(ChemicalState& state, real const& dt, Fn<KineticsResult(real const&, VectorXdConstRef)> const& stage) -> KineticsResult
+    {
+        const auto h = double(dt);
+
+        // The two-stage SDIRK method: Y1 = y0 + γhf(Y1) and y1 = Y2 = y0 + (1 - γ)hf(Y1) + γhf(Y2), so that Y2 - Y1 = (1 - 2γ)hf(Y1) + γhf(Y2)
+        if(koptions.method == KineticsMethod::SDIRK2 && h > 0.0)
+        {
+            const auto gamma = 1.0 - 1.0/std::sqrt(2.0);
+
+            auto result = stage(gamma * h, zero);
+            if(!result.succeeded())
+                return result;
+
+            const VectorXd dxi1 = gamma * h * M * reactionRates(state);
+            const VectorXd dxi0 = (1.0 - 2.0*gamma)/gamma * dxi1;
+
+            result += stage(gamma * h, dxi0);
+
+            order = 2;
+
+            return result;
+        }
+
+        // The variable-step BDF2 method: y1 - y0 = ω²/(1 + 2ω)(y0 - y[-1]) + (1 + ω)/(1 + 2ω)hf(y1), with ω = h/h[-1]
+        if(koptions.method == KineticsMethod::BDF2 && h > 0.0 && dtprev > 0.0)
+        {
+            const auto omega = h / dtprev;
+            const auto a = omega * omega / (1.0 + 2.0*omega);
+            const auto b = (1.0 + omega) / (1.0 + 2.0*omega);
+
+            order = 2;
+
+            return stage(b * h, a * dxiprev);
+        }
+
+        // The backward Euler method: y1 = y0 + hf(y1)
+        order = 1;
+
+        return stage(dt, zero);
+    }
+
+    //=================================================================================================================
+    //
+    // CHEMICAL KINETICS INTEGRATION METHODS
+    //
+    //=================================================================================================================
+
+    auto integrate(ChemicalState& state, real const& dt) -> KineticsResult
+    {
+        return integrate(state, dt, [&](real const& h) { return solve(state, h); });
+    }
+
+    auto integrate(ChemicalState& state, real const& dt, EquilibriumRestrictions const& restrictions) -> KineticsResult
+    {
+        return integrate(state, dt, [&](real const& h) { return solve(state, h, restrictions); });
+    }
+
+    auto integrate(ChemicalState& state, real const& dt, EquilibriumConditions const& conditions) -> KineticsResult
+    {
+        return integrate(state, dt, [&](real const& h) { return solve(state, h, conditions); });
+    }
+
+    auto integrate(ChemicalState& state, real const& dt, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> KineticsResult
+    {
+        return integrate(state, dt, [&](real const& h) { return solve(state, h, conditions, restrictions); });
+    }
+
+    /// React a chemical state for a given time interval using adaptive sub-steps, each one performed with a given kinetics step function.
+    auto integrate(ChemicalState& state, real const& dt, Fn<KineticsResult(real const&)> const& step) -> KineticsResult
+    {
+        auto const& opts = koptions.integration;
+        auto const& K = system.stoichiometricMatrix();
+
+        const auto tend = double(dt);
+
+        // Nothing to integrate for a zero time interval, other than preconditioning the state
+        if(tend <= 0.0)
+            return step(dt);
+
+        KineticsResult result;
+        auto& stats = result.integration;
+
+        // Precondition a state that has not reacted previously, so that the reaction rates at the beginning of the first sub-step are those of the preconditioned state
+        if(state.equilibrium().empty())
+            result += step(0.0);
+
+        // The rates of the reactions at the beginning of the current sub-step (the rates at the end of an accepted sub-step are reused in the next one)
+        VectorXd r0 = ChemicalProps(state).reactionRates().matrix().cast<double>();
+
+        // The species amounts at the beginning of the current sub-step
+        VectorXd n0 = state.speciesAmounts().matrix().cast<double>();
+
+        // The changes of tr(K)n accumulated since the beginning of the time interval, at the beginning of the current sub-step
+        VectorXd xi0 = zeros(r0.size());
+
+        // The current time and the estimated sub-step
+        auto t = 0.0;
+        auto h = dtnext > 0.0 ? dtnext : (opts.dt_initial > 0.0 ? opts.dt_initial : koptions.dt0);
+
+        // The largest growth factor of the sub-steps, limited for the variable-step BDF2 method to keep it zero-stable
+        const auto growth_max = koptions.method == KineticsMethod::BDF2 ? std::min(opts.growth_max, 2.0) : opts.growth_max;
+
+        Index steps = 0;
+
+        // Start without the history of a previous sub-step (the first sub-step of BDF2 is a backward Euler one)
+        dtprev = 0.0;
+
+        ChemicalState statebkp = state;
+
+        while(t < tend)
+        {
+            // Stop with failure if the sub-steps became too short or too many
+            if(h < opts.dt_min || steps++ >= opts.max_steps)
+                break;
+
+            h = std::min(h, opts.dt_max);
+
+            // The sub-step to be taken, which is stretched or shortened to reach the end of the time interval without leaving a tiny last sub-step
+            const auto hstep = t + 1.1 * h >= tend ? tend - t : h;
+
+            statebkp = state;
+
+            const auto res = step(hstep);
+            result += res;
+
+            // Retry a sub-step whose calculation did not converge with a shorter one
+            if(!res.succeeded())
+            {
+                state = statebkp;
+                stats.failed += 1;
+                h = hstep * opts.shrink_min;
+                continue;
+            }
+
+            const VectorXd r1 = state.props().reactionRates().matrix().cast<double>();
+            const VectorXd n1 = state.speciesAmounts().matrix().cast<double>();
+
+            // The changes of tr(K)n in the sub-step (computed from the changes of the species amounts to avoid cancellation with abundant species such as H2O)
+            const VectorXd dxi = K.transpose() * (n1 - n0);
+
+            // The changes of tr(K)n accumulated since the beginning of the time interval, at the end of the sub-step
+            const VectorXd xi1 = xi0 + dxi;
+
+            // The difference between the changes of tr(K)n computed with the method (e.g., hMr1 for backward Euler) and with the trapezoidal rule (hM(r0 + r1)/2)
+            // Note: This is measured in the space of the kinetic constraints tr(K)Δn = MΔξ, since M is singular when reactions have dependent stoichiometries (e.g., Calcite and Aragonite)
+            const VectorXd e = dxi - 0.5 * hstep * M * (r0 + r1);
+
+            // The largest local error estimate, normalized by the tolerances relative to the accumulated changes of tr(K)n
+            const ArrayXd scale = opts.abstol + opts.reltol * xi0.cwiseAbs().cwiseMax(xi1.cwiseAbs()).array();
+            const auto error = e.size() ? (e.array().abs() / scale).maxCoeff() : 0.0;
+
+            // The factor for the next sub-step, considering that the local error of a method of order p is proportional to the sub-step to the power p + 1
+            const auto factor = error > 0.0 ? std::clamp(opts.safety * std::pow(error, -1.0/(order + 1)), opts.shrink_min, growth_max) : growth_max;
+
+            if(error <= 1.0)
+            {
+                t += hstep;
+                r0 = r1;
+                n0 = n1;
+                xi0 = xi1;
+                dxiprev = dxi;
+                dtprev = hstep;
+                stats.accepted += 1;
+                stats.dt_min = stats.accepted == 1 ? hstep : std::min(stats.dt_min, hstep);
+                stats.dt_max = std::max(stats.dt_max, hstep);
+                stats.error = std::max(stats.error, error);
+
+                // A last sub-step shortened to reach the end of the time interval does not shrink the estimated sub-step
+                h = hstep < h ? std::max(h, hstep * factor) : hstep * factor;
+            }
+            else
+            {
+                state = statebkp;
+                stats.rejected += 1;
+                h = hstep * factor;
+            }
+        }
+
+        stats.time = t;
+        stats.dt_next = h;
+
+        // The history of the sub-steps is not used outside this integration (e.g., when solving a single kinetics step)
+        dtprev = 0.0;
+
+        // Reuse the last estimated sub-step in the next integration, unless this one failed
+        dtnext = t < tend ? 0.0 : h;
+
+        // The integration succeeds only if the end of the time interval is reached
+        result.optima.succeeded = t >= tend;
+
+        return result;
     }
 };
 
@@ -303,6 +617,26 @@ auto KineticsSolver::solve(ChemicalState& state, KineticsSensitivity& sensitivit
     return pimpl->solve(state, sensitivity, dt, conditions, restrictions);
 }
 
+auto KineticsSolver::integrate(ChemicalState& state, real const& dt) -> KineticsResult
+{
+    return pimpl->integrate(state, dt);
+}
+
+auto KineticsSolver::integrate(ChemicalState& state, real const& dt, EquilibriumRestrictions const& restrictions) -> KineticsResult
+{
+    return pimpl->integrate(state, dt, restrictions);
+}
+
+auto KineticsSolver::integrate(ChemicalState& state, real const& dt, EquilibriumConditions const& conditions) -> KineticsResult
+{
+    return pimpl->integrate(state, dt, conditions);
+}
+
+auto KineticsSolver::integrate(ChemicalState& state, real const& dt, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> KineticsResult
+{
+    return pimpl->integrate(state, dt, conditions, restrictions);
+}
+
 auto KineticsSolver::setOptions(KineticsOptions const& options) -> void
 {
     pimpl->setOptions(options);
@@ -92,6 +92,9 @@ public:
     //=================================================================================================================
 
     /// React a chemical state for a given time interval.
+    /// The kinetics step is performed with the method in KineticsOptions::method.
+    /// A single BDF2 step has no previous step to use and is therefore a
+    /// backward Euler one (see @ref integrate for multistep integration).
     /// @param[in,out] state The initial guess for the calculation (in) and the computed reacted state (out)
     /// @param dt The time step in the kinetics calculation (in s).
     auto solve(ChemicalState& state, real const& dt) -> KineticsResult;
@@ -122,6 +125,7 @@ public:
     //=================================================================================================================
 
     /// React a chemical state for a given time interval and compute sensitivity derivatives.
+    /// With KineticsMethod::SDIRK2, the sensitivity derivatives are those of the second stage of the kinetics step.
     /// @param[in,out] state The initial guess for the calculation (in) and the computed reacted state (out)
     /// @param[out] sensitivity The sensitivity derivatives of the reacted state with respect to given input conditions
     /// @param dt The time step in the kinetics calculation (in s).
@@ -149,6 +153,46 @@ public:
     /// @param restrictions The reactivity restrictions on the amounts of selected species
     auto solve(ChemicalState& state, KineticsSensitivity& sensitivity, real const& dt, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> KineticsResult;
 
+    //=================================================================================================================
+    //
+    // CHEMICAL KINETICS INTEGRATION METHODS
+    //
+    //=================================================================================================================
+
+    /// React a chemical state for a given time interval using adaptive sub-steps with error control.
+    /// The time interval is covered with implicit (backward Euler) sub-steps
+    /// whose lengths are chosen so that the estimated local errors in the
+    /// changes of *tr(K)n* (the quantities constrained in each kinetics step,
+    /// with *K* the stoichiometric matrix of the reactions) are within the
+    /// tolerances in KineticsIntegrationOptions. The local errors are
+    /// estimated by comparing these changes with those of the trapezoidal
+    /// rule, computed with the reaction rates at the beginning and end of each
+    /// sub-step, relative to the changes of *tr(K)n* accumulated since the
+    /// beginning of the time interval. This remains meaningful when reactions
+    /// have dependent stoichiometries (e.g., Calcite and Aragonite).
+    /// Sub-steps whose calculations fail to converge are retried with
+    /// shorter ones. The last estimated sub-step is used as the first one in
+    /// the next call.
+    /// @param[in,out] state The initial guess for the calculation (in) and the computed reacted state (out)
+    /// @param dt The time interval in the kinetics calculation (in s).
+    auto integrate(ChemicalState& state, real const& dt) -> KineticsResult;
+
+    /// React a chemical state for a given time interval using adaptive sub-steps with error control respecting given reactivity restrictions.
+    /// \copydetails KineticsSolver::integrate(ChemicalState&, real const&)
+    /// @param restrictions The reactivity restrictions on the amounts of selected species
+    auto integrate(ChemicalState& state, real const& dt, EquilibriumRestrictions const& restrictions) -> KineticsResult;
+
+    /// React a chemical state for a given time interval using adaptive sub-steps with error control respecting given constraint conditions.
+    /// \copydetails KineticsSolver::integrate(ChemicalState&, real const&)
+    /// @param conditions The specified constraint conditions to be attained during chemical kinetics
+    auto integrate(ChemicalState& state, real const& dt, EquilibriumConditions const& conditions) -> KineticsResult;
+
+    /// React a chemical state for a given time interval using adaptive sub-steps with error control respecting given constraint conditions and reactivity restrictions.
+    /// \copydetails KineticsSolver::integrate(ChemicalState&, real const&)
+    /// @param conditions The specified constraint conditions to be attained during chemical kinetics
+    /// @param restrictions The reactivity restrictions on the amounts of selected species
+    auto integrate(ChemicalState& state, real const& dt, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> KineticsResult;
+
     //=================================================================================================================
     //
     // MISCELLANEOUS METHODS
@@ -50,6 +50,11 @@ void exportKineticsSolver(py::module& m)
         .def("solve", py::overload_cast<ChemicalState&, KineticsSensitivity&, real const&, EquilibriumConditions const&>(&KineticsSolver::solve), "React a chemical state for a given time interval respecting given constraint conditions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("dt"), py::arg("conditions"))
         .def("solve", py::overload_cast<ChemicalState&, KineticsSensitivity&, real const&, EquilibriumConditions const&, EquilibriumRestrictions const&>(&KineticsSolver::solve), "React a chemical state for a given time interval respecting given constraint conditions and reactivity restrictions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("dt"), py::arg("conditions"), py::arg("restrictions"))
 
+        .def("integrate", py::overload_cast<ChemicalState&, real const&>(&KineticsSolver::integrate), "React a chemical state for a given time interval using adaptive sub-steps with error control.", py::arg("state"), py::arg("dt"))
+        .def("integrate", py::overload_cast<ChemicalState&, real const&, EquilibriumRestrictions const&>(&KineticsSolver::integrate), "React a chemical state for a given time interval using adaptive sub-steps with error control respecting given reactivity restrictions.", py::arg("state"), py::arg("dt"), py::arg("restrictions"))
+        .def("integrate", py::overload_cast<ChemicalState&, real const&, EquilibriumConditions const&>(&KineticsSolver::integrate), "React a chemical state for a given time interval using adaptive sub-steps with error control respecting given constraint conditions.", py::arg("state"), py::arg("dt"), py::arg("conditions"))
+        .def("integrate", py::overload_cast<ChemicalState&, real const&, EquilibriumConditions const&, EquilibriumRestrictions const&>(&KineticsSolver::integrate), "React a chemical state for a given time interval using adaptive sub-steps with error control respecting given constraint conditions and reactivity restrictions.", py::arg("state"), py::arg("dt"), py::arg("conditions"), py::arg("restrictions"))
+
         .def("setOptions", &KineticsSolver::setOptions)
         ;
 }
@@ -16,6 +16,7 @@
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
 // C++ includes
+#include <cmath>
 #include <iomanip>
 
 // Catch includes
@@ -128,4 +129,182 @@ TEST_CASE("Testing KineticsSolver", "[KineticsSolver]")
 
         REQUIRE_NOTHROW( solver.solve(state, dt) ); // state was previously used in an equilibrium calculation can the underlying Optima:State does not have p variables (which exist in the kinetic calculations)
     }
+
+    SECTION("When the time interval is integrated with adaptive sub-steps")
+    {
+        KineticsSolver solver(system);
+
+        KineticsOptions options;
+        options.integration.reltol = 1e-5;
+        solver.setOptions(options);
+
+        const auto dt = 100.0;
+
+        ChemicalState onestep = state;
+
+        REQUIRE( solver.solve(onestep, dt).succeeded() );
+
+        auto res = solver.integrate(state, dt);
+
+        REQUIRE( res.succeeded() );
+
+        // The exact amount of C(gr) is exp(-k0*t); a single backward Euler step of 100 s yields 1/(1 + k0*t) = 0.5 instead
+        CHECK( onestep.speciesAmount("C(gr)") == Approx(0.5) );
+        CHECK( state.speciesAmount("C(gr)") == Approx(std::exp(-1.0)).epsilon(0.01) );
+
+        CHECK( res.integration.accepted > 1 );
+        CHECK( res.integration.time == Approx(dt) );
+        CHECK( res.integration.error <= 1.0 );
+        CHECK( res.integration.dt_min <= res.integration.dt_max );
+        CHECK( res.integration.dt_next > 0.0 );
+
+        // The next integration starts with the last estimated sub-step
+        auto res2 = solver.integrate(state, dt);
+
+        REQUIRE( res2.succeeded() );
+
+        CHECK( res2.integration.accepted < res.integration.accepted );
+        CHECK( state.speciesAmount("C(gr)") == Approx(std::exp(-2.0)).epsilon(0.01) );
+    }
+
+    SECTION("When the time interval is integrated with adaptive sub-steps and two reactions have identical stoichiometries")
+    {
+        // The two reactions proceed in opposite directions as calcite dissolving while aragonite precipitates, with a net rate of C(gr) consumption k0*nc/2
+        auto ratefnB = [&](ChemicalProps const& props) { return -0.5 * ratefn(props); };
+
+        ChemicalSystem system(db,
+            CondensedPhase("C(gr)"),
+            GaseousPhase("O2 CO2"),
+            GeneralReaction("C(gr) + O2 = CO2").setName("A").setRateModel(ratefn),
+            GeneralReaction("C(gr) + O2 = CO2").setName("B").setRateModel(ratefnB)
+        );
+
+        ChemicalState state(system);
+        state.set("C(gr)", 1.0, "mol");
+        state.set("O2", 1.0, "mol");
+
+        KineticsSolver solver(system);
+
+        KineticsOptions options;
+        options.integration.reltol = 1e-5;
+        solver.setOptions(options);
+
+        const auto dt = 100.0;
+
+        auto res = solver.integrate(state, dt);
+
+        REQUIRE( res.succeeded() );
+
+        CHECK( state.speciesAmount("C(gr)") == Approx(std::exp(-0.5)).epsilon(0.01) );
+
+        CHECK( res.integration.time == Approx(dt) );
+        CHECK( res.integration.error <= 1.0 );
+        CHECK( res.integration.rejected <= res.integration.accepted );
+    }
+
+    SECTION("When second-order methods are used")
+    {
+        const auto dt = 10.0;
+
+        // The exact amount of C(gr) after a step of 10 s is exp(-0.1); a backward Euler step yields 1/1.1 instead
+        const auto exact = std::exp(-0.1);
+
+        KineticsOptions options;
+
+        KineticsSolver solver(system);
+
+        ChemicalState bestate = state;
+        REQUIRE( solver.solve(bestate, dt).succeeded() );
+        CHECK( bestate.speciesAmount("C(gr)") == Approx(1.0/1.1) );
+
+        options.method = KineticsMethod::SDIRK2;
+        solver.setOptions(options);
+
+        ChemicalState sdirkstate = state;
+        REQUIRE( solver.solve(sdirkstate, dt).succeeded() );
+        CHECK( std::abs(sdirkstate.speciesAmount("C(gr)") - exact) < 0.1 * std::abs(bestate.speciesAmount("C(gr)") - exact) );
+
+        // A single BDF2 step has no previous step to use, so it is a backward Euler one
+        options.method = KineticsMethod::BDF2;
+        solver.setOptions(options);
+
+        ChemicalState bdfstate = state;
+        REQUIRE( solver.solve(bdfstate, dt).succeeded() );
+        CHECK( bdfstate.speciesAmount("C(gr)") == Approx(1.0/1.1) );
+
+        // The second-order methods need fewer sub-steps than backward Euler to integrate a time interval with the same tolerances
+        options.integration.reltol = 1e-5;
+
+        auto integrate = [&](KineticsMethod method)
+        {
+            options.method = method;
+            KineticsSolver solver(system);
+            solver.setOptions(options);
+            ChemicalState copy = state;
+            auto res = solver.integrate(copy, 100.0);
+            REQUIRE( res.succeeded() );
+            CHECK( copy.speciesAmount("C(gr)") == Approx(std::exp(-1.0)).epsilon(0.01) );
+            return res.integration.accepted;
+        };
+
+        const auto nbe = integrate(KineticsMethod::BackwardEuler);
+
+        CHECK( integrate(KineticsMethod::SDIRK2) < nbe );
+        CHECK( integrate(KineticsMethod::BDF2) < nbe );
+    }
+
+    SECTION("When consecutive steps start from initial guesses extrapolated from previous ones")
+    {
+        // Perform consecutive kinetics steps and return the accumulated results of all steps but the first, which includes the preconditioning of the state
+        auto react = [&](ChemicalState& state, KineticsOptions const& options)
+        {
+            KineticsSolver solver(system);
+            solver.setOptions(options);
+
+            KineticsResult total;
+            for(auto i = 0; i < 20; ++i)
+            {
+                auto res = solver.solve(state, 5.0);
+                REQUIRE( res.succeeded() );
+                if(i > 0) total += res;
+            }
+            return total;
+        };
+
+        KineticsOptions options;
+        options.extrapolate_initial_guess = false;
+        options.hessian_reuse = false;
+
+        ChemicalState state1 = state;
+        ChemicalState state2 = state;
+        ChemicalState state3 = state;
+
+        const auto result1 = react(state1, options);
+
+        options.extrapolate_initial_guess = true;
+
+        const auto result2 = react(state2, options);
+
+        options.hessian_reuse = true;
+        options.hessian_reuse_across_calculations = true;
+
+        const auto result3 = react(state3, options);
+
+        // The extrapolated initial guesses do not change the computed states, only the effort to compute them
+        CHECK( state2.speciesAmount("C(gr)") == Approx(state1.speciesAmount("C(gr)")) );
+        CHECK( state3.speciesAmount("C(gr)") == Approx(state1.speciesAmount("C(gr)")) );
+
+        CHECK( result2.optima.iterations < result1.optima.iterations );
+
+        // The Hessian matrices are reused across and within the steps when enabled, so that fewer of them are computed
+        CHECK( result2.hessian_reuses == 0 );
+        CHECK( result3.hessian_reuses > 0 );
+        CHECK( result3.hessian_refreshes < result2.hessian_refreshes );
+
+        // The Hessian matrices are not reused by default, whether or not the kinetics options are created from equilibrium options
+        CHECK_FALSE( KineticsOptions().hessian_reuse );
+        CHECK_FALSE( KineticsOptions().hessian_reuse_across_calculations );
+        CHECK_FALSE( KineticsOptions(EquilibriumOptions()).hessian_reuse );
+        CHECK_FALSE( KineticsOptions(EquilibriumOptions()).hessian_reuse_across_calculations );
+    }
 }
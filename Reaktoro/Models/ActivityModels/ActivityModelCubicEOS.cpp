@@ -92,6 +92,26 @@ auto activityModelCubicEOS(SpeciesList const& specieslist, CubicEOS::EquationMod
         props.ln_g = cprops.ln_phi;
         props.ln_a = cprops.ln_phi + log(x) + log(Pbar);
         props.som  = cprops.som;
+
+        // Compute the analytic derivatives if these have been requested
+        if(props.jacobian == nullptr)
+            return;
+
+        auto& jac = *props.jacobian;
+        const auto N = x.size();
+        jac.initialize(N);
+        jac.ln_g_T.resize(N);
+        jac.ln_g_P.resize(N);
+
+        if(!equation.computeLnPhiDerivatives(jac.ln_g_x, jac.ln_g_T, jac.ln_g_P))
+            return;
+
+        jac.ln_a_x = jac.ln_g_x;
+        for(Index i = 0; i < N; ++i)
+            jac.ln_a_x(i, i) += 1.0/double(x[i]);
+        jac.ln_a_T = jac.ln_g_T;
+        jac.ln_a_P = jac.ln_g_P + 1.0/double(P);
+        jac.available = true;
     };
 
     return model;
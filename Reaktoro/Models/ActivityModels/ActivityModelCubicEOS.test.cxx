@@ -22,6 +22,8 @@
 #include <Reaktoro/Models/ActivityModels/ActivityModelCubicEOS.hpp>
 using namespace Reaktoro;
 
+namespace test { extern auto checkActivityJacobian(ActivityModel const& fn, real const& T, real const& P, ArrayXrConstRef x, bool checkTP) -> void; }
+
 namespace {
 
 // Check if the activities of the fluid species are correct assuming activity coefficients are.
@@ -114,6 +116,13 @@ TEST_CASE("Testing ActivityModelCubicEOS", "[ActivityModelCubicEOS]")
 
             checkActivities(x, P, props);
         }
+
+        WHEN("Analytic derivatives of the activities are requested")
+        {
+            test::checkActivityJacobian(fn, 25.0 + 273.15, 1.0 * 1e5, x, true);   // gas state
+            test::checkActivityJacobian(fn, 10.0 + 273.15, 100.0 * 1e5, x, true); // liquid state
+            test::checkActivityJacobian(fn, 60.0 + 273.15, 100.0 * 1e5, x, true); // supercritical state
+        }
     }
 
     //=============================================
@@ -56,8 +56,11 @@ auto activityModelDavies(const SpeciesList& species, ActivityModelDaviesParams p
     // The electrical charges of the charged species only
     const ArrayXd charges = mixture.charges()(icharged_species);
 
+    // The number of species in the aqueous mixture
+    const auto num_species = species.size();
+
     // Shared pointers used in `props.extra` to avoid heap memory allocation for big objects
-    auto stateptr = std::make_shared<AqueousMixtureState>();
+    AqueousMixtureStatePtr stateptr;
     auto mixtureptr = std::make_shared<AqueousMixture>(mixture);
 
     // Define the activity model function of the aqueous mixture
@@ -73,7 +76,7 @@ auto activityModelDavies(const SpeciesList& species, ActivityModelDaviesParams p
         props.som = StateOfMatter::Liquid;
 
         // Export the aqueous mixture and its state via the `extra` data member
-        props.extra["AqueousMixtureState"] = stateptr;
+        props.extra["AqueousMixtureState"] = stateptr.shared();
         props.extra["AqueousMixture"] = mixtureptr;
 
         // Auxiliary constant references
@@ -148,6 +151,61 @@ auto activityModelDavies(const SpeciesList& species, ActivityModelDaviesParams p
 
         // Set the activity coefficient of water (mole fraction scale)
         ln_g[iwater] = ln_a[iwater] - ln_xw;
+
+        // Compute the analytic derivatives with respect to mole fractions if these have been requested
+        if(props.jacobian == nullptr)
+            return;
+
+        auto& jac = *props.jacobian;
+        jac.initialize(num_species);
+
+        const auto xwval = double(xw);
+        const auto Ival = double(I);
+        const auto sqrtIval = double(sqrtI);
+        const auto Aval = double(A);
+        const auto bionsval = double(bions);
+
+        // The derivatives of the stoichiometric ionic strength with respect to mole fractions
+        const ArrayXd I_x = mixtureptr->stoichiometricIonicStrengthDerivatives(x);
+
+        // The derivatives of sigmac, sigman and Gammac with respect to the stoichiometric ionic strength
+        const auto sigmac_I = -Aval*(0.5/(sqrtIval*(1 + sqrtIval)*(1 + sqrtIval)) - bionsval) * ln10;
+        const auto sigman_I = double(bneutrals) * ln10;
+        const auto Gammac_I = -2*Aval*(sqrtIval/(1 + sqrtIval) - bionsval*Ival) * ln10;
+
+        // The weights of the molalities of the solutes in the ln activity of water
+        ArrayXd wm = ArrayXd::Zero(num_species);
+
+        // The coefficient of the derivatives of the ionic strength in the derivatives of the ln activity of water
+        auto wI = 0.0;
+
+        // The sum of the products of the weights above with the molalities of the solutes
+        auto wmsum = 0.0;
+
+        for(Index i = 0; i < num_charged_species; ++i)
+        {
+            const auto ispecies = icharged_species[i];
+            const auto z2 = charges[i] * charges[i];
+            jac.ln_g_x.row(ispecies) = (sigmac_I * z2 * I_x).matrix().transpose();
+            wm[ispecies] = 1.0 + double(ln_g[ispecies]);
+            wmsum += wm[ispecies] * double(m[ispecies]);
+            wI += double(m[ispecies]) * z2 * sigmac_I - Gammac_I;
+        }
+
+        for(Index i = 0; i < num_neutral_species; ++i)
+        {
+            const auto ispecies = ineutral_species[i];
+            jac.ln_g_x.row(ispecies) = (sigman_I * I_x).matrix().transpose();
+            wm[ispecies] = 1.0;
+            wmsum += double(m[ispecies]);
+        }
+
+        // The derivatives of the ln activity of water
+        jac.ln_a_x.row(iwater) = (-wm/xwval - Mw*wI*I_x).matrix().transpose();
+        jac.ln_a_x(iwater, iwater) += Mw*wmsum/xwval;
+
+        // The derivatives of the ln activities of the solutes and the ln activity coefficient of water
+        mixtureptr->completeActivityDerivatives(x, jac);
     };
 
     return fn;
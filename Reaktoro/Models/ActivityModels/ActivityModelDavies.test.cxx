@@ -23,6 +23,8 @@
 #include <Reaktoro/Water/WaterConstants.hpp>
 using namespace Reaktoro;
 
+namespace test { extern auto checkActivityJacobian(ActivityModel const& fn, real const& T, real const& P, ArrayXrConstRef x, bool checkTP) -> void; }
+
 #define PRINT_INFO_IF_FAILS(x) INFO(#x " = \n" << std::scientific << std::setprecision(16) << x)
 
 namespace {
@@ -130,4 +132,9 @@ TEST_CASE("Testing ActivityModelDavies", "[ActivityModelDavies]")
 
         checkActivities(x, props);
     }
+
+    SECTION("Checking the analytic derivatives of the activities")
+    {
+        test::checkActivityJacobian(ActivityModelDavies()(species), T, P, x, false);
+    }
 }
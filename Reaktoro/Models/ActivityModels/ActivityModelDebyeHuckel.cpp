@@ -326,8 +326,14 @@ auto activityModelDebyeHuckel(const SpeciesList& species, ActivityModelDebyeHuck
         bneutral.push_back(params.bneutral(species.formula()));
     }
 
+    // The number of species in the aqueous mixture
+    const auto num_species = species.size();
+
+    // The matrix that maps the molalities of all species into the stoichiometric molalities of the charged species
+    const MatrixXd S = mixture.stoichiometricMolalitiesMatrix();
+
     // Shared pointers used in `props.extra` to avoid heap memory allocation for big objects
-    auto stateptr = std::make_shared<AqueousMixtureState>();
+    AqueousMixtureStatePtr stateptr;
     auto mixtureptr = std::make_shared<AqueousMixture>(mixture);
 
     // Define the activity model function of the aqueous mixture
@@ -343,7 +349,7 @@ auto activityModelDebyeHuckel(const SpeciesList& species, ActivityModelDebyeHuck
         props.som = StateOfMatter::Liquid;
 
         // Export the aqueous mixture and its state via the `extra` data member
-        props.extra["AqueousMixtureState"] = stateptr;
+        props.extra["AqueousMixtureState"] = stateptr.shared();
         props.extra["AqueousMixture"] = mixtureptr;
 
         // Auxiliary constant references
@@ -420,6 +426,72 @@ auto activityModelDebyeHuckel(const SpeciesList& species, ActivityModelDebyeHuck
             // Calculate the ln activity coefficient of the current neutral species
             ln_a[ispecies] = ln_g[ispecies] + ln_m[ispecies];
         }
+
+        // Compute the analytic derivatives with respect to mole fractions if these have been requested
+        if(props.jacobian == nullptr)
+            return;
+
+        auto& jac = *props.jacobian;
+        jac.initialize(num_species);
+
+        const auto xwval = double(xw);
+        const auto Ival = double(I);
+        const auto sqrtIval = double(sqrtI);
+        const auto Aval = double(A);
+        const auto Bval = double(B);
+
+        // The derivatives of the stoichiometric ionic strength with respect to mole fractions
+        const ArrayXd I_x = mixtureptr->stoichiometricIonicStrengthDerivatives(x);
+
+        // The ln activity coefficients of the charged species and the sum of their products with stoichiometric molalities
+        VectorXd ln_gc(num_charged_species);
+        auto ln_gc_ms = 0.0;
+
+        // The coefficient of the derivatives of the ionic strength in the derivatives of the ln activity of water
+        auto wI = 0.0;
+
+        for(Index i = 0; i < num_charged_species; ++i)
+        {
+            const auto ispecies = icharged_species[i];
+            const auto z = charges[i];
+            const auto ai = double(aions[i]);
+            const auto bi = double(bions[i]);
+            const auto msi = double(ms[i]);
+            const auto Lambda = 1.0 + ai*Bval*sqrtIval;
+
+            // The derivative of the ln activity coefficient of the charged species with respect to the ionic strength
+            const auto ln_g_I = ln10 * (-0.5*Aval*z*z/(sqrtIval*Lambda*Lambda) + bi);
+
+            // The sigma parameter of the current ion and its derivative with respect to the ionic strength multiplied by (2/3)*A*I*sqrt(I)
+            auto sigma = 2.0;
+            auto sigmacoeff_sigma_I = 0.0;
+            if(ai != 0.0)
+            {
+                const auto u = Lambda - 1;
+                sigma = 3.0*pow(u, -3) * (u*(u - 2) + 2*std::log(Lambda));
+                sigmacoeff_sigma_I = Aval*Ival*ai*Bval/3.0 * (-3*sigma/u + 6/(u*Lambda));
+            }
+
+            ln_gc[i] = double(ln_g[ispecies]);
+            ln_gc_ms += ln_gc[i] * msi;
+
+            jac.ln_g_x.row(ispecies) = (ln_g_I * I_x).matrix().transpose();
+
+            wI += msi*ln_g_I + ln10*(Aval*sqrtIval*sigma + sigmacoeff_sigma_I) - 2*Ival*bi/(z*z)*ln10;
+        }
+
+        for(Index i = 0; i < num_neutral_species; ++i)
+        {
+            const auto ispecies = ineutral_species[i];
+            jac.ln_g_x.row(ispecies) = (ln10 * double(bneutral[i]) * I_x).matrix().transpose();
+        }
+
+        // The derivatives of the ln activity of water
+        jac.ln_a_x.row(iwater) = -(S.transpose() * ln_gc).transpose()/xwval - Mw*wI*I_x.matrix().transpose();
+        jac.ln_a_x(iwater, iwater) += 1.0/(xwval*xwval) + Mw*ln_gc_ms/xwval;
+
+        // The derivatives of the ln activities of the solutes and the ln activity coefficient of water
+        mixtureptr->completeActivityDerivatives(x, jac);
     };
 
     return fn;
@@ -23,6 +23,8 @@
 #include <Reaktoro/Water/WaterConstants.hpp>
 using namespace Reaktoro;
 
+namespace test { extern auto checkActivityJacobian(ActivityModel const& fn, real const& T, real const& P, ArrayXrConstRef x, bool checkTP) -> void; }
+
 TEST_CASE("Testing ActivityModelDebyeHuckelParams", "[ActivityModelDebyeHuckel]")
 {
     ActivityModelDebyeHuckelParams params;
@@ -405,4 +407,11 @@ TEST_CASE("Testing ActivityModelDebyeHuckel", "[ActivityModelDebyeHuckel]")
 
         checkActivities(x, props);
     }
+
+    SECTION("Checking the analytic derivatives of the activities")
+    {
+        test::checkActivityJacobian(ActivityModelDebyeHuckel()(species), T, P, x, false);
+        test::checkActivityJacobian(ActivityModelDebyeHuckelWATEQ4F()(species), T, P, x, false);
+        test::checkActivityJacobian(ActivityModelDebyeHuckelLimitingLaw()(species), T, P, x, false);
+    }
 }
@@ -147,7 +147,7 @@ auto createActivityModelExtendedUNIQUAC(SpeciesList const& species, ActivityMode
     ArrayXr xq;
 
     // Shared pointers used in `props.extra` to avoid heap memory allocation for big objects
-    auto aqstateptr = std::make_shared<AqueousMixtureState>();
+    AqueousMixtureStatePtr aqstateptr;
     auto aqsolutionptr = std::make_shared<AqueousMixture>(solution);
 
     ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args) mutable
@@ -174,7 +174,7 @@ auto createActivityModelExtendedUNIQUAC(SpeciesList const& species, ActivityMode
         props.som = StateOfMatter::Liquid;
 
         // Export the aqueous solution and its state via the `extra` data member
-        props.extra["AqueousMixtureState"] = aqstateptr;
+        props.extra["AqueousMixtureState"] = aqstateptr.shared();
         props.extra["AqueousMixture"] = aqsolutionptr;
 
         // The mole fraction of water and its natural log
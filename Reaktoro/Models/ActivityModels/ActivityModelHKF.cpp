@@ -333,8 +333,11 @@ auto activityModelHKF(const SpeciesList& species) -> ActivityModel
         charges.push_back(species.charge());
     }
 
+    // The matrix that maps the molalities of all species into the stoichiometric molalities of the charged species
+    const MatrixXd S = mixture.stoichiometricMolalitiesMatrix();
+
     // Shared pointers used in `props.extra` to avoid heap memory allocation for big objects
-    auto stateptr = std::make_shared<AqueousMixtureState>();
+    AqueousMixtureStatePtr stateptr;
     auto mixtureptr = std::make_shared<AqueousMixture>(mixture);
 
     // Define the activity model function of the aqueous phase
@@ -350,7 +353,7 @@ auto activityModelHKF(const SpeciesList& species) -> ActivityModel
         props.som = StateOfMatter::Liquid;
 
         // Export the aqueous mixture and its state via the `extra` data member
-        props.extra["AqueousMixtureState"] = stateptr;
+        props.extra["AqueousMixtureState"] = stateptr.shared();
         props.extra["AqueousMixture"] = mixtureptr;
 
         // Auxiliary references to state variables
@@ -458,6 +461,80 @@ auto activityModelHKF(const SpeciesList& species) -> ActivityModel
 
         // Set the activity coefficient of water (mole fraction scale)
         props.ln_g[iwater] = props.ln_a[iwater] - ln_xw;
+
+        // Compute the analytic derivatives with respect to mole fractions if these have been requested
+        if(props.jacobian == nullptr)
+            return;
+
+        auto& jac = *props.jacobian;
+        jac.initialize(num_species);
+
+        const auto xwval = double(xw);
+        const auto Ival = double(I);
+        const auto sqrtIval = double(sqrtI);
+        const auto Aval = double(A);
+        const auto Bval = double(B);
+        const auto bNaClval = double(bNaCl);
+        const auto bNapClmval = double(bNapClm);
+
+        // The derivatives of the stoichiometric ionic strength with respect to mole fractions
+        const ArrayXd I_x = mixtureptr->stoichiometricIonicStrengthDerivatives(x);
+
+        // The psi contributions of the charged species and the coefficient of the derivatives of the ionic strength in the derivatives of phi
+        VectorXd psis = zeros(num_charged_species);
+        auto phiI = 0.0;
+
+        // The sum of the stoichiometric molalities of the charged species contributing to phi
+        auto mssum = 0.0;
+
+        for(Index i = 0; i < num_charged_species; ++i)
+        {
+            const auto ispecies = icharged_species[i];
+            const auto msi = double(ms[i]);
+
+            if(msi == 0.0)
+                continue;
+
+            const auto z = charges[i];
+            const auto z2 = z*z;
+            const auto eff_radius = double(effective_radii[i]);
+            const auto omega = eta*z2/eff_radius - z*omegaH;
+            const auto omega_abs = eta*z2/eff_radius;
+            const auto a = (z < 0) ?
+                2.0*(eff_radius + 1.91*abs(z))/(abs(z) + 1.0) :
+                2.0*(eff_radius + 1.81*abs(z))/(abs(z) + 1.0);
+            const auto lambda = 1.0 + a*Bval*sqrtIval;
+
+            // The derivatives of the ln activity coefficient of the charged species
+            const auto log10_gi_I = -0.5*Aval*z2/(sqrtIval*lambda*lambda) + (omega_abs*bNaClval + bNapClmval - 0.19*(abs(z) - 1.0));
+            jac.ln_g_x.row(ispecies) = (ln10 * log10_gi_I * I_x).matrix().transpose();
+            jac.ln_g_x(ispecies, iwater) += 1.0/xwval;
+
+            if(xwval != 1.0)
+            {
+                const auto u = lambda - 1.0;
+                const auto sigma = 3.0/pow(u, 3) * (lambda - 1.0/lambda - 2.0*log(lambda));
+                const auto cpsi = omega*bNaClval + bNapClmval - 0.19*(abs(z) - 1.0);
+                psis[i] = Aval*z2*sqrtIval*sigma/3.0 + double(alpha) - 0.5*cpsi*Ival;
+                phiI += msi * (0.5*Aval*z2/sqrtIval*(1.0/(lambda*lambda) - 2.0*sigma/3.0) - 0.5*cpsi);
+                mssum += msi;
+            }
+        }
+
+        for(Index i = 0; i < num_neutral_species; ++i)
+            jac.ln_g_x.row(ineutral_species[i]) = (ln10 * 0.1 * I_x).matrix().transpose();
+
+        // The derivatives of the ln activity of water
+        if(xwval != 1.0)
+        {
+            const auto alpha_xw = double(log10_xw)/((1.0 - xwval)*(1.0 - xwval)) + 1.0/((1.0 - xwval)*ln10);
+            jac.ln_a_x.row(iwater) = ln10 * ((S.transpose() * psis).transpose()/xwval + Mw*phiI*I_x.matrix().transpose());
+            jac.ln_a_x(iwater, iwater) += ln10 * Mw * (mssum*alpha_xw - double(phi)/xwval);
+        }
+        else jac.ln_a_x(iwater, iwater) = 1.0/xwval;
+
+        // The derivatives of the ln activities of the solutes and the ln activity coefficient of water
+        mixtureptr->completeActivityDerivatives(x, jac);
     };
 
     return fn;
@@ -23,6 +23,8 @@
 #include <Reaktoro/Water/WaterConstants.hpp>
 using namespace Reaktoro;
 
+namespace test { extern auto checkActivityJacobian(ActivityModel const& fn, real const& T, real const& P, ArrayXrConstRef x, bool checkTP) -> void; }
+
 namespace {
 
 /// Return mole fractions for the species.
@@ -90,4 +92,7 @@ TEST_CASE("Testing ActivityModelHKF", "[ActivityModelHKF]")
     CHECK( exp(props.ln_g[11]) == Approx(1.2735100000) ); // NaOH
 
     checkActivities(x, props);
+
+    // Check the analytic derivatives of the activities
+    test::checkActivityJacobian(fn, T, P, x, false);
 }
@@ -44,6 +44,21 @@ auto ActivityModelIdealGas() -> ActivityModelGenerator
             props.VxT =  props.Vx/T;
             props.VxP = -props.Vx/P;
             props.ln_a = x.log() + log(Pbar);
+
+            // Compute the analytic derivatives if these have been requested
+            if(props.jacobian == nullptr)
+                return;
+
+            auto& jac = *props.jacobian;
+            const auto N = x.size();
+            jac.initialize(N);
+            for(Index i = 0; i < N; ++i)
+                jac.ln_a_x(i, i) = 1.0/double(x[i]);
+            jac.ln_g_T.setZero(N);
+            jac.ln_g_P.setZero(N);
+            jac.ln_a_T.setZero(N);
+            jac.ln_a_P.setConstant(N, 1.0/double(P));
+            jac.available = true;
         };
 
         return fn;
@@ -0,0 +1,61 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Models/ActivityModels/ActivityModelIdealGas.hpp>
+using namespace Reaktoro;
+
+namespace test { extern auto checkActivityJacobian(ActivityModel const& fn, real const& T, real const& P, ArrayXrConstRef x, bool checkTP) -> void; }
+
+TEST_CASE("Testing ActivityModelIdealGas", "[ActivityModelIdealGas]")
+{
+    const auto species = SpeciesList("CO2 H2O CH4");
+
+    const auto T = 300.0;
+    const auto P = 12.3e5;
+
+    const ArrayXr x = ArrayXr{{0.90, 0.08, 0.02}};
+
+    // Construct the activity props function with the given species.
+    ActivityModel fn = ActivityModelIdealGas()(species);
+
+    // Create the ActivityProps object with the results.
+    ActivityProps props = ActivityProps::create(species.size());
+
+    SECTION("Checking the activities of the gases")
+    {
+        fn(props, {T, P, x});
+
+        CHECK( props.som == StateOfMatter::Gas );
+
+        for(auto i = 0; i < x.size(); ++i)
+        {
+            INFO("i = " << i);
+            CHECK( props.ln_g[i] == 0.0 );
+            CHECK( exp(props.ln_a[i]) == Approx(x[i] * P * 1e-5) ); // the partial pressures of the gases (in bar)
+        }
+    }
+
+    SECTION("Checking the analytic derivatives of the activities")
+    {
+        test::checkActivityJacobian(fn, T, P, x, true);
+        test::checkActivityJacobian(fn, 25.0 + 273.15, 1.0 * 1e5, x, true);
+    }
+}
@@ -94,7 +94,7 @@ auto createActivityModelPhreeqc(SpeciesList const& species, PhreeqcDatabase cons
     }
 
     // Shared pointers used in `props.extra` to avoid heap memory allocation for big objects
-    auto aqstateptr = std::make_shared<AqueousMixtureState>();
+    AqueousMixtureStatePtr aqstateptr;
     auto aqsolutionptr = std::make_shared<AqueousMixture>(solution);
 
     ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args) mutable
@@ -112,7 +112,7 @@ auto createActivityModelPhreeqc(SpeciesList const& species, PhreeqcDatabase cons
         props.som = StateOfMatter::Liquid;
 
         // Export the aqueous solution and its state via the `extra` data member
-        props.extra["AqueousMixtureState"] = aqstateptr;
+        props.extra["AqueousMixtureState"] = aqstateptr.shared();
         props.extra["AqueousMixture"] = aqsolutionptr;
 
         // Calculates gammas and [moles * d(ln gamma)/d mu] for all aqueous species.
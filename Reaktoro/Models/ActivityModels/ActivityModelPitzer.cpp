@@ -1002,7 +1002,7 @@ auto createActivityModelPitzer(SpeciesList const& species, ActivityModelParamsPi
     PitzerState pzstate;
 
     // Shared pointers used in `props.extra` to avoid heap memory allocation for big objects
-    auto aqstateptr = std::make_shared<AqueousMixtureState>();
+    AqueousMixtureStatePtr aqstateptr;
     auto aqsolutionptr = std::make_shared<AqueousMixture>(solution);
 
     ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args) mutable
@@ -1017,7 +1017,7 @@ auto createActivityModelPitzer(SpeciesList const& species, ActivityModelParamsPi
         props.som = StateOfMatter::Liquid;
 
         // Export the aqueous solution and its state via the `extra` data member
-        props.extra["AqueousMixtureState"] = aqstateptr;
+        props.extra["AqueousMixtureState"] = aqstateptr.shared();
         props.extra["AqueousMixture"] = aqsolutionptr;
 
         // Evaluate the Pitzer activity model with given aqueous state
@@ -1391,7 +1391,7 @@ auto activityModelPitzerHMW(const SpeciesList& species) -> ActivityModel
     PitzerParams pitzer(mixture);
 
     // Shared pointers used in `props.extra` to avoid heap memory allocation for big objects
-    auto stateptr = std::make_shared<AqueousMixtureState>();
+    AqueousMixtureStatePtr stateptr;
     auto mixtureptr = std::make_shared<AqueousMixture>(mixture);
 
     ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args) mutable
@@ -1406,7 +1406,7 @@ auto activityModelPitzerHMW(const SpeciesList& species) -> ActivityModel
         props.som = StateOfMatter::Liquid;
 
         // Export the aqueous mixture and its state via the `extra` data member
-        props.extra["AqueousMixtureState"] = stateptr;
+        props.extra["AqueousMixtureState"] = stateptr.shared();
         props.extra["AqueousMixture"] = mixtureptr;
 
         // Calculate the activity coefficients of the cations
@@ -22,6 +22,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Core/ActivityProps.hpp>
 #include <Reaktoro/Singletons/DissociationReactions.hpp>
 #include <Reaktoro/Water/WaterElectroProps.hpp>
 #include <Reaktoro/Water/WaterElectroPropsJohnsonNorton.hpp>
@@ -87,6 +88,12 @@ struct AqueousMixture::Impl
     /// The matrix that represents the dissociation of the aqueous complexes into ions.
     MatrixXd dissociation_matrix;
 
+    /// The matrix that maps the molalities of all species into the stoichiometric molalities of the charged species.
+    MatrixXd stoichiometric_molalities_matrix;
+
+    /// The coefficients of the molalities of all species in the stoichiometric ionic strength.
+    ArrayXd stoichiometric_ionic_strength_coeffs;
+
     /// The density function for water.
     Fn<real(real,real)> rho;
 
@@ -110,6 +117,9 @@ struct AqueousMixture::Impl
         // Initialize the dissociation matrix of the neutral species w.r.t. the charged species
         initializeDissociationMatrix();
 
+        // Initialize the matrix that maps molalities of all species into stoichiometric molalities of the charged species
+        initializeStoichiometricMolalitiesMatrix();
+
         // Initialize the density function for water
         rho = detail::defaultWaterDensityFn();
 
@@ -181,6 +191,53 @@ struct AqueousMixture::Impl
                 dissociation_matrix(i, j) = stoichiometry(i, j);
     }
 
+    /// Initialize the matrix that maps molalities of all species into stoichiometric molalities of the charged species.
+    auto initializeStoichiometricMolalitiesMatrix() -> void
+    {
+        const auto num_species = species.size();
+        const auto num_charged_species = idx_charged_species.size();
+        const auto num_neutral_species = idx_neutral_species.size();
+        stoichiometric_molalities_matrix = zeros(num_charged_species, num_species);
+        for(auto i = 0; i < num_charged_species; ++i)
+            stoichiometric_molalities_matrix(i, idx_charged_species[i]) = 1.0;
+        for(auto j = 0; j < num_neutral_species; ++j)
+            stoichiometric_molalities_matrix.col(idx_neutral_species[j]) = dissociation_matrix.row(j).transpose();
+        const ArrayXd zc = z(idx_charged_species);
+        stoichiometric_ionic_strength_coeffs = 0.5 * (stoichiometric_molalities_matrix.transpose() * (zc * zc).matrix()).array();
+    }
+
+    /// Return the derivatives of the stoichiometric ionic strength with respect to the mole fractions of the species.
+    auto stoichiometricIonicStrengthDerivatives(ArrayXrConstRef x) const -> ArrayXd
+    {
+        // The stoichiometric ionic strength is Is = c·m with m = x/(Mw*xw), where c[iwater] = 0
+        const auto xw = double(x[idx_water]);
+        const auto Mw = double(water.molarMass());
+        ArrayXd Is_x = stoichiometric_ionic_strength_coeffs/(Mw*xw);
+        Is_x[idx_water] -= (Is_x * x.cast<double>()).sum()/xw;
+        return Is_x;
+    }
+
+    /// Complete the derivatives of the ln activities and ln activity coefficients of the species with respect to their mole fractions.
+    auto completeActivityDerivatives(ArrayXrConstRef x, ActivityJacobian& jac) const -> void
+    {
+        const auto xw = double(x[idx_water]);
+
+        // The derivatives of the ln activities of the solutes, with ln(m[i]) = ln(x[i]) - ln(x[iwater]) - ln(Mw)
+        for(auto i = 0; i < species.size(); ++i)
+        {
+            if(i == idx_water) continue;
+            jac.ln_a_x.row(i) = jac.ln_g_x.row(i);
+            jac.ln_a_x(i, i) += 1.0/double(x[i]);
+            jac.ln_a_x(i, idx_water) -= 1.0/xw;
+        }
+
+        // The derivatives of the ln activity coefficient of water, with ln(g[iwater]) = ln(a[iwater]) - ln(x[iwater])
+        jac.ln_g_x.row(idx_water) = jac.ln_a_x.row(idx_water);
+        jac.ln_g_x(idx_water, idx_water) -= 1.0/xw;
+
+        jac.available = true;
+    }
+
     /// Return the molalities of the aqueous species with given mole fractions.
     auto molalities(ArrayXrConstRef x) const -> ArrayXr
     {
@@ -334,6 +391,21 @@ auto AqueousMixture::charges() const -> ArrayXdConstRef
     return pimpl->z;
 }
 
+auto AqueousMixture::stoichiometricMolalitiesMatrix() const -> MatrixXdConstRef
+{
+    return pimpl->stoichiometric_molalities_matrix;
+}
+
+auto AqueousMixture::stoichiometricIonicStrengthDerivatives(ArrayXrConstRef x) const -> ArrayXd
+{
+    return pimpl->stoichiometricIonicStrengthDerivatives(x);
+}
+
+auto AqueousMixture::completeActivityDerivatives(ArrayXrConstRef x, ActivityJacobian& jac) const -> void
+{
+    pimpl->completeActivityDerivatives(x, jac);
+}
+
 auto AqueousMixture::state(real T, real P, ArrayXrConstRef x) const -> AqueousMixtureState
 {
     return pimpl->state(T, P, x);
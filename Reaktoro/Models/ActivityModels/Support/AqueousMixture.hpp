@@ -24,6 +24,9 @@
 
 namespace Reaktoro {
 
+// Forward declarations
+struct ActivityJacobian;
+
 /// A type used to describe the state of an aqueous mixture.
 /// @see AqueousMixture
 struct AqueousMixtureState
@@ -53,6 +56,41 @@ struct AqueousMixtureState
     ArrayXr ms;
 };
 
+/// A shared pointer to an AqueousMixtureState object that is deep-copied when copied.
+/// An activity model captures this pointer by value and writes the state of
+/// the aqueous mixture into it in every evaluation, without heap allocation,
+/// before sharing it with other activity models via `props.extra`. A copy of
+/// the activity model (e.g., in a cloned chemical system used in another
+/// thread) then writes into its own state object.
+class AqueousMixtureStatePtr
+{
+public:
+    /// Construct an AqueousMixtureStatePtr object pointing to a new AqueousMixtureState object.
+    AqueousMixtureStatePtr()
+    : ptr(std::make_shared<AqueousMixtureState>()) {}
+
+    /// Construct a copy of an AqueousMixtureStatePtr object pointing to a copy of its AqueousMixtureState object.
+    AqueousMixtureStatePtr(AqueousMixtureStatePtr const& other)
+    : ptr(std::make_shared<AqueousMixtureState>(*other.ptr)) {}
+
+    /// Assign a copy of an AqueousMixtureStatePtr object to this, pointing to a copy of its AqueousMixtureState object.
+    auto operator=(AqueousMixtureStatePtr const& other) -> AqueousMixtureStatePtr&
+    {
+        ptr = std::make_shared<AqueousMixtureState>(*other.ptr);
+        return *this;
+    }
+
+    /// Return the AqueousMixtureState object.
+    auto operator*() const -> AqueousMixtureState& { return *ptr; }
+
+    /// Return the shared pointer to the AqueousMixtureState object (e.g., to be stored in `props.extra`).
+    auto shared() const -> SharedPtr<AqueousMixtureState> const& { return ptr; }
+
+private:
+    /// The shared pointer to the AqueousMixtureState object.
+    SharedPtr<AqueousMixtureState> ptr;
+};
+
 /// A type used to describe an aqueous mixture.
 /// The AqueousMixture class is defined as a collection of Species objects,
 /// representing, therefore, a mixture of aqueous species. Its main purpose is to
@@ -127,6 +165,28 @@ public:
     /// stoichiometric ionic strength of the mixture.
     auto dissociationMatrix() const -> MatrixXdConstRef;
 
+    /// Return the matrix that maps the molalities of all species into the stoichiometric molalities of the charged species.
+    /// The stoichiometric molalities of the charged species are given by
+    /// \eq{m^{s}=Sm}, where \eq{S} is the matrix returned by this method. This
+    /// is useful for computing derivatives of the stoichiometric molalities
+    /// and the stoichiometric ionic strength of the mixture.
+    auto stoichiometricMolalitiesMatrix() const -> MatrixXdConstRef;
+
+    /// Return the derivatives of the stoichiometric ionic strength of the mixture with respect to the mole fractions of the species.
+    /// @param x The mole fractions of the species in the mixture
+    auto stoichiometricIonicStrengthDerivatives(ArrayXrConstRef x) const -> ArrayXd;
+
+    /// Complete the derivatives of the ln activities and ln activity coefficients of the species with respect to their mole fractions.
+    /// Activity models of the mixture set the rows of the solutes in
+    /// `jac.ln_g_x` and the row of water in `jac.ln_a_x` before calling this
+    /// method, which then sets the rows of the solutes in `jac.ln_a_x` using
+    /// \eq{\ln m_i=\ln x_i-\ln x_w-\ln M_w}, sets the row of water in
+    /// `jac.ln_g_x` using \eq{\ln\gamma_w=\ln a_w-\ln x_w}, and marks the
+    /// derivatives as available.
+    /// @param x The mole fractions of the species in the mixture
+    /// @param jac The derivatives of the ln activities and ln activity coefficients of the species
+    auto completeActivityDerivatives(ArrayXrConstRef x, ActivityJacobian& jac) const -> void;
+
     /// Calculate the state of the aqueous mixture.
     /// @param T The temperature (in K)
     /// @param P The pressure (in Pa)
@@ -360,6 +360,16 @@ struct Equation::Impl
     ArrayXr bbar;
     Bip bip;
 
+    // The state of the last computation needed for the analytic derivatives of the ln fugacity coefficients
+
+    bool computed = false; ///< The flag indicating whether the last computation was successful.
+    double lastT = {};     ///< The temperature in the last computation (in K).
+    double lastP = {};     ///< The pressure in the last computation (in Pa).
+    double lastV = {};     ///< The molar volume of the phase in the last computation (in m3/mol).
+    ArrayXd lastx;         ///< The mole fractions of the species in the last computation.
+    MatrixXd aij;          ///< The symmetric attractive parameters @eq{a_{ij}} in the last computation.
+    MatrixXd aijT;         ///< The first-order temperature derivative of @eq{a_{ij}} in the last computation.
+
     /// Construct an Equation::Impl object.
     Impl(EquationSpecs const& eqspecs)
     : eqspecs(eqspecs),
@@ -384,10 +394,14 @@ struct Equation::Impl
         bip.k   = zeros(nspecies, nspecies);
         bip.kT  = zeros(nspecies, nspecies);
         bip.kTT = zeros(nspecies, nspecies);
+        aij     = zeros(nspecies, nspecies);
+        aijT    = zeros(nspecies, nspecies);
     }
 
     auto compute(Props& props, real const& T, real const& P, ArrayXrConstRef const& x) -> void
     {
+        computed = false;
+
         // Check if the mole fractions are zero or non-initialized
         if(x.size() == 0 || x.maxCoeff() <= 0.0)
             return;
@@ -447,6 +461,9 @@ struct Equation::Impl
 
                 abar[i]  += 2 * x[j] * aij;  // see Eq. (13.94)
                 abarT[i] += 2 * x[j] * aijT;
+
+                this->aij(i, j)  = double(aij);
+                this->aijT(i, j) = double(aijT);
             }
         }
 
@@ -585,6 +602,90 @@ struct Equation::Impl
             props.Vi[k] = R * T * Zk / P;
             props.ln_phi[k] = Zk - (Zk - betak)/(Z - beta) - log(Z - beta) + q*I - qk*I - q*Ik;
         }
+
+        // Store the state needed for the analytic derivatives of the ln fugacity coefficients
+        aij  = 0.5 * (aij + aij.transpose()).eval();
+        aijT = 0.5 * (aijT + aijT.transpose()).eval();
+        lastT = double(T);
+        lastP = double(P);
+        lastV = double(V);
+        lastx.resize(nspecies);
+        for(auto i = 0; i < nspecies; ++i)
+            lastx[i] = double(x[i]);
+        computed = true;
+    }
+
+    auto computeLnPhiDerivatives(MatrixXdRef ln_phi_x, ArrayXdRef ln_phi_T, ArrayXdRef ln_phi_P) const -> bool
+    {
+        if(!computed)
+            return false;
+
+        // The derivatives below follow from the reduced residual Helmholtz energy function
+        // F(T, V, n) = -n*g(V, B) - D(T)/T*f(V, B) of Michelsen and Mollerup (2007), chapter 3,
+        // with B = sum(n[i]*b[i]) and D = sum(n[i]*n[j]*a[i][j]), evaluated here at n = x.
+
+        const auto sigma   = double(eqspecs.eqmodel.sigma);
+        const auto epsilon = double(eqspecs.eqmodel.epsilon);
+
+        const auto T = lastT;
+        const auto P = lastP;
+        const auto V = lastV;
+        const auto& x = lastx;
+        const auto RT = R*T;
+
+        ArrayXd b(nspecies);
+        for(auto i = 0; i < nspecies; ++i)
+            b[i] = double(bbar[i]);
+
+        const ArrayXd Di = 2.0 * (aij * x.matrix()).array();
+        const ArrayXd DiT = 2.0 * (aijT * x.matrix()).array();
+        const auto D = 0.5 * (x * Di).sum();
+        const auto DT = 0.5 * (x * DiT).sum();
+        const auto B = (x * b).sum();
+
+        // The function g = ln(1 - B/V) and its derivatives
+        const auto VB = V - B;
+        const auto gV  =  B/(V*VB);
+        const auto gB  = -1.0/VB;
+        const auto gBB = -1.0/(VB*VB);
+        const auto gBV =  1.0/(VB*VB);
+        const auto gVV = -1.0/(VB*VB) + 1.0/(V*V);
+
+        // The function f = ln((V + sigma*B)/(V + epsilon*B))/(R*B*(sigma - epsilon)) and its derivatives
+        const auto V1 = V + sigma*B;
+        const auto V2 = V + epsilon*B;
+        const auto f   = (sigma != epsilon) ? log(V1/V2)/(R*B*(sigma - epsilon)) : 1.0/(R*V1);
+        const auto fV  = -1.0/(R*V1*V2);
+        const auto fVV = (V1 + V2)/(R*V1*V1*V2*V2);
+        const auto fB  = -(f + V*fV)/B;
+        const auto fBV = -(2*fV + V*fVV)/B;
+        const auto fBB = -(2*fB + V*fBV)/B;
+
+        // The derivatives of F
+        const auto FnB = -gB;
+        const auto FBD = -fB/T;
+        const auto FBB = -gBB - D/T*fBB;
+        const auto FD  = -f/T;
+        const auto FnV = -gV;
+        const auto FBV = -gBV - D/T*fBV;
+        const auto FDV = -fV/T;
+        const auto FVV = -gVV - D/T*fVV;
+
+        // The derivatives of pressure with respect to volume, temperature, and species amounts
+        const auto PV = -RT*(FVV + 1.0/(V*V));
+        const auto PT = P/T + RT*fV*(DT/T - D/(T*T));
+        const ArrayXd Pn = RT*(1.0/V - (FnV + FBV*b + FDV*Di));
+
+        for(auto i = 0; i < nspecies; ++i)
+            for(auto j = 0; j < nspecies; ++j)
+                ln_phi_x(i, j) = FnB*(b[i] + b[j]) + FBD*(b[i]*Di[j] + b[j]*Di[i]) + FBB*b[i]*b[j] + FD*2.0*aij(i, j) + 1.0 + Pn[i]*Pn[j]/(RT*PV);
+
+        const ArrayXd FiT = -fB*b*(DT/T - D/(T*T)) + f*Di/(T*T) - f*DiT/T;
+
+        ln_phi_T = FiT + 1.0/T + PT*Pn/(RT*PV);
+        ln_phi_P = -Pn/(PV*RT) - 1.0/P;
+
+        return true;
     }
 };
 
@@ -616,6 +717,11 @@ auto Equation::compute(Props& props, real const& T, real const& P, ArrayXrConstR
     return pimpl->compute(props, T, P, x);
 }
 
+auto Equation::computeLnPhiDerivatives(MatrixXdRef ln_phi_x, ArrayXdRef ln_phi_T, ArrayXdRef ln_phi_P) const -> bool
+{
+    return pimpl->computeLnPhiDerivatives(ln_phi_x, ln_phi_T, ln_phi_P);
+}
+
 auto BipModelPhreeqc(Strings const& substances, BipModelParamsPhreeqc const& params) -> BipModel
 {
     auto isubstance = [&](auto... substrs)
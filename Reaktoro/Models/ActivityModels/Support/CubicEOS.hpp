@@ -187,6 +187,16 @@ public:
     /// @param x The mole fractions of the species in the phase (in mol/mol)
     auto compute(Props& props, real const& T, real const& P, ArrayXrConstRef const& x) -> void;
 
+    /// Compute the derivatives of the ln fugacity coefficients of the species at the state of the last call to @ref compute.
+    /// The derivatives with respect to mole fractions are computed as if these were
+    /// independent variables (see ActivityJacobian for how to use them). The output
+    /// arguments must have been sized according to the number of species.
+    /// @param[out] ln_phi_x The derivatives with respect to the mole fractions of the species at constant temperature and pressure.
+    /// @param[out] ln_phi_T The derivatives with respect to temperature at constant pressure and mole fractions (in 1/K).
+    /// @param[out] ln_phi_P The derivatives with respect to pressure at constant temperature and mole fractions (in 1/Pa).
+    /// @return False if the last call to @ref compute did not evaluate the phase (e.g., all mole fractions were zero).
+    auto computeLnPhiDerivatives(MatrixXdRef ln_phi_x, ArrayXdRef ln_phi_T, ArrayXdRef ln_phi_P) const -> bool;
+
 private:
     struct Impl;
 
@@ -34,127 +34,140 @@
 namespace Reaktoro {
 namespace detail {
 
-using Catalyst = ReactionRateModelParamsPalandriKharaka::Catalyst;
-using Mechanism = ReactionRateModelParamsPalandriKharaka::Mechanism;
-
-/// Construct a function that computes the activity-based contribution of a catalyst in the mineral reaction rate.
-auto mineralCatalystFnActivity(Catalyst const& catalyst, ReactionRateModelGeneratorArgs args) -> Fn<real(ChemicalProps const&)>
+/// The parameters of the Palandri-Kharaka reaction rate models of a set of minerals stored in flat arrays.
+/// The mechanisms of mineral *i* are those from `mbegin[i]` to `mbegin[i + 1] - 1`,
+/// and the catalysts of mechanism *j* are those from `cbegin[j]` to `cbegin[j + 1] - 1`.
+struct PalandriKharakaTables
 {
-    auto const& formula = catalyst.formula;
-    auto const& power = catalyst.power;
-    auto const& species = args.species;
+    /// The names of the minerals.
+    Strings minerals;
 
-    auto const aqspecies = species.withAggregateState(AggregateState::Aqueous);
-    auto const iaqueousspecies = aqspecies.findWithFormula(formula);
+    /// The indices of the surfaces of the minerals.
+    Indices isurfaces;
 
-    if(aqspecies.size() == 0 || iaqueousspecies >= aqspecies.size())
-    {
-        // warningif(true, "Ignoring Palandri-Kharaka catalytic effect (based on activity) in mineral reaction rate because no aqueous species with formula `", formula, "` exists in the aqueous phase of the system.");
-        return [](ChemicalProps const& props) { return 1.0; };
-    }
+    /// The offsets of the mechanisms of each mineral.
+    Indices mbegin = { 0 };
 
-    auto const name = aqspecies[iaqueousspecies].name();
-    auto const ispecies = species.findWithName(name);
+    /// The natural log of the rate constant of each mechanism at infinite temperature, so that *ln k = lnA - E/(RT)*.
+    Vec<real> lnA;
 
-    auto fn = [=](ChemicalProps const& props)
-    {
-        auto const& ai = props.speciesActivity(ispecies);
-        return pow(ai, power);
-    };
+    /// The Arrhenius activation energy of each mechanism divided by the universal gas constant (in K).
+    Vec<real> EoverR;
 
-    return fn;
-}
+    /// The empirical power parameter *p* of each mechanism.
+    Vec<real> p;
 
-/// Construct a function that computes the partial-pressure-based contribution of a catalyst in the mineral reaction rate.
-auto mineralCatalystFnPartialPressure(Catalyst const& catalyst, ReactionRateModelGeneratorArgs args) -> Fn<real(ChemicalProps const&)>
-{
-    auto const& formula = catalyst.formula;
-    auto const& power = catalyst.power;
-    auto const& species = args.species;
+    /// The empirical power parameter *q* of each mechanism.
+    Vec<real> q;
 
-    auto const gases = species.withAggregateState(AggregateState::Gas);
-    auto const igas = gases.findWithFormula(formula);
+    /// The offsets of the catalysts of each mechanism.
+    Indices cbegin = { 0 };
 
-    if(gases.size() == 0 || igas >= gases.size())
-    {
-        // warningif(true, "Ignoring Palandri-Kharaka catalytic effect (based on partial pressure) in mineral reaction rate because no gaseous species with formula `", formula, "` exists in the gaseous phase of the system.");
-        return [](ChemicalProps const& props) { return 1.0; };
-    }
+    /// The index of the species of each catalyst.
+    Indices ispecies;
+
+    /// The flag indicating whether each catalyst is based on partial pressure rather than activity.
+    Vec<bool> partialpressure;
 
-    auto const name = gases[igas].name();
-    auto const ispecies = species.findWithName(name);
+    /// The power of the property of each catalyst.
+    Vec<real> power;
 
-    auto fn = [=](ChemicalProps const& props)
+    /// Append the parameters of the reaction rate model of a mineral.
+    auto append(ReactionRateModelParamsPalandriKharaka const& params, String const& mineral, SpeciesList const& species, SurfaceList const& surfaces) -> void
     {
-        auto const P  = props.pressure(); // pressure in Pa
-        auto const xi = props.speciesMoleFraction(ispecies);
-        auto const Pi = xi * P * 1e-5; // partial pressure in bar!
-        return pow(Pi, power);
-    };
+        const auto R = universalGasConstant;
+        const auto T0 = 298.15;
 
-    return fn;
-}
+        const auto aqspecies = species.withAggregateState(AggregateState::Aqueous);
+        const auto gases = species.withAggregateState(AggregateState::Gas);
 
-/// Construct a function that computes the contribution of a catalyst in the mineral reaction rate.
-auto mineralCatalystFn(Catalyst const& catalyst, ReactionRateModelGeneratorArgs args) -> Fn<real(ChemicalProps const&)>
-{
-    if(catalyst.property == "a")
-        return mineralCatalystFnActivity(catalyst, args);
-    if(catalyst.property == "P")
-        return mineralCatalystFnPartialPressure(catalyst, args);
-    errorif(true, "Expecting mineral catalyst property symbol to be either `a` or `P`, but got `", catalyst.property, "` instead.");
-}
+        const auto isurface = surfaces.find(mineral);
+        errorif(isurface >= surfaces.size(), "Expecting a surface with name `", mineral, "` for the Palandri-Kharaka reaction rate model of this mineral, but none was found.");
 
-auto mineralMechanismFn(Mechanism const& mechanism, ReactionRateModelGeneratorArgs args) -> Fn<real(ChemicalProps const&)>
-{
-    // The universal gas constant (in J/(mol*K))
-    const auto R = universalGasConstant;
+        minerals.push_back(mineral);
+        isurfaces.push_back(isurface);
 
-    // Create the mineral catalyst functions
-    Vec<Fn<real(ChemicalProps const&)>> catalyst_fns;
-    for(auto&& catalyst : mechanism.catalysts)
-        catalyst_fns.push_back(mineralCatalystFn(catalyst, args));
+        for(auto const& mechanism : params.mechanisms)
+        {
+            const auto E = mechanism.E * 1e3; // from kJ to J
 
-    // The name of the mineral from the name of the reaction
-    const auto mineral = args.name;
+            lnA.push_back(ln10 * mechanism.lgk + E/(R * T0));
+            EoverR.push_back(E/R);
+            p.push_back(mechanism.p);
+            q.push_back(mechanism.q);
 
-    // Define the mineral mechanism function
-    auto fn = [=](ChemicalProps const& props)
-    {
-        const auto& aprops = AqueousProps::compute(props);
+            for(auto const& catalyst : mechanism.catalysts)
+            {
+                errorif(catalyst.property != "a" && catalyst.property != "P", "Expecting mineral catalyst property symbol to be either `a` or `P`, but got `", catalyst.property, "` instead.");
+
+                const auto isgas = catalyst.property == "P";
 
-        const auto& lgk = mechanism.lgk;
-        const auto& E = mechanism.E * 1e3; // from kJ to J
-        const auto& p = mechanism.p;
-        const auto& q = mechanism.q;
+                // Catalysts without a corresponding aqueous species (based on activity) or gaseous species (based on partial pressure) in the system are ignored, as are those with zero power
+                auto const& candidates = isgas ? gases : aqspecies;
+                const auto icandidate = candidates.findWithFormula(catalyst.formula);
+                if(icandidate >= candidates.size() || catalyst.power == 0.0)
+                    continue;
 
+                ispecies.push_back(species.findWithName(candidates[icandidate].name()));
+                partialpressure.push_back(isgas);
+                power.push_back(catalyst.power);
+            }
+
+            cbegin.push_back(ispecies.size());
+        }
+
+        mbegin.push_back(lnA.size());
+    }
+
+    /// Return the rate of the reaction of the *i*-th mineral (in mol/s) and optionally its derivatives.
+    /// @param i The index of the mineral
+    /// @param props The chemical properties of the system
+    /// @param lnOmega The natural log of the saturation ratio of the mineral
+    /// @param[out] drdlna The derivatives of the rate with respect to the natural log of the activities of the catalysts based on activity (if not null)
+    /// @param[out] drdlnOmega The derivative of the rate with respect to the natural log of the saturation ratio of the mineral (if not null)
+    auto rate(Index i, ChemicalProps const& props, real const& lnOmega, MatrixXr::RowXpr* drdlna, real* drdlnOmega) const -> real
+    {
         const auto T = props.temperature();
-        const auto k0 = pow(10, lgk);
-        const auto k = k0 * exp(-E/R * (1.0/T - 1.0/298.15));
+        const auto lnP = log(props.pressure() * 1e-5); // pressure in bar!
+        const auto lna = props.speciesActivitiesLn();
+        const auto x = props.speciesMoleFractions();
+        const auto area = props.surfaceArea(isurfaces[i]);
 
-        const auto Omega  = aprops.saturationRatio(mineral); // TODO: Find a way to determine the index of the mineral once in aprops.saturationSpecies to avoid index search in every call of Palandri-Kharaka model (overhead here should be minimal though compared to other operations).
-        const auto pOmega = p != 1.0 ? pow(Omega, p) : Omega;
-        const auto qOmega = q != 1.0 ? pow(1 - pOmega, q) : 1 - pOmega;
+        real sum = 0.0;
 
-        real g = 1.0;
-        for(auto const& catalystfn : catalyst_fns)
-            g *= catalystfn(props);
+        if(drdlnOmega)
+            *drdlnOmega = 0.0;
 
-        return k * qOmega * g;
-    };
+        for(auto j = mbegin[i]; j < mbegin[i + 1]; ++j)
+        {
+            // The contribution of the catalysts, with ln(g) = sum of power*ln(a) or power*ln(P) of each catalyst
+            real lng = 0.0;
+            for(auto c = cbegin[j]; c < cbegin[j + 1]; ++c)
+                lng += power[c] * (partialpressure[c] ? log(x[ispecies[c]]) + lnP : lna[ispecies[c]]);
 
-    return fn;
-}
+            const auto kg = exp(lnA[j] - EoverR[j]/T + lng);
+            const auto pOmega = exp(p[j] * lnOmega);
+            const auto base = 1 - pOmega;
+            const auto qOmega = q[j] != 1.0 ? pow(base, q[j]) : base;
+            const auto f = kg * qOmega;
 
-} // namespace detail
+            sum += f;
 
-auto ReactionRateModelPalandriKharaka() -> ReactionRateModelGenerator
-{
-    const auto params = Params::embedded("PalandriKharaka.json");
-    return ReactionRateModelPalandriKharaka(params);
-}
+            if(drdlna)
+                for(auto c = cbegin[j]; c < cbegin[j + 1]; ++c)
+                    if(!partialpressure[c])
+                        (*drdlna)[ispecies[c]] += area * power[c] * f;
 
-auto ReactionRateModelPalandriKharaka(Params const& params) -> ReactionRateModelGenerator
+            if(drdlnOmega)
+                *drdlnOmega -= area * kg * (q[j] != 1.0 ? q[j] * pow(base, q[j] - 1) : 1.0) * p[j] * pOmega;
+        }
+
+        return area * sum;
+    }
+};
+
+/// Return the parameters of the minerals in the `PalandriKharaka` section of a Params object.
+auto paramsPalandriKharaka(Params const& params) -> Vec<ReactionRateModelParamsPalandriKharaka>
 {
     auto const& data = params.data();
     errorif(!data.exists("ReactionRateModelParams"), "Expecting Palandri-Kharaka mineral rate parameters in given Params object, but it lacks a `ReactionRateModelParams` section within which another section `PalandriKharaka` should exist.");
@@ -165,26 +178,59 @@ auto ReactionRateModelPalandriKharaka(Params const& params) -> ReactionRateModel
     for(auto const& [key, value] : data["ReactionRateModelParams"]["PalandriKharaka"].asDict())
         paramsvec.push_back(value.as<ReactionRateModelParamsPalandriKharaka>());
 
-    return ReactionRateModelPalandriKharaka(paramsvec);
+    return paramsvec;
+}
+
+/// Return the index of a mineral in the list of non-aqueous species whose saturation indices are computed (see AqueousProps::saturationSpecies).
+auto indexSaturationSpecies(SpeciesList const& saturationspecies, String const& mineral) -> Index
+{
+    const auto isat = saturationspecies.findWithName(mineral);
+    errorif(isat >= saturationspecies.size(), "Could not compute the saturation ratio of mineral `", mineral, "` in the Palandri-Kharaka reaction rate model. "
+        "This species must exist in the thermodynamic database and be composed of chemical elements present in the aqueous phase.");
+    return isat;
+}
+
+/// Return the index of the parameters of a mineral, or the number of parameters if not found.
+auto indexParamsPalandriKharaka(Vec<ReactionRateModelParamsPalandriKharaka> const& paramsvec, String const& mineral) -> Index
+{
+    return indexfn(paramsvec, RKT_LAMBDA(x, x.mineral == mineral || contains(x.othernames, mineral)));
+}
+
+} // namespace detail
+
+auto ReactionRateModelPalandriKharaka() -> ReactionRateModelGenerator
+{
+    const auto params = Params::embedded("PalandriKharaka.json");
+    return ReactionRateModelPalandriKharaka(params);
+}
+
+auto ReactionRateModelPalandriKharaka(Params const& params) -> ReactionRateModelGenerator
+{
+    return ReactionRateModelPalandriKharaka(detail::paramsPalandriKharaka(params));
 }
 
 auto ReactionRateModelPalandriKharaka(ReactionRateModelParamsPalandriKharaka const& params) -> ReactionRateModelGenerator
 {
     ReactionRateModelGenerator model = [=](ReactionRateModelGeneratorArgs args)
     {
-        Vec<Fn<real(ChemicalProps const&)>> mechanism_fns;
-        for(auto const& mechanism : params.mechanisms)
-            mechanism_fns.push_back(detail::mineralMechanismFn(mechanism, args));
+        detail::PalandriKharakaTables tables;
+        tables.append(params, args.name, args.species, args.surfaces);
+
+        // The name of the mineral from the name of the reaction
+        const auto mineral = args.name;
 
-        const auto imineralsurface = args.surfaces.indexWithName(args.name);
+        // The index of the mineral among the saturation species of the aqueous phase, determined from the phases and database of the chemical system
+        const auto iaqueous = args.phases.findWithAggregateState(AggregateState::Aqueous);
+        errorif(iaqueous >= args.phases.size(), "Could not create the Palandri-Kharaka reaction rate model of mineral `", mineral, "` "
+            "because there is no aqueous phase in the chemical system.");
+        const auto isaturation = detail::indexSaturationSpecies(aqueousSaturationSpecies(args.phases[iaqueous], args.database), mineral);
 
         ReactionRateModel fn = [=](ChemicalProps const& props) -> ReactionRate
         {
-            const auto area = props.surfaceArea(imineralsurface);
-            real sum = 0.0;
-            for(auto const& mechanismfn : mechanism_fns)
-                sum += mechanismfn(props);
-            return area * sum;
+            const auto& aprops = AqueousProps::compute(props);
+
+            const auto lnOmega = aprops.saturationIndex(isaturation) * ln10;
+            return tables.rate(0, props, lnOmega, nullptr, nullptr);
         };
 
         return fn;
@@ -198,7 +244,7 @@ auto ReactionRateModelPalandriKharaka(Vec<ReactionRateModelParamsPalandriKharaka
     ReactionRateModelGenerator model = [=](ReactionRateModelGeneratorArgs args) -> ReactionRateModel
     {
         const auto mineral = args.name;
-        const auto idx = indexfn(paramsvec, RKT_LAMBDA(x, x.mineral == mineral || contains(x.othernames, mineral)));
+        const auto idx = detail::indexParamsPalandriKharaka(paramsvec, mineral);
         errorif(idx >= paramsvec.size(), "Could not find a mineral with name `", mineral, "` in the provided set of Palandri-Kharaka parameters.");
         const auto params = paramsvec[idx];
         return ReactionRateModelPalandriKharaka(params)(args);
@@ -207,4 +253,120 @@ auto ReactionRateModelPalandriKharaka(Vec<ReactionRateModelParamsPalandriKharaka
     return model;
 }
 
+//=====================================================================================================================
+//
+// PalandriKharakaRates
+//
+//=====================================================================================================================
+
+struct PalandriKharakaRates::Impl
+{
+    /// The chemical system whose reaction rates are evaluated.
+    ChemicalSystem system;
+
+    /// The parameters of the reaction rate models of the minerals in flat arrays.
+    detail::PalandriKharakaTables tables;
+
+    /// The indices of the reactions of the minerals in the chemical system.
+    Indices ireactions;
+
+    /// The indices of the minerals in the list of saturation species of the aqueous phase (see AqueousProps::saturationSpecies).
+    Indices isaturation;
+
+    Impl(ChemicalSystem const& system, Vec<ReactionRateModelParamsPalandriKharaka> const& paramsvec)
+    : system(system)
+    {
+        auto const& reactions = system.reactions();
+
+        for(auto i = 0; i < reactions.size(); ++i)
+        {
+            const auto mineral = reactions[i].name();
+            const auto idx = detail::indexParamsPalandriKharaka(paramsvec, mineral);
+            if(idx >= paramsvec.size())
+                continue;
+            tables.append(paramsvec[idx], mineral, system.species(), system.surfaces());
+            ireactions.push_back(i);
+        }
+
+        if(ireactions.empty())
+            return;
+
+        const auto saturationspecies = AqueousProps(system).saturationSpecies();
+
+        for(auto const& mineral : tables.minerals)
+            isaturation.push_back(detail::indexSaturationSpecies(saturationspecies, mineral));
+    }
+
+    auto rates(ChemicalProps const& props, MatrixXr* drdlna, ArrayXr* drdlnOmega) const -> ArrayXr
+    {
+        const auto Nr = system.reactions().size();
+        const auto Nn = system.species().size();
+
+        ArrayXr r = ArrayXr::Zero(Nr);
+
+        if(drdlna) drdlna->setZero(Nr, Nn);
+        if(drdlnOmega) drdlnOmega->setZero(Nr);
+
+        if(ireactions.empty())
+            return r;
+
+        const auto& aprops = AqueousProps::compute(props);
+
+        for(auto i = 0; i < ireactions.size(); ++i)
+        {
+            const auto ireaction = ireactions[i];
+            const auto lnOmega = aprops.saturationIndex(isaturation[i]) * ln10;
+
+            if(drdlna)
+            {
+                auto row = drdlna->row(ireaction);
+                r[ireaction] = tables.rate(i, props, lnOmega, &row, &(*drdlnOmega)[ireaction]);
+            }
+            else r[ireaction] = tables.rate(i, props, lnOmega, nullptr, nullptr);
+        }
+
+        return r;
+    }
+};
+
+PalandriKharakaRates::PalandriKharakaRates(ChemicalSystem const& system)
+: PalandriKharakaRates(system, Params::embedded("PalandriKharaka.json"))
+{}
+
+PalandriKharakaRates::PalandriKharakaRates(ChemicalSystem const& system, Params const& params)
+: PalandriKharakaRates(system, detail::paramsPalandriKharaka(params))
+{}
+
+PalandriKharakaRates::PalandriKharakaRates(ChemicalSystem const& system, Vec<ReactionRateModelParamsPalandriKharaka> const& paramsvec)
+: pimpl(new Impl(system, paramsvec))
+{}
+
+PalandriKharakaRates::PalandriKharakaRates(PalandriKharakaRates const& other)
+: pimpl(new Impl(*other.pimpl))
+{}
+
+PalandriKharakaRates::~PalandriKharakaRates()
+{}
+
+auto PalandriKharakaRates::operator=(PalandriKharakaRates other) -> PalandriKharakaRates&
+{
+    pimpl = std::move(other.pimpl);
+    return *this;
+}
+
+auto PalandriKharakaRates::reactions() const -> Indices const&
+{
+    return pimpl->ireactions;
+}
+
+auto PalandriKharakaRates::rates(ChemicalProps const& props) const -> ArrayXr
+{
+    return pimpl->rates(props, nullptr, nullptr);
+}
+
+auto PalandriKharakaRates::rates(ChemicalProps const& props, MatrixXr& drdlna, ArrayXr& drdlnOmega) const -> ArrayXr
+{
+    return pimpl->rates(props, &drdlna, &drdlnOmega);
+}
+
 } // namespace Reaktoro
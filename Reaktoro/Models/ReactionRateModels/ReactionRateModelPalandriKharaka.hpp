@@ -18,12 +18,17 @@
 #pragma once
 
 // Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
 #include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Core/Params.hpp>
 #include <Reaktoro/Core/ReactionRateModel.hpp>
 
 namespace Reaktoro {
 
+// Forward declarations
+class ChemicalProps;
+class ChemicalSystem;
+
 /// The parameters in the reaction rate model of @cite{Palandri2004} for dissolution/precipitation kinetics of minerals.
 struct ReactionRateModelParamsPalandriKharaka
 {
@@ -91,4 +96,67 @@ auto ReactionRateModelPalandriKharaka(ReactionRateModelParamsPalandriKharaka con
 /// Return the reaction rate model of @cite{Palandri2004} for dissolution/precipitation kinetics of minerals.
 auto ReactionRateModelPalandriKharaka(Vec<ReactionRateModelParamsPalandriKharaka> const& paramsvec) -> ReactionRateModelGenerator;
 
+/// Used to evaluate the reaction rates of @cite{Palandri2004} of all mineral reactions in a chemical system at once.
+/// The parameters of the mechanisms and catalysts of all mineral reactions
+/// are stored in flat arrays, with the indices of the catalyst species and
+/// the surfaces of the minerals resolved at construction. The rates are then
+/// evaluated in a single pass over these arrays, together with their analytic
+/// derivatives, if needed. The reactions considered are those of the
+/// chemical system whose names are minerals with given parameters (see
+/// @ref reactions); the rates of the other reactions are zero. This is a
+/// standalone utility for evaluating these rates outside a kinetics
+/// calculation (e.g., for sampling them over many chemical states). It is
+/// not used in the evaluation of the reaction rates in KineticsSolver, which
+/// uses the reaction rate models returned by @ref ReactionRateModelPalandriKharaka.
+/// These evaluate the same flat arrays, but one mineral at a time, since the
+/// rate of each reaction is evaluated separately. The index of the mineral
+/// among the saturation species is resolved in their first evaluation, since
+/// the chemical system is not yet available when they are generated.
+class PalandriKharakaRates
+{
+public:
+    /// Construct a PalandriKharakaRates object with the default parameters in `PalandriKharaka.yaml`.
+    explicit PalandriKharakaRates(ChemicalSystem const& system);
+
+    /// Construct a PalandriKharakaRates object with the parameters in a Params object (see @ref ReactionRateModelPalandriKharaka(Params const&)).
+    PalandriKharakaRates(ChemicalSystem const& system, Params const& params);
+
+    /// Construct a PalandriKharakaRates object with given parameters of the minerals.
+    PalandriKharakaRates(ChemicalSystem const& system, Vec<ReactionRateModelParamsPalandriKharaka> const& paramsvec);
+
+    /// Construct a copy of a PalandriKharakaRates object.
+    PalandriKharakaRates(PalandriKharakaRates const& other);
+
+    /// Destroy this PalandriKharakaRates object.
+    ~PalandriKharakaRates();
+
+    /// Assign a copy of a PalandriKharakaRates object to this.
+    auto operator=(PalandriKharakaRates other) -> PalandriKharakaRates&;
+
+    /// Return the indices of the reactions in the chemical system whose rates are evaluated.
+    auto reactions() const -> Indices const&;
+
+    /// Return the rates of the reactions in the chemical system (in mol/s).
+    /// @param props The chemical properties of the system
+    auto rates(ChemicalProps const& props) const -> ArrayXr;
+
+    /// Return the rates of the reactions in the chemical system (in mol/s) and their derivatives.
+    /// The derivatives with respect to the activities of the species are
+    /// those of the catalysts based on activity, with constant saturation
+    /// ratios. Catalysts based on partial pressure do not contribute to these
+    /// derivatives, since their partial pressures are not activities of the
+    /// species. The saturation ratios depend on the activities of the aqueous
+    /// species through the chemical potentials of the elements, and their
+    /// derivatives are given separately.
+    /// @param props The chemical properties of the system
+    /// @param[out] drdlna The derivatives of the rates with respect to the natural log of the activities of the species
+    /// @param[out] drdlnOmega The derivatives of the rates with respect to the natural log of the saturation ratios of their minerals
+    auto rates(ChemicalProps const& props, MatrixXr& drdlna, ArrayXr& drdlnOmega) const -> ArrayXr;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
 } // namespace Reaktoro
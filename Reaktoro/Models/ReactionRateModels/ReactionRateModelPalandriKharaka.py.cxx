@@ -19,6 +19,8 @@
 #include <Reaktoro/pybind11.hxx>
 
 // Reaktoro includes
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Models/ReactionRateModels/ReactionRateModelPalandriKharaka.hpp>
 using namespace Reaktoro;
 
@@ -52,4 +54,21 @@ void exportReactionRateModelPalandriKharaka(py::module& m)
     m.def("ReactionRateModelPalandriKharaka", py::overload_cast<Params const&>(ReactionRateModelPalandriKharaka));
     m.def("ReactionRateModelPalandriKharaka", py::overload_cast<ReactionRateModelParamsPalandriKharaka const&>(ReactionRateModelPalandriKharaka));
     m.def("ReactionRateModelPalandriKharaka", py::overload_cast<Vec<ReactionRateModelParamsPalandriKharaka> const&>(ReactionRateModelPalandriKharaka));
+
+    auto ratesWithDerivatives = [](PalandriKharakaRates const& self, ChemicalProps const& props)
+    {
+        MatrixXr drdlna;
+        ArrayXr drdlnOmega;
+        ArrayXr r = self.rates(props, drdlna, drdlnOmega);
+        return std::make_tuple(r, drdlna, drdlnOmega);
+    };
+
+    py::class_<PalandriKharakaRates>(m, "PalandriKharakaRates")
+        .def(py::init<ChemicalSystem const&>())
+        .def(py::init<ChemicalSystem const&, Params const&>())
+        .def(py::init<ChemicalSystem const&, Vec<ReactionRateModelParamsPalandriKharaka> const&>())
+        .def("reactions", &PalandriKharakaRates::reactions, return_internal_ref, "Return the indices of the reactions in the chemical system whose rates are evaluated.")
+        .def("rates", py::overload_cast<ChemicalProps const&>(&PalandriKharakaRates::rates, py::const_), "Return the rates of the reactions in the chemical system (in mol/s).")
+        .def("ratesWithDerivatives", ratesWithDerivatives, "Return the rates of the reactions in the chemical system (in mol/s) and their derivatives with respect to the natural log of the activities of the species and of the saturation ratios of their minerals.")
+        ;
 }
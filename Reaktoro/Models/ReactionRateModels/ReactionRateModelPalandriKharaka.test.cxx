@@ -126,4 +126,33 @@ TEST_CASE("Testing ReactionRateModelPalandriKharaka class", "[ReactionRateModelP
     const auto rate_actual = system.reaction(0).rate(props);
 
     CHECK( rate_actual == Approx(rate_expected) );
+
+    //======================================================================
+    // Testing the evaluation of the rates of all reactions at once
+    //======================================================================
+
+    PalandriKharakaRates pkrates(system, Vec<ReactionRateModelParamsPalandriKharaka>{ params });
+
+    CHECK( pkrates.reactions() == Indices{ 0 } );
+    CHECK( pkrates.rates(props)[0] == Approx(rate_expected) );
+
+    MatrixXr drdlna;
+    ArrayXr drdlnOmega;
+
+    const ArrayXr rates = pkrates.rates(props, drdlna, drdlnOmega);
+
+    CHECK( rates[0] == Approx(rate_expected) );
+
+    const auto iH = system.species().index("H+");
+    const auto iCO2 = system.species().index("CO2(g)");
+
+    // The power of the catalyst H+ is one, so the derivative with respect to its ln activity is the contribution of its mechanism
+    CHECK( drdlna(0, iH) == Approx(SA * k_acid * qOmega_acid * g_acid) );
+
+    // The catalyst CO2(g) is based on partial pressure and does not contribute to the derivatives with respect to ln activities
+    CHECK( drdlna(0, iCO2) == 0.0 );
+    CHECK( drdlna.row(0).cwiseAbs().sum() == Approx(abs(drdlna(0, iH))) );
+
+    // The powers p and q are one, so the derivative of (1 - Omega) with respect to ln(Omega) is -Omega
+    CHECK( drdlnOmega[0] == Approx(-SA * Omega * (k_acid * g_acid + k_neutral + k_carbonate * g_carbonate)) );
 }
@@ -19,40 +19,54 @@
 
 // C++ includes
 #include <cassert>
-#include <limits>
+#include <numeric>
 
 namespace Reaktoro {
 
 ClusterConnectivity::ClusterConnectivity()
 {}
 
+auto ClusterConnectivity::withInitialQueues(Deque<Indices> const& clusters, Deque<PriorityQueue> const& queues, PriorityQueue const& queue) -> ClusterConnectivity
+{
+    assert(clusters.size() == queue.size());
+    assert(queues.size() == queue.size());
+    ClusterConnectivity connectivity;
+    for(auto i = 0; i < clusters.size(); ++i)
+    {
+        assert(clusters[i].size() == queues[i].size());
+        Row row;
+        row.clusters = clusters[i];
+        for(auto k = 0; k < row.clusters.size(); ++k)
+            row.slots[row.clusters[k]] = k;
+        row.queue = queues[i];
+        connectivity.rows.push_back(std::move(row));
+    }
+    connectivity.usage = queue;
+    return connectivity;
+}
+
 auto ClusterConnectivity::size() const -> Index
 {
-    return queue.size();
+    return usage.size();
 }
 
 auto ClusterConnectivity::extend() -> void
 {
-    // Extend the priority queue in each row of the connectivity matrix of the clusters
-    for(auto& row : matrix)
-        row.extend();
+    // The index of the new cluster
+    const auto icluster = usage.size();
 
     // Extend the priority queue that keeps track the most used clusters
-    queue.extend();
+    usage.extend();
 
-    // The ordering of the most used clusters that will be used for the new cluster
-    auto const& order = queue.order();
+    // Start the connectivity of the new cluster with itself, so that it is
+    // the first one to be visited when starting from it, followed by the
+    // clusters it is connected to, and then all others by usage count
+    Row row;
+    row.clusters.push_back(icluster);
+    row.slots[icluster] = 0;
+    row.queue.extend();
 
-    // Create priorities for the priority queue of the new cluster
-    Deque<Index> priorities(order.size(), 0);
-
-    // Set the priority of the new cluster (the last one) to infinity,
-    // to ensure it is always the first one to be visited as we
-    // go from cluster to cluster
-    priorities.back() = std::numeric_limits<Index>::infinity();
-
-    // Append the new priority queue for the new cluster
-    matrix.push_back(PriorityQueue::withInitialPrioritiesAndOrder(priorities, order));
+    rows.push_back(std::move(row));
 }
 
 auto ClusterConnectivity::increment(Index icluster, Index jcluster) -> void
@@ -62,15 +76,105 @@ auto ClusterConnectivity::increment(Index icluster, Index jcluster) -> void
 
     // Increment jcluster when starting from icluster (if icluster is below number of clusters!)
     if(icluster < size())
-        matrix[icluster].increment(jcluster);
+    {
+        auto& row = rows[icluster];
+        const auto [it, inserted] = row.slots.try_emplace(jcluster, row.clusters.size());
+        if(inserted)
+        {
+            row.clusters.push_back(jcluster);
+            row.queue.extend();
+        }
+        row.queue.increment(it->second);
+    }
 
     // Increment usage count of jcluster
-    queue.increment(jcluster);
+    usage.increment(jcluster);
+}
+
+auto ClusterConnectivity::order(Index icluster) const -> Order
+{
+    return Order(icluster < size() ? &rows[icluster] : nullptr, usage);
+}
+
+auto ClusterConnectivity::clusters(Index icluster) const -> Indices
+{
+    if(icluster < size())
+        return rows[icluster].clusters;
+    Indices all(size());
+    std::iota(all.begin(), all.end(), 0);
+    return all;
+}
+
+auto ClusterConnectivity::queue(Index icluster) const -> PriorityQueue const&
+{
+    return icluster < size() ? rows[icluster].queue : usage;
+}
+
+//=====================================================================================================================
+//
+// ClusterConnectivity::Order
+//
+//=====================================================================================================================
+
+ClusterConnectivity::Order::Order(Row const* row, PriorityQueue const& usage)
+: row(row), usage(usage), nvisited(row ? row->clusters.size() : 0)
+{}
+
+auto ClusterConnectivity::Order::size() const -> Index
+{
+    return usage.size();
+}
+
+auto ClusterConnectivity::Order::begin() const -> Iterator
+{
+    return Iterator(*this, 0);
+}
+
+auto ClusterConnectivity::Order::end() const -> Iterator
+{
+    return Iterator(*this, nvisited + usage.size());
+}
+
+auto ClusterConnectivity::Order::indices() const -> Indices
+{
+    Indices result;
+    result.reserve(size());
+    for(auto icluster : *this)
+        result.push_back(icluster);
+    return result;
+}
+
+ClusterConnectivity::Order::Iterator::Iterator(Order const& order, Index pos)
+: order(&order), pos(pos)
+{
+    skip();
+}
+
+auto ClusterConnectivity::Order::Iterator::operator*() const -> Index
+{
+    // The clusters visited from the starting cluster come first, ordered by their usage counts from it
+    if(pos < order->nvisited)
+        return order->row->clusters[order->row->queue.order()[pos]];
+
+    // All other clusters follow, ordered by their total usage counts
+    return order->usage.order()[pos - order->nvisited];
+}
+
+auto ClusterConnectivity::Order::Iterator::operator++() -> Iterator&
+{
+    ++pos;
+    skip();
+    return *this;
 }
 
-auto ClusterConnectivity::order(Index icluster) const -> Deque<Index> const&
+auto ClusterConnectivity::Order::Iterator::skip() -> void
 {
-    return icluster < size() ? matrix[icluster].order() : queue.order();
+    if(!order->row)
+        return;
+    const auto end = order->nvisited + order->usage.size();
+    auto const& slots = order->row->slots;
+    while(pos >= order->nvisited && pos < end && slots.find(order->usage.order()[pos - order->nvisited]) != slots.end())
+        ++pos;
 }
 
 } // namespace Reaktoro
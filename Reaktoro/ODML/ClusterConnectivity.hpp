@@ -17,6 +17,10 @@
 
 #pragma once
 
+// C++ includes
+#include <cstddef>
+#include <iterator>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/ODML/PriorityQueue.hpp>
@@ -24,16 +28,34 @@
 namespace Reaktoro {
 
 // The connectivity matrix of the clusters.
+/// Used to determine the order in which clusters are visited when searching for a learned calculation from a starting cluster.
+/// The connectivity is stored sparsely: each cluster keeps the usage counts of
+/// only the clusters in which learned calculations were used when starting
+/// from it. The order of clusters for a starting cluster is given by these
+/// usage counts, followed by all other clusters in the order of their total
+/// usage counts. The memory used thus grows with the number of visited
+/// connections between clusters rather than with the square of the number of
+/// clusters.
 class ClusterConnectivity
 {
 public:
+    /// The order of clusters for a starting cluster, which is a view of the connectivity computed while iterated (see @ref order).
+    class Order;
+
     /// Construct a default instance of ClusterConnectivity.
     ClusterConnectivity();
 
+    /// Return a ClusterConnectivity instance with given visited clusters and priority queues of each cluster and of all clusters.
+    /// @param clusters The clusters visited when starting from each cluster (see @ref clusters).
+    /// @param queues The priority queue of the visited clusters when starting from each cluster (see @ref queue).
+    /// @param queue The priority queue of the clusters based on their usage count.
+    static auto withInitialQueues(Deque<Indices> const& clusters, Deque<PriorityQueue> const& queues, PriorityQueue const& queue) -> ClusterConnectivity;
+
     /// Return number of currently tracked clusters.
     auto size() const -> Index;
 
-    /// Extend the connectivity matrix following creation of a new cluster.
+    /// Extend the connectivity following creation of a new cluster.
+    /// The new cluster is the first one visited when starting from it.
     auto extend() -> void;
 
     /// Increment the rank/usage count for the connectivity from one cluster to another.
@@ -46,17 +68,102 @@ public:
     auto increment(Index icluster, Index jcluster) -> void;
 
     /// Return the order of clusters for a given starting cluster.
+    /// The returned view does not allocate memory and is valid until the
+    /// connectivity is changed.
     /// @param icluster The index of the starting cluster.
     /// @note If index `icluster` is equal or greater than number of clusters,
     /// then an ordering based on usage count of clusters is returned.
-    auto order(Index icluster) const -> Deque<Index> const&;
+    auto order(Index icluster) const -> Order;
+
+    /// Return the clusters visited when starting from a given cluster, which are the identities in the priority queue returned by @ref queue.
+    /// @param icluster The index of the starting cluster.
+    /// @note If index `icluster` is equal or greater than number of clusters,
+    /// then all clusters are returned.
+    auto clusters(Index icluster) const -> Indices;
+
+    /// Return the priority queue of the visited clusters for a given starting cluster.
+    /// @param icluster The index of the starting cluster.
+    /// @note If index `icluster` is equal or greater than number of clusters,
+    /// then the priority queue based on usage count of clusters is returned.
+    auto queue(Index icluster) const -> PriorityQueue const&;
 
 private:
-    /// The connectivity of each cluster with others in terms of priority queue for visitation.
-    Deque<PriorityQueue> matrix;
+    /// The clusters visited when starting from a cluster and their priority queue for visitation.
+    struct Row
+    {
+        /// The visited clusters, in the order they were first visited.
+        Indices clusters;
+
+        /// The position of each visited cluster in @ref clusters.
+        Map<Index, Index> slots;
+
+        /// The priority queue of the visited clusters (whose identities are their positions in @ref clusters).
+        PriorityQueue queue;
+    };
+
+    /// The clusters visited when starting from each cluster.
+    Deque<Row> rows;
 
     /// The ordering of clusters based on their usage count.
-    PriorityQueue queue;
+    PriorityQueue usage;
+};
+
+class ClusterConnectivity::Order
+{
+public:
+    /// Used to iterate over the clusters in the order, skipping those in the usage-based ordering that were already visited from the starting cluster.
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Index;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Index const*;
+        using reference = Index;
+
+        /// Construct an Iterator object at a given position in the clusters visited from the starting cluster followed by those in the usage-based ordering.
+        Iterator(Order const& order, Index pos);
+
+        auto operator*() const -> Index;
+        auto operator++() -> Iterator&;
+        auto operator==(Iterator const& other) const -> bool { return pos == other.pos; }
+        auto operator!=(Iterator const& other) const -> bool { return pos != other.pos; }
+
+    private:
+        /// The order being iterated.
+        Order const* order;
+
+        /// The current position in the clusters visited from the starting cluster followed by those in the usage-based ordering.
+        Index pos;
+
+        /// Advance the position past the clusters in the usage-based ordering that were already visited from the starting cluster.
+        auto skip() -> void;
+    };
+
+    /// Construct an Order object for the clusters visited from a starting cluster (null if none) followed by the others in a usage-based ordering.
+    Order(Row const* row, PriorityQueue const& usage);
+
+    /// Return the number of clusters in the order.
+    auto size() const -> Index;
+
+    /// Return an iterator to the first cluster in the order.
+    auto begin() const -> Iterator;
+
+    /// Return an iterator past the last cluster in the order.
+    auto end() const -> Iterator;
+
+    /// Return the clusters in the order.
+    auto indices() const -> Indices;
+
+private:
+    /// The clusters visited from the starting cluster (null if no starting cluster).
+    Row const* row;
+
+    /// The ordering of all clusters based on their usage count.
+    PriorityQueue const& usage;
+
+    /// The number of clusters visited from the starting cluster, which come first in the order.
+    Index nvisited;
 };
 
 } // namespace Reaktoro
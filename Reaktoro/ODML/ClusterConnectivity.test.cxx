@@ -0,0 +1,81 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/ODML/ClusterConnectivity.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing ClusterConnectivity", "[ClusterConnectivity]")
+{
+    ClusterConnectivity connectivity;
+
+    connectivity.extend();
+    connectivity.extend();
+    connectivity.extend();
+    connectivity.extend();
+
+    CHECK( connectivity.size() == 4 );
+
+    // Each cluster is visited first when starting from it, followed by all others by their usage counts
+    CHECK( connectivity.order(0).indices() == Indices{ 0, 1, 2, 3 } );
+    CHECK( connectivity.order(2).indices() == Indices{ 2, 0, 1, 3 } );
+    CHECK( connectivity.order(4).indices() == Indices{ 0, 1, 2, 3 } );
+
+    connectivity.increment(0, 3);
+    connectivity.increment(0, 3);
+    connectivity.increment(0, 2);
+    connectivity.increment(4, 1); // no starting cluster, only the usage count of cluster 1 is incremented
+
+    CHECK( connectivity.order(0).indices() == Indices{ 3, 2, 0, 1 } );
+    CHECK( connectivity.order(1).indices() == Indices{ 1, 3, 2, 0 } );
+    CHECK( connectivity.order(4).indices() == Indices{ 3, 2, 1, 0 } );
+
+    // The order is a view of the connectivity that can be iterated without creating a list of clusters
+    Indices visited;
+    for(auto icluster : connectivity.order(1))
+        visited.push_back(icluster);
+    CHECK( visited == Indices{ 1, 3, 2, 0 } );
+    CHECK( connectivity.order(1).size() == 4 );
+
+    // Only the visited clusters are stored for each starting cluster
+    CHECK( connectivity.clusters(0) == Indices{ 0, 3, 2 } );
+    CHECK( connectivity.clusters(1) == Indices{ 1 } );
+    CHECK( connectivity.clusters(4) == Indices{ 0, 1, 2, 3 } );
+    CHECK( connectivity.queue(0).priorities() == Deque<Index>{ 0, 2, 1 } );
+
+    connectivity.extend();
+
+    CHECK( connectivity.order(4).indices() == Indices{ 4, 3, 2, 1, 0 } );
+    CHECK( connectivity.order(0).indices() == Indices{ 3, 2, 0, 1, 4 } );
+
+    // Reconstruct the connectivity from its priority queues
+    Deque<Indices> clusters;
+    Deque<PriorityQueue> queues;
+    for(auto i = 0; i < connectivity.size(); ++i)
+    {
+        clusters.push_back(connectivity.clusters(i));
+        queues.push_back(connectivity.queue(i));
+    }
+
+    const auto copy = ClusterConnectivity::withInitialQueues(clusters, queues, connectivity.queue(connectivity.size()));
+
+    for(auto i = 0; i <= connectivity.size(); ++i)
+        CHECK( copy.order(i).indices() == connectivity.order(i).indices() );
+}
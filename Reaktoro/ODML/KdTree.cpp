@@ -0,0 +1,149 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "KdTree.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <queue>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+
+namespace Reaktoro {
+
+KdTree::KdTree()
+{}
+
+KdTree::KdTree(Index dimension)
+: dim(dimension)
+{}
+
+auto KdTree::dimension() const -> Index
+{
+    return dim;
+}
+
+auto KdTree::size() const -> Index
+{
+    return numpoints;
+}
+
+auto KdTree::empty() const -> bool
+{
+    return numpoints == 0;
+}
+
+auto KdTree::point(Index identity) const -> VectorXdConstRef
+{
+    return points.col(identity);
+}
+
+auto KdTree::insert(VectorXdConstRef point) -> Index
+{
+    errorif(dim == 0, "Cannot insert points in a KdTree object with zero dimension.");
+    errorif(point.size() != dim, "Expecting a point with dimension ", dim, " in KdTree::insert, but got ", point.size(), ".");
+
+    // Grow the storage of the points geometrically to keep insertions O(1) amortized
+    if(numpoints == points.cols())
+        points.conservativeResize(dim, std::max<Index>(2 * numpoints, 8));
+
+    const auto identity = numpoints++;
+    points.col(identity) = point;
+
+    if(nodes.empty())
+    {
+        nodes.push_back({ identity, 0 });
+        return identity;
+    }
+
+    // Descend the tree until a free child slot is found for the new point
+    long inode = 0;
+    while(true)
+    {
+        const auto axis = nodes[inode].axis;
+        const auto goleft = point[axis] < points(axis, nodes[inode].identity);
+        const auto child = goleft ? nodes[inode].left : nodes[inode].right;
+        if(child < 0)
+        {
+            const long inew = nodes.size();
+            nodes.push_back({ identity, (axis + 1) % dim });
+            if(goleft) nodes[inode].left = inew;
+            else nodes[inode].right = inew;
+            return identity;
+        }
+        inode = child;
+    }
+}
+
+auto KdTree::nearest(VectorXdConstRef point, Index k) const -> Indices
+{
+    errorif(point.size() != dim, "Expecting a point with dimension ", dim, " in KdTree::nearest, but got ", point.size(), ".");
+
+    if(nodes.empty() || k == 0)
+        return {};
+
+    // The max-heap of the nearest points found so far as pairs of squared distances and identities
+    std::priority_queue<Pair<double, Index>> best;
+
+    // The nodes to visit in a depth-first traversal and the squared distances of the query point to their splitting planes
+    Vec<Pair<long, double>> stack;
+    stack.push_back({ 0, 0.0 });
+
+    while(!stack.empty())
+    {
+        const auto [inode, planedist] = stack.back();
+        stack.pop_back();
+
+        // Skip subtrees that cannot contain points nearer than the k-th nearest point found so far
+        if(best.size() == k && planedist >= best.top().first)
+            continue;
+
+        auto const& node = nodes[inode];
+
+        const double dist = (points.col(node.identity) - point).squaredNorm();
+
+        if(best.size() < k)
+            best.push({ dist, node.identity });
+        else if(dist < best.top().first)
+        {
+            best.pop();
+            best.push({ dist, node.identity });
+        }
+
+        const double delta = point[node.axis] - points(node.axis, node.identity);
+        const auto nearchild = delta < 0.0 ? node.left : node.right;
+        const auto farchild = delta < 0.0 ? node.right : node.left;
+
+        // Push the far side first so that the near side is visited first
+        if(farchild >= 0)
+            stack.push_back({ farchild, std::max(planedist, delta * delta) });
+        if(nearchild >= 0)
+            stack.push_back({ nearchild, planedist });
+    }
+
+    Indices identities(best.size());
+    for(auto i = identities.size(); i > 0; --i)
+    {
+        identities[i - 1] = best.top().second;
+        best.pop();
+    }
+
+    return identities;
+}
+
+} // namespace Reaktoro
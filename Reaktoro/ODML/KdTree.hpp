@@ -0,0 +1,90 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// A k-d tree for nearest neighbor searches among points inserted incrementally.
+/// The points are identified by the order in which they are inserted. The
+/// tree is not rebalanced after insertions, which is adequate for points
+/// that arrive in no particular order, as learned calculations do.
+class KdTree
+{
+public:
+    /// Construct a default instance of KdTree.
+    KdTree();
+
+    /// Construct a KdTree instance for points with given dimension.
+    explicit KdTree(Index dimension);
+
+    /// Return the dimension of the points in the tree.
+    auto dimension() const -> Index;
+
+    /// Return the number of points in the tree.
+    auto size() const -> Index;
+
+    /// Return true if there are no points in the tree.
+    auto empty() const -> bool;
+
+    /// Return the coordinates of a point in the tree.
+    /// @param identity The index of the point in the order of insertion.
+    auto point(Index identity) const -> VectorXdConstRef;
+
+    /// Insert a new point in the tree and return its identity (i.e., the number of points inserted before it).
+    auto insert(VectorXdConstRef point) -> Index;
+
+    /// Return the identities of the points nearest to a given point, sorted by increasing Euclidean distance.
+    /// @param point The point whose nearest neighbors are sought.
+    /// @param k The maximum number of nearest neighbors to return.
+    auto nearest(VectorXdConstRef point, Index k) const -> Indices;
+
+private:
+    /// The node of the tree holding a point and the indices of its children (or `-1` if none).
+    struct Node
+    {
+        /// The identity of the point in this node.
+        Index identity;
+
+        /// The coordinate along which the points in the child nodes are split.
+        Index axis;
+
+        /// The index of the node with the points whose coordinate along `axis` is less than in this node.
+        long left = -1;
+
+        /// The index of the node with the remaining points.
+        long right = -1;
+    };
+
+    /// The dimension of the points in the tree.
+    Index dim = 0;
+
+    /// The coordinates of the points in the tree (one column per point).
+    MatrixXd points;
+
+    /// The number of points in the tree (columns in `points` beyond this are reserved storage).
+    Index numpoints = 0;
+
+    /// The nodes of the tree, in which the root is the first.
+    Vec<Node> nodes;
+};
+
+} // namespace Reaktoro
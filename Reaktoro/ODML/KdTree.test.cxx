@@ -0,0 +1,76 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <algorithm>
+#include <numeric>
+
+// Reaktoro includes
+#include <Reaktoro/ODML/KdTree.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing KdTree", "[KdTree]")
+{
+    const auto dim = 3;
+    const auto numpoints = 200;
+
+    KdTree tree(dim);
+
+    CHECK( tree.empty() );
+    CHECK( tree.dimension() == dim );
+    CHECK( tree.nearest(VectorXd::Zero(dim), 5).empty() );
+
+    MatrixXd points = MatrixXd::Random(dim, numpoints);
+
+    for(auto i = 0; i < numpoints; ++i)
+        CHECK( tree.insert(points.col(i)) == i );
+
+    CHECK( tree.size() == numpoints );
+    CHECK( tree.point(7) == points.col(7) );
+
+    // The nearest neighbors computed with a brute force search are used as reference
+    auto bruteforce = [&](VectorXdConstRef x, Index k)
+    {
+        Indices identities(numpoints);
+        std::iota(identities.begin(), identities.end(), 0);
+        std::stable_sort(identities.begin(), identities.end(), [&](Index l, Index r)
+            { return (points.col(l) - x).squaredNorm() < (points.col(r) - x).squaredNorm(); });
+        identities.resize(k);
+        return identities;
+    };
+
+    const MatrixXd queries = MatrixXd::Random(dim, 20);
+
+    for(auto j = 0; j < queries.cols(); ++j)
+    {
+        CHECK( tree.nearest(queries.col(j), 1) == bruteforce(queries.col(j), 1) );
+        CHECK( tree.nearest(queries.col(j), 10) == bruteforce(queries.col(j), 10) );
+    }
+
+    // The nearest point to an inserted point is itself
+    CHECK( tree.nearest(points.col(42), 1) == Indices{ 42 } );
+
+    // Requesting more neighbors than there are points returns all points
+    CHECK( tree.nearest(queries.col(0), 2 * numpoints).size() == numpoints );
+
+    // Points with wrong dimension are not accepted
+    CHECK_THROWS( tree.insert(VectorXd::Zero(dim + 1)) );
+    CHECK_THROWS( tree.nearest(VectorXd::Zero(dim + 1), 1) );
+}
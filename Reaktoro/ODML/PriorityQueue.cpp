@@ -33,6 +33,7 @@ auto PriorityQueue::withInitialSize(Index size) -> PriorityQueue
     queue._priorities.resize(size, 0);
     queue._order.resize(size);
     std::iota(queue._order.begin(), queue._order.end(), 0);
+    queue.reindex();
     return queue;
 }
 
@@ -41,8 +42,9 @@ auto PriorityQueue::withInitialPriorities(Deque<Index> const& priorities) -> Pri
     const auto size = priorities.size();
     PriorityQueue queue = PriorityQueue::withInitialSize(size);
     queue._priorities = priorities;
-    std::sort(queue._order.begin(), queue._order.end(),
+    std::stable_sort(queue._order.begin(), queue._order.end(),
         [&](Index l, Index r) { return priorities[l] > priorities[r]; });
+    queue.reindex();
     return queue;
 }
 
@@ -52,6 +54,7 @@ auto PriorityQueue::withInitialOrder(Deque<Index> const& order) -> PriorityQueue
     PriorityQueue queue;
     queue._priorities.resize(size, 0);
     queue._order = order;
+    queue.reindex();
     return queue;
 }
 
@@ -63,6 +66,7 @@ auto PriorityQueue::withInitialPrioritiesAndOrder(Deque<Index> const& priorities
     queue._order = order;
     std::stable_sort(queue._order.begin(), queue._order.end(),
         [&](Index l, Index r) { return priorities[l] > priorities[r]; });
+    queue.reindex();
     return queue;
 }
 
@@ -75,42 +79,66 @@ auto PriorityQueue::reset() -> void
 {
     std::fill(_priorities.begin(), _priorities.end(), 0);
     std::iota(_order.begin(), _order.end(), 0);
+    reindex();
 }
 
 auto PriorityQueue::increment(Index identity) -> void
 {
+    assert(identity < size());
+
     // == EXAMPLE OF WHAT HAPPENS IN THIS METHOD ==
-    // PRIORITIES BEFORE INCREMENTING: 13  5  3  2  2 (2) 1  --- incrementing from 2 to 3
-    //  PRIORITIES AFTER INCREMENTING: 13  5  3 [2] 2 (3) 1  --- (3) needs to be swapped with [2]
-    //       PRIORITIES AFTER SORTING: 13  5  3 (3) 2 [2] 1
+    //  PRIORITIES BEFORE INCREMENTING: 13  5  3 [2] 2 (2) 1  --- incrementing (2) from 2 to 3
+    // AFTER SWAPPING WITH BLOCK FRONT: 13  5  3 (2) 2 [2] 1  --- (2) is now the first entity with priority 2
+    //   PRIORITIES AFTER INCREMENTING: 13  5  3 (3) 2 [2] 1  --- (3) is now the last entity with priority 3
+    // No other entity needs to be moved, since the order is kept in blocks of entities with equal priorities.
+
+    const auto priority = _priorities[identity];
+    const auto position = _positions[identity];
+
+    // The first position of the block of entities with the same priority
+    auto& start = _starts.at(priority);
+    const auto front = start;
+
+    // Swap the entity with the one at the front of its block
+    const auto other = _order[front];
+    _order[front] = identity;
+    _order[position] = other;
+    _positions[identity] = front;
+    _positions[other] = position;
+
+    // The entity leaves its block and joins the end of the block with the incremented priority, which ends just before the front position
     _priorities[identity] += 1;
+    _starts.try_emplace(priority + 1, front); // if no entity has the incremented priority, the entity starts a new block
 
-    // == CORNER CASES:
-    // IF identity = 0 (the priority of the very first element is increased)
-    // NO SORTING IS APPLIED (THE CHANGE IN PRIORITIES DIDN'T AFFECT THE ORDER)
-    // PRIORITIES BEFORE INCREMENTING: (13)  5  3  2  2  2  1    --- incrementing from 13 to 14
-    //  PRIORITIES AFTER INCREMENTING: (14)  5  3  2  2  3  1  --- (14) does not need to be swapped with anyone
-
-    // == CORNER CASES:
-    // IF _priorities[identity - 1] >= _priorities[identity]
-    // NO SORTING IS APPLIED (THE CHANGE IN PRIORITIES DIDN'T AFFECT THE ORDER)
-    // PRIORITIES BEFORE INCREMENTING: 13  5 (3)  2  2  2  1    --- incrementing from 3 to 4
-    //  PRIORITIES AFTER INCREMENTING: 13  5 (4)  2  2  3  1  --- (4) is still smaller than 5, it does not need to be swapped with anyone
-
-    // Avoid sorting if the identity == 0 (the priority of the very first element is increased)
-    // or if the increase of priority does not ruin the order in _priorities
-    if(!((identity == 0) || (_priorities[identity - 1] >= _priorities[identity]))){
-        std::sort(_order.begin(), _order.begin() + identity + 1,
-                  [&](Index l, Index r) { return _priorities[l] > _priorities[r]; });
-    }
-    //std::sort(_order.begin(), _order.begin() + identity + 1,
-    //    [&](Index l, Index r) { return _priorities[l] > _priorities[r]; });
+    // Shrink the block the entity left, or remove it if it became empty
+    if(front + 1 < size() && _priorities[_order[front + 1]] == priority)
+        start = front + 1;
+    else _starts.erase(priority);
 }
 
 auto PriorityQueue::extend() -> void
 {
+    // The new entity has zero priority and is thus the last one in the order
     _priorities.push_back(0);
+    _positions.push_back(_order.size());
     _order.push_back(_order.size());
+    _starts.try_emplace(0, _order.size() - 1);
+}
+
+auto PriorityQueue::remove(Index identity) -> void
+{
+    assert(identity < size());
+
+    // Removing an entity does not change the relative order of the remaining ones
+    _priorities.erase(_priorities.begin() + identity);
+    _order.erase(_order.begin() + _positions[identity]);
+
+    // Shift the identities of the entities after the removed one
+    for(auto& i : _order)
+        if(i > identity)
+            --i;
+
+    reindex();
 }
 
 auto PriorityQueue::priorities() const -> Deque<Index> const&
@@ -123,4 +151,15 @@ auto PriorityQueue::order() const -> Deque<Index> const&
     return _order;
 }
 
+auto PriorityQueue::reindex() -> void
+{
+    _positions.resize(_order.size());
+    _starts.clear();
+    for(auto i = 0; i < _order.size(); ++i)
+    {
+        _positions[_order[i]] = i;
+        _starts.try_emplace(_priorities[_order[i]], i);
+    }
+}
+
 } // namespace Reaktoro
@@ -23,6 +23,13 @@
 namespace Reaktoro {
 
 // A queue organized based on priorities that can change dynamically.
+/// Used to order tracked entities based on their priorities (e.g., usage counts).
+/// The entities are kept in order of decreasing priority, in contiguous
+/// blocks of entities with equal priority. Incrementing the priority of an
+/// entity moves it to the front of its block and then to the end of the
+/// preceding one, which takes constant time. Entities with equal priority
+/// are thus ordered deterministically: the one whose priority was
+/// incremented last comes last among them.
 class PriorityQueue
 {
 public:
@@ -33,6 +40,8 @@ public:
     static auto withInitialSize(Index size) -> PriorityQueue;
 
     /// Return a PriorityQueue instance with given initial priorities.
+    /// @note A stable sort algorithm is applied, so that entities with equal
+    /// priorities are ordered by their identities.
     static auto withInitialPriorities(Deque<Index> const& priorities) -> PriorityQueue;
 
     /// Return a PriorityQueue instance with an initial order and zero priorities.
@@ -49,13 +58,19 @@ public:
     /// Reset the priorities of the tracked entities.
     auto reset() -> void;
 
-    /// Increment the priority of a tracked entity.
+    /// Increment the priority of a tracked entity in constant time.
     /// @param identity The index of the tracked entity.
     auto increment(Index identity) -> void;
 
     /// Extend the queue with the introduction of a new tracked entity.
     auto extend() -> void;
 
+    /// Remove a tracked entity from the queue.
+    /// The identities of the tracked entities after the removed one are
+    /// decremented by one. This takes linear time in the size of the queue.
+    /// @param identity The index of the tracked entity.
+    auto remove(Index identity) -> void;
+
     /// Return the current priorities of each tracked entity in the queue.
     auto priorities() const -> Deque<Index> const&;
 
@@ -68,6 +83,15 @@ private:
 
     /// The order of the tracked entities based on their current priorities.
     Deque<Index> _order;
+
+    /// The position of each tracked entity in the order.
+    Deque<Index> _positions;
+
+    /// The first position in the order of the block of tracked entities with each current priority.
+    Map<Index, Index> _starts;
+
+    /// Update the positions of the tracked entities and the blocks of equal priorities after changes in the order.
+    auto reindex() -> void;
 };
 
 } // namespace Reaktoro
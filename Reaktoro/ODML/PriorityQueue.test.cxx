@@ -0,0 +1,111 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <algorithm>
+#include <random>
+
+// Reaktoro includes
+#include <Reaktoro/ODML/PriorityQueue.hpp>
+using namespace Reaktoro;
+
+/// Check the order of a priority queue is consistent with its priorities.
+auto checkOrder(PriorityQueue const& queue)
+{
+    auto const& priorities = queue.priorities();
+    auto const& order = queue.order();
+
+    REQUIRE( order.size() == queue.size() );
+
+    Deque<Index> sorted(order.begin(), order.end());
+    std::sort(sorted.begin(), sorted.end());
+    for(auto i = 0; i < sorted.size(); ++i)
+        REQUIRE( sorted[i] == i );
+
+    for(auto i = 1; i < order.size(); ++i)
+        REQUIRE( priorities[order[i - 1]] >= priorities[order[i]] );
+}
+
+TEST_CASE("Testing PriorityQueue", "[PriorityQueue]")
+{
+    auto queue = PriorityQueue::withInitialSize(5);
+
+    CHECK( queue.size() == 5 );
+    CHECK( queue.order() == Deque<Index>{ 0, 1, 2, 3, 4 } );
+    CHECK( queue.priorities() == Deque<Index>{ 0, 0, 0, 0, 0 } );
+
+    queue.increment(3);
+    CHECK( queue.order() == Deque<Index>{ 3, 1, 2, 0, 4 } );
+
+    queue.increment(4);
+    CHECK( queue.order() == Deque<Index>{ 3, 4, 2, 0, 1 } ); // the last incremented entity comes last among those with equal priority
+
+    queue.increment(4);
+    CHECK( queue.order() == Deque<Index>{ 4, 3, 2, 0, 1 } );
+    CHECK( queue.priorities() == Deque<Index>{ 0, 0, 0, 1, 2 } );
+
+    queue.extend();
+    CHECK( queue.order() == Deque<Index>{ 4, 3, 2, 0, 1, 5 } );
+
+    queue.increment(5);
+    CHECK( queue.order() == Deque<Index>{ 4, 3, 5, 0, 1, 2 } );
+
+    queue.remove(3);
+    CHECK( queue.order() == Deque<Index>{ 3, 4, 0, 1, 2 } );
+    CHECK( queue.priorities() == Deque<Index>{ 0, 0, 0, 2, 1 } );
+
+    queue.increment(0);
+    queue.increment(0);
+    queue.increment(0);
+    CHECK( queue.order() == Deque<Index>{ 0, 3, 4, 1, 2 } );
+
+    queue.reset();
+    CHECK( queue.order() == Deque<Index>{ 0, 1, 2, 3, 4 } );
+    CHECK( queue.priorities() == Deque<Index>{ 0, 0, 0, 0, 0 } );
+
+    queue = PriorityQueue::withInitialPriorities({ 1, 3, 1, 0, 3 });
+    CHECK( queue.order() == Deque<Index>{ 1, 4, 0, 2, 3 } );
+
+    queue.increment(3);
+    CHECK( queue.order() == Deque<Index>{ 1, 4, 0, 2, 3 } );
+
+    queue.increment(3);
+    CHECK( queue.order() == Deque<Index>{ 1, 4, 3, 2, 0 } );
+
+    queue = PriorityQueue::withInitialPrioritiesAndOrder({ 1, 3, 1, 0, 3 }, { 4, 3, 2, 1, 0 });
+    CHECK( queue.order() == Deque<Index>{ 4, 1, 2, 0, 3 } );
+
+    // Check the order remains consistent with the priorities after many random operations
+    std::mt19937 generator(0);
+
+    queue = PriorityQueue::withInitialSize(10);
+
+    for(auto i = 0; i < 2000; ++i)
+    {
+        const auto choice = generator() % 20;
+        if(choice == 0)
+            queue.extend();
+        else if(choice == 1 && queue.size() > 1)
+            queue.remove(generator() % queue.size());
+        else queue.increment(generator() % queue.size());
+
+        checkOrder(queue);
+    }
+}
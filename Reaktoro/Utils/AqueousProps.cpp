@@ -36,6 +36,7 @@ using namespace tabulate;
 #include <Reaktoro/Core/ChemicalProps.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Database.hpp>
 #include <Reaktoro/Core/Phase.hpp>
 #include <Reaktoro/Core/Species.hpp>
 #include <Reaktoro/Core/SpeciesList.hpp>
@@ -206,22 +207,11 @@ struct AqueousProps::Impl
         error(iH >= Naq, "Cannot create AqueousProps object for phase ", phase.name(), " "
             "because it does not contain a species with formula H+ or H3O+.");
 
-        // The symbols of the elements in the aqueous phase
-        const auto symbols = vectorize(phase.elements(), RKT_LAMBDA(x, x.symbol()));
-
         // The aqueous species in the aqueous phase
         auto const& aqspecies = phase.species();
 
-        // Collect the species from the database that contains the elements in the aqueous phase
-        const auto species_same_elements = system.database().species().withElements(symbols);
-
         // Collect the non-aqueous species from the database that contains the elements in the aqueous phase
-        nonaqueous = removefn(species_same_elements, RKT_LAMBDA(x, x.aggregateState() == AggregateState::Aqueous));
-
-        // Ensure non-aqueous species are sorted by aggregate state (gases, solids, etc)
-        std::sort(nonaqueous.begin(), nonaqueous.end(),
-            [](auto l, auto r)
-                { return l.aggregateState() < r.aggregateState(); });
+        nonaqueous = aqueousSaturationSpecies(phase, system.database());
 
         // Assemble the formula matrices of the aqueous and non-aqueous species w.r.t. elements in the aqueous phase
         Aaqs = detail::assembleFormulaMatrix(phase.species(), phase.elements());
@@ -714,6 +704,25 @@ auto AqueousProps::saturationIndicesLg() const -> ArrayXr
     return {};
 }
 
+auto aqueousSaturationSpecies(Phase const& phase, Database const& database) -> SpeciesList
+{
+    // The symbols of the elements in the aqueous phase
+    const auto symbols = vectorize(phase.elements(), RKT_LAMBDA(x, x.symbol()));
+
+    // Collect the species from the database that contains the elements in the aqueous phase
+    const auto species_same_elements = database.species().withElements(symbols);
+
+    // Collect the non-aqueous species from the database that contains the elements in the aqueous phase
+    auto nonaqueous = removefn(species_same_elements, RKT_LAMBDA(x, x.aggregateState() == AggregateState::Aqueous));
+
+    // Ensure non-aqueous species are sorted by aggregate state (gases, solids, etc)
+    std::sort(nonaqueous.begin(), nonaqueous.end(),
+        [](auto l, auto r)
+            { return l.aggregateState() < r.aggregateState(); });
+
+    return nonaqueous;
+}
+
 auto operator<<(std::ostream& out, AqueousProps const& props) -> std::ostream&
 {
     const auto elements = props.phase().elements();
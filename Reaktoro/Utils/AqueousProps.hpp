@@ -28,6 +28,7 @@ namespace Reaktoro {
 class ChemicalProps;
 class ChemicalState;
 class ChemicalSystem;
+class Database;
 class Phase;
 class Species;
 class SpeciesList;
@@ -209,6 +210,14 @@ private:
     Ptr<Impl> pimpl;
 };
 
+/// Return the non-aqueous species in a database that could be formed from an aqueous phase.
+/// These are the species returned by AqueousProps::saturationSpecies, in the
+/// same order, for an aqueous phase in a chemical system constructed with the
+/// given database. Use this function to determine the indices of these
+/// species before the chemical system is available (e.g., when generating a
+/// reaction rate model).
+auto aqueousSaturationSpecies(Phase const& phase, Database const& database) -> SpeciesList;
+
 /// Output an AqueousProps object to an output stream.
 auto operator<<(std::ostream& out, AqueousProps const& state) -> std::ostream&;
 
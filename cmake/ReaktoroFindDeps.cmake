@@ -41,6 +41,7 @@ ReaktoroFindPackage(tabulate 1.4.0 REQUIRED)
 ReaktoroFindPackage(ThermoFun 0.4.5 REQUIRED)
 ReaktoroFindPackage(tsl-ordered-map 1.0.0 REQUIRED)
 ReaktoroFindPackage(yaml-cpp 0.6.3 REQUIRED)
+find_package(Threads REQUIRED)
 
 # Optional dependencies
 ReaktoroFindPackage(Catch2 2.6.2)